@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Measures how strpy::par::count and strpy::par::find scale with the number of threads.
+ *
+ * Usage: benchmark_parallel [text size in MiB] [maximum number of threads]
+ */
+
+#include "stringpy/count.hpp"
+#include "stringpy/find.hpp"
+#include "stringpy/parallel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+    /** @brief Number of runs of every measurement, the fastest one is reported */
+    constexpr int RUNS = 5;
+
+    /** @brief Builds a text of the given size in megabytes with an occasional needle */
+    std::string make_text(const std::size_t megabytes)
+    {
+        constexpr std::string_view line{"The quick brown fox jumps over the lazy dog; 0123456789 abcdefghij\n"};
+        const auto size = megabytes << 20U;
+        std::string result{};
+        result.reserve(size + line.size());
+
+        for (std::size_t i = 0; result.size() < size; ++i) {
+            result += ((i % 1000) == 999) ? "needle in the haystack\n" : line;
+        }
+
+        return result;
+    }
+
+    /** @brief Returns the fastest time of several runs of a function in milliseconds */
+    template <typename Func>
+    double measure(const Func& func)
+    {
+        auto best = std::chrono::duration<double, std::milli>::max();
+
+        for (int run = 0; run < RUNS; ++run) {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            best = std::min(best, std::chrono::duration<double, std::milli>{std::chrono::steady_clock::now() - start});
+        }
+
+        return best.count();
+    }
+
+    /** @brief Keeps the result of a benchmarked call alive */
+    volatile std::size_t sink = 0;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const auto megabytes = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 512;
+    const auto text = make_text(megabytes);
+    const auto max_threads = (argc > 2) ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                                        : std::max(1U, std::thread::hardware_concurrency());
+
+    const auto count_sequential = measure([&] {
+        sink = strpy::count(text, "needle");
+    });
+
+    const auto find_sequential = measure([&] {
+        sink = strpy::find(text, "missing needle");
+    });
+
+    std::cout << "Text size: " << megabytes << " MiB" << '\n';
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "count, ms" << std::setw(10) << "speedup"
+              << std::setw(14) << "find, ms" << std::setw(10) << "speedup" << '\n';
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(8) << "seq" << std::setw(14) << count_sequential << std::setw(10) << 1.0 << std::setw(14)
+              << find_sequential << std::setw(10) << 1.0 << '\n';
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        const auto count_parallel = measure([&] {
+            sink = strpy::par::count(text, "needle", threads);
+        });
+
+        const auto find_parallel = measure([&] {
+            sink = strpy::par::find(text, "missing needle", threads);
+        });
+
+        std::cout << std::setw(8) << threads << std::setw(14) << count_parallel << std::setw(10)
+                  << (count_sequential / count_parallel) << std::setw(14) << find_parallel << std::setw(10)
+                  << (find_sequential / find_parallel) << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Measures splitting a text into short tokens at every SIMD level, where the cost of a call
+ * on a short token matters more than the speed of the scan.
+ *
+ * Usage: benchmark_split [text size in MiB] [token size]
+ */
+
+#include "stringpy/charset.hpp"
+#include "stringpy/cpu.hpp"
+#include "stringpy/split.hpp"
+#include "stringpy/splitview.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /** @brief Number of runs of every measurement, the fastest one is reported */
+    constexpr int RUNS = 5;
+
+    /** @brief Builds a text of the given size in megabytes of tokens separated by ',' and ';' */
+    std::string make_text(const std::size_t megabytes, const std::size_t token_size)
+    {
+        const auto size = megabytes << 20U;
+        std::string result{};
+        result.reserve(size + token_size + 1);
+
+        for (std::size_t i = 0; result.size() < size; ++i) {
+            result.append(token_size, static_cast<char>('a' + (i % 26)));
+            result.push_back(((i % 2) == 0) ? ',' : ';');
+        }
+
+        return result;
+    }
+
+    /** @brief Returns the fastest time of several runs of a function in milliseconds */
+    template <typename Func>
+    double measure(const Func& func)
+    {
+        auto best = std::chrono::duration<double, std::milli>::max();
+
+        for (int run = 0; run < RUNS; ++run) {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            best = std::min(best, std::chrono::duration<double, std::milli>{std::chrono::steady_clock::now() - start});
+        }
+
+        return best.count();
+    }
+
+    /** @brief Keeps the result of a benchmarked call alive */
+    volatile std::size_t sink = 0;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const auto megabytes = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 8;
+    const auto token_size = (argc > 2) ? static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10)) : 8;
+    const auto text = make_text(megabytes, token_size);
+    const strpy::CharSet delimiters{",;"};
+
+    const std::vector<std::pair<std::string_view, std::function<void()>>> cases{
+      {"split(str, CharSet)",
+       [&] {
+           sink = strpy::split<std::string_view>(text, delimiters).size();
+       }},
+      {"rsplit(str, CharSet)",
+       [&] {
+           sink = strpy::rsplit<std::string_view>(text, delimiters).size();
+       }},
+      {"split(str, \",\")",
+       [&] {
+           sink = strpy::split<std::string_view>(text, ",").size();
+       }},
+      {"split(str, ',')",
+       [&] {
+           sink = strpy::split<std::string_view>(text, ',').size();
+       }},
+      {"split_view(str, ',')",
+       [&] {
+           std::size_t count = 0;
+
+           for (const auto token : strpy::split_view(text, ',')) {
+               count += token.size();
+           }
+
+           sink = count;
+       }},
+      {"rsplit_view(str, ',')",
+       [&] {
+           std::size_t count = 0;
+
+           for (const auto token : strpy::rsplit_view(text, ',')) {
+               count += token.size();
+           }
+
+           sink = count;
+       }},
+    };
+
+    std::cout << "Text size: " << megabytes << " MiB, token size: " << token_size << '\n';
+    std::cout << std::setw(24) << "case";
+
+    const auto supported = strpy::supported_simd_level();
+
+    for (auto level = strpy::SimdLevel::scalar; level <= supported;
+         level = static_cast<strpy::SimdLevel>(static_cast<unsigned>(level) + 1)) {
+        std::cout << std::setw(12) << strpy::simd_level_name(level);
+    }
+
+    std::cout << "  (ms)" << '\n' << std::fixed << std::setprecision(2);
+
+    for (const auto& [name, func] : cases) {
+        std::cout << std::setw(24) << name;
+
+        for (auto level = strpy::SimdLevel::scalar; level <= supported;
+             level = static_cast<strpy::SimdLevel>(static_cast<unsigned>(level) + 1)) {
+            strpy::set_simd_level(level);
+            std::cout << std::setw(12) << measure(func);
+        }
+
+        std::cout << '\n';
+    }
+
+    strpy::set_simd_level(supported);
+
+    return 0;
+}
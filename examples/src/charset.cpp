@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/charset.hpp"
+#include "stringpy/find.hpp"
+#include "stringpy/split.hpp"
+#include "stringpy/strip.hpp"
+#include <iostream>
+
+namespace
+{
+    void example1()
+    {
+        constexpr strpy::CharSet separators{",;|"};
+        constexpr std::string_view str{"red,green;;blue|"};
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Tokens:";
+
+        for (const auto& token : strpy::split(str, separators)) {
+            std::cout << " [" << token << ']';
+        }
+
+        std::cout << '\n';
+        std::cout << "Stripped: " << strpy::strip("--==title==--", strpy::CharSet{"-="}) << '\n';
+    }
+
+    void example2()
+    {
+        constexpr std::string_view str{"The quick brown fox"};
+        const auto vowels = strpy::make_charset_icase("AEIOU");
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "First vowel: " << strpy::find_first_of(str, vowels) << '\n';
+        std::cout << "Last vowel: " << strpy::find_last_of(str, vowels) << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (CharSet)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (make_charset_icase)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (CharSet)
+// String: red,green;;blue|
+// Tokens: [red] [green] [blue]
+// Stripped: title
+//
+// Example 2 (make_charset_icase)
+// String: The quick brown fox
+// First vowel: 2
+// Last vowel: 17
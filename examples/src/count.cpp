@@ -33,6 +33,16 @@ namespace
         std::cout << "End: " << end << '\n';
         std::cout << "Count: " << result << '\n';
     }
+
+    void example3()
+    {
+        constexpr std::string_view str{"first line\nsecond line\nthird line\n"};
+        const auto result = strpy::count(str, '\n');
+
+        std::cout << "String: " << str;
+        std::cout << "Character: '\\n'" << '\n';
+        std::cout << "Count: " << result << '\n';
+    }
 }
 
 int main()
@@ -43,6 +53,10 @@ int main()
 
     std::cout << "Example 2 (count_icase)" << '\n';
     example2();
+    std::cout << '\n';
+
+    std::cout << "Example 3 (count with a character)" << '\n';
+    example3();
 
     return 0;
 }
@@ -60,3 +74,10 @@ int main()
 // Start: 13
 // End: 18
 // Count: 1
+//
+// Example 3 (count with a character)
+// String: first line
+// second line
+// third line
+// Character: '\n'
+// Count: 3
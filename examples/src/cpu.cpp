@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/cpu.hpp"
+#include "stringpy/find.hpp"
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+    void example1()
+    {
+        const auto level = strpy::supported_simd_level();
+
+        std::cout << "Supported level: " << strpy::simd_level_name(level) << '\n';
+        std::cout << "Active level: " << strpy::simd_level_name(strpy::simd_level()) << '\n';
+    }
+
+    void example2()
+    {
+        constexpr std::string_view str{"The quick brown fox jumps over the lazy dog"};
+        const auto previous = strpy::simd_level();
+        const auto level = strpy::set_simd_level(strpy::SimdLevel::scalar);
+
+        std::cout << "Active level: " << strpy::simd_level_name(level) << '\n';
+        std::cout << "Position of \"LAZY\": " << strpy::find_icase(str, "LAZY") << '\n';
+
+        strpy::set_simd_level(previous);
+        std::cout << "Position of \"LAZY\" at the previous level: " << strpy::find_icase(str, "LAZY") << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (supported_simd_level and simd_level)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (set_simd_level)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output on a processor with AVX2, without the STRINGPY_SIMD_LEVEL environment variable:
+//
+// Example 1 (supported_simd_level and simd_level)
+// Supported level: avx2
+// Active level: avx2
+//
+// Example 2 (set_simd_level)
+// Active level: scalar
+// Position of "LAZY": 35
+// Position of "LAZY" at the previous level: 35
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/csv.hpp"
+#include <iostream>
+
+namespace
+{
+    void print_record(const strpy::CsvRecord& record)
+    {
+        std::cout << "[";
+
+        for (std::size_t i = 0; i < record.size(); ++i) {
+            std::cout << (i == 0 ? "" : ", ") << "\"" << record[i] << "\"";
+        }
+
+        std::cout << "]" << '\n';
+    }
+
+    void example1()
+    {
+        constexpr std::string_view str{R"(42,"Smith, John","He said ""hello""")"};
+
+        std::cout << "Record: " << str << '\n';
+        std::cout << "Fields: ";
+        print_record(strpy::split_csv(str));
+    }
+
+    void example2()
+    {
+        constexpr std::string_view data{"name\tcount\r\napples\t3\r\npears\t5\r\n"};
+        strpy::CsvReader reader{data, '\t'};
+        strpy::CsvRecord record{};
+
+        while (reader.next(record)) {
+            print_record(record);
+        }
+    }
+
+    void example3()
+    {
+        // The second record is split between the chunks
+        constexpr std::string_view chunks[] = {"id,city\n1,\"New", " York\"\n2,Paris\n"};
+        strpy::CsvReader reader{};
+        strpy::CsvRecord record{};
+
+        for (const auto chunk : chunks) {
+            reader.feed(chunk);
+
+            while (reader.next(record)) {
+                print_record(record);
+            }
+        }
+
+        reader.feed({}, true);
+
+        while (reader.next(record)) {
+            print_record(record);
+        }
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (split_csv)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (CsvReader with a tab delimiter)" << '\n';
+    example2();
+    std::cout << '\n';
+
+    std::cout << "Example 3 (CsvReader over chunks)" << '\n';
+    example3();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (split_csv)
+// Record: 42,"Smith, John","He said ""hello"""
+// Fields: ["42", "Smith, John", "He said "hello""]
+//
+// Example 2 (CsvReader with a tab delimiter)
+// ["name", "count"]
+// ["apples", "3"]
+// ["pears", "5"]
+//
+// Example 3 (CsvReader over chunks)
+// ["id", "city"]
+// ["1", "New York"]
+// ["2", "Paris"]
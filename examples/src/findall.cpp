@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/findall.hpp"
+#include <iostream>
+
+namespace
+{
+    void example1()
+    {
+        constexpr std::string_view str{"aaaaa"};
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Non-overlapping \"aa\":";
+
+        for (const auto pos : strpy::find_all(str, "aa")) {
+            std::cout << ' ' << pos;
+        }
+
+        std::cout << '\n' << "Overlapping \"aa\":";
+
+        for (const auto pos : strpy::find_all(str, "aa", true)) {
+            std::cout << ' ' << pos;
+        }
+
+        std::cout << '\n';
+    }
+
+    void example2()
+    {
+        constexpr std::string_view str{"Hello, World! Hello, world!"};
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Positions of \"WORLD\":";
+
+        for (const auto pos : strpy::find_all_icase(str, "WORLD")) {
+            std::cout << ' ' << pos;
+        }
+
+        std::cout << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (find_all)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (find_all_icase)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (find_all)
+// String: aaaaa
+// Non-overlapping "aa": 0 2
+// Overlapping "aa": 0 1 2 3
+//
+// Example 2 (find_all_icase)
+// String: Hello, World! Hello, world!
+// Positions of "WORLD": 7 21
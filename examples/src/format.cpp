@@ -5,6 +5,26 @@
 
 #include "stringpy/format.hpp"
 #include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Temperature
+    {
+        double celsius{};
+    };
+}
+
+template <>
+struct strpy::formatter<Temperature>
+{
+    static void format(std::string& out, const Temperature& value)
+    {
+        strpy::format_append(out, "{} C", value.celsius);
+    }
+};
 
 namespace
 {
@@ -36,6 +56,38 @@ namespace
         std::cout << "Price: $" << price << '\n';
         std::cout << "Price in string format: \"$" << result << "\"" << '\n';
     }
+
+    void example4()
+    {
+        constexpr auto count = 3;
+        constexpr std::string_view fruit{"apples"};
+
+        // A format string with a wrong number of placeholders does not compile
+        const auto& result = strpy::format(STRPY_FMT("I have {} {}."), count, fruit);
+
+        std::cout << "Formatted string: " << result << '\n';
+    }
+
+    void example5()
+    {
+        constexpr std::string_view names[]{"Alice", "Bob", "Carol"};
+        std::string buffer{};
+
+        // The buffer is reused, it is only reallocated when a line does not fit
+        for (std::size_t i = 0; i < std::size(names); ++i) {
+            buffer.clear();
+            strpy::format_append(buffer, "{}. {}", i + 1, names[i]);
+            std::cout << buffer << " (" << strpy::formatted_size("{}. {}", i + 1, names[i]) << " characters)" << '\n';
+        }
+    }
+
+    void example6()
+    {
+        const std::vector<Temperature> readings{{21.5}, {22.0}};
+        const std::optional<Temperature> missing{};
+
+        std::cout << strpy::format("Readings: {}, next: {}", readings, missing) << '\n';
+    }
 }
 
 int main()
@@ -52,6 +104,18 @@ int main()
     example3();
     std::cout << '\n';
 
+    std::cout << "Example 4 (format with STRPY_FMT)" << '\n';
+    example4();
+    std::cout << '\n';
+
+    std::cout << "Example 5 (format_append and formatted_size)" << '\n';
+    example5();
+    std::cout << '\n';
+
+    std::cout << "Example 6 (format with a formatter)" << '\n';
+    example6();
+    std::cout << '\n';
+
     return 0;
 }
 
@@ -69,3 +133,14 @@ int main()
 // Example 3 (to_string with formatting flags)
 // Price: $9.99
 // Price in string format: "$9.990000"
+//
+// Example 4 (format with STRPY_FMT)
+// Formatted string: I have 3 apples.
+//
+// Example 5 (format_append and formatted_size)
+// 1. Alice (8 characters)
+// 2. Bob (6 characters)
+// 3. Carol (8 characters)
+//
+// Example 6 (format with a formatter)
+// Readings: [21.5 C, 22 C], next: none
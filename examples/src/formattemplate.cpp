@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/formattemplate.hpp"
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace
+{
+    void example1()
+    {
+        // The template is parsed once and rendered for every message
+        const strpy::FormatTemplate tpl{"[{level}] {0} took {1} ms"};
+
+        std::cout << tpl.render("GET /", 12, strpy::arg("level", "info")) << '\n';
+        std::cout << tpl.render("POST /login", 250, strpy::arg("level", "warn")) << '\n';
+    }
+
+    void example2()
+    {
+        const strpy::FormatTemplate tpl{"{{\"user\": \"{user}\", \"id\": {id}}}"};
+        const std::map<std::string, std::string> fields{{"user", "alice"}, {"id", "42"}};
+
+        std::cout << tpl.render_map(fields) << '\n';
+    }
+
+    void example3()
+    {
+        strpy::FormatTemplateCache cache{};
+
+        // A template read from a configuration is parsed on its first use only
+        for (const auto* const text : {"{} is up", "{} is down", "{} is up"}) {
+            std::cout << cache.get(text)->render("db-1") << '\n';
+        }
+
+        std::cout << "Cached templates: " << cache.size() << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (FormatTemplate with positional and named arguments)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (FormatTemplate::render_map)" << '\n';
+    example2();
+    std::cout << '\n';
+
+    std::cout << "Example 3 (FormatTemplateCache)" << '\n';
+    example3();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (FormatTemplate with positional and named arguments)
+// [info] GET / took 12 ms
+// [warn] POST /login took 250 ms
+//
+// Example 2 (FormatTemplate::render_map)
+// {"user": "alice", "id": 42}
+//
+// Example 3 (FormatTemplateCache)
+// db-1 is up
+// db-1 is down
+// db-1 is up
+// Cached templates: 2
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/lineindex.hpp"
+#include "stringpy/find.hpp"
+#include <iostream>
+#include <string>
+
+namespace
+{
+    void example1()
+    {
+        constexpr std::string_view log{"10:00 start\n10:01 connect\r\n10:02 error: timeout\n10:03 retry\n"};
+        const strpy::LineIndex index{log};
+
+        std::cout << "Lines: " << index.size() << '\n';
+        std::cout << "Line 2: " << index.line(2) << '\n';
+
+        const auto offset = strpy::find(log, "timeout");
+        std::cout << "\"timeout\" is in line " << index.line_of(offset) << '\n';
+    }
+
+    void example2()
+    {
+        std::string log{"10:00 start\n10:01 conn"};
+        strpy::LineIndex index{log};
+
+        std::cout << "Lines: " << index.size() << ", last: " << index.line(index.size() - 1) << '\n';
+
+        log += "ect\n10:02 done\n";
+        index.append(log);
+
+        std::cout << "Lines: " << index.size() << ", last: " << index.line(index.size() - 1) << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (LineIndex)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (LineIndex::append)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (LineIndex)
+// Lines: 4
+// Line 2: 10:02 error: timeout
+// "timeout" is in line 2
+//
+// Example 2 (LineIndex::append)
+// Lines: 2, last: 10:01 conn
+// Lines: 3, last: 10:02 done
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/linereader.hpp"
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+    void example1()
+    {
+        std::istringstream stream{"GET /index.html\r\nPOST /login\r\nGET /logout"};
+        strpy::LineReader reader{stream};
+        std::string_view line{};
+
+        while (reader.next(line)) {
+            std::cout << "[" << line << "]" << '\n';
+        }
+    }
+
+    void example2()
+    {
+        // A buffer of 8 bytes: the long line is returned in parts
+        std::istringstream stream{"short\na much longer line\n"};
+        strpy::LineReader reader{stream, false, 8};
+        std::string_view line{};
+
+        while (reader.next(line)) {
+            std::cout << "[" << line << "]" << (reader.partial() ? " (continues)" : "") << '\n';
+        }
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (LineReader)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (LineReader with a small buffer)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (LineReader)
+// [GET /index.html]
+// [POST /login]
+// [GET /logout]
+//
+// Example 2 (LineReader with a small buffer)
+// [short]
+// [a much l] (continues)
+// [onger li] (continues)
+// [ne]
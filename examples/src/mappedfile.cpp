@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/mappedfile.hpp"
+#include "stringpy/count.hpp"
+#include "stringpy/splitlines.hpp"
+#include "stringpy/splitview.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    constexpr auto* PATH = "stringpy_example.txt";
+
+    void example1()
+    {
+        std::error_code error{};
+        const auto file = strpy::make_mapped_file(PATH, error);
+
+        if (error) {
+            std::cout << "Error: " << error.message() << '\n';
+            return;
+        }
+
+        std::cout << "Size: " << file.size() << '\n';
+        std::cout << "Lines: " << strpy::split_lines(file).size() << '\n';
+        std::cout << "Count of \"o\": " << strpy::count(file, "o") << '\n';
+    }
+
+    void example2()
+    {
+        std::error_code error{};
+        const auto file = strpy::make_mapped_file(PATH, error, strpy::MappedFileOptions::no_map);
+
+        for (const auto line : strpy::lines_view(file)) {
+            std::cout << "[" << line << "]" << '\n';
+        }
+    }
+
+    void example3()
+    {
+        std::error_code error{};
+        const auto file = strpy::make_mapped_file("missing.txt", error);
+
+        std::cout << "Failed: " << std::boolalpha << static_cast<bool>(error) << '\n';
+        std::cout << "Empty: " << file.empty() << '\n';
+    }
+}
+
+int main()
+{
+    std::ofstream{PATH} << "Hello, world!\nfoo bar\nlast line\n";
+
+    std::cout << "Example 1 (make_mapped_file)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (make_mapped_file without mapping)" << '\n';
+    example2();
+    std::cout << '\n';
+
+    std::cout << "Example 3 (make_mapped_file with a missing file)" << '\n';
+    example3();
+
+    static_cast<void>(std::remove(PATH));
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (make_mapped_file)
+// Size: 32
+// Lines: 3
+// Count of "o": 4
+//
+// Example 2 (make_mapped_file without mapping)
+// [Hello, world!]
+// [foo bar]
+// [last line]
+//
+// Example 3 (make_mapped_file with a missing file)
+// Failed: true
+// Empty: true
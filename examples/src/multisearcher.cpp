@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/multisearcher.hpp"
+#include <iostream>
+
+namespace
+{
+    void example1()
+    {
+        constexpr std::string_view str{"user=bob password=secret token=abc123"};
+        const auto searcher = strpy::make_multi_searcher({"password=", "token="});
+        const auto counts = searcher.count_each(str);
+        const auto match = searcher.find_any(str);
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Count of \"password=\": " << counts[0] << '\n';
+        std::cout << "Count of \"token=\": " << counts[1] << '\n';
+        std::cout << "First match: pattern " << match.pattern << " at " << match.position << '\n';
+    }
+
+    void example2()
+    {
+        constexpr std::string_view str{"The CAT sat on the Category of DOGS"};
+        const auto searcher = strpy::make_multi_searcher_icase({"cat", "category", "dog"});
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "First: " << searcher.replace_many(str, {"feline", "class", "canine"}) << '\n';
+        std::cout << "Longest: "
+                  << searcher.replace_many(str, {"feline", "class", "canine"}, strpy::MatchKind::leftmost_longest)
+                  << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (make_multi_searcher)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (make_multi_searcher_icase)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (make_multi_searcher)
+// String: user=bob password=secret token=abc123
+// Count of "password=": 1
+// Count of "token=": 1
+// First match: pattern 0 at 9
+//
+// Example 2 (make_multi_searcher_icase)
+// String: The CAT sat on the Category of DOGS
+// First: The feline sat on the felineegory of canineS
+// Longest: The feline sat on the class of canineS
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/parallel.hpp"
+#include <iostream>
+#include <string>
+
+namespace
+{
+    std::string make_text()
+    {
+        std::string result{};
+
+        for (int i = 0; i < 100000; ++i) {
+            result += "The quick brown fox jumps over the lazy dog. ";
+        }
+
+        return result + "The end.";
+    }
+
+    void example1()
+    {
+        const auto text = make_text();
+
+        std::cout << "Text size: " << text.size() << '\n';
+        std::cout << "Count of \"fox\": " << strpy::par::count(text, "fox", 4) << '\n';
+        std::cout << "Position of \"The end\": " << strpy::par::find(text, "The end", 4) << '\n';
+    }
+
+    void example2()
+    {
+        const auto text = make_text();
+        const auto executor = strpy::par::make_thread_executor();
+
+        std::cout << "Count of \"dog. The\": " << strpy::par::count(text, "dog. The", executor) << '\n';
+
+        if (const auto result = strpy::par::find(text, "cat", executor); result != std::string::npos) {
+            std::cout << "Found \"cat\" at position: " << result << '\n';
+        }
+        else {
+            std::cout << "Substring \"cat\" not found" << '\n';
+        }
+    }
+
+    void example3()
+    {
+        std::string log{};
+
+        for (int i = 0; i < 50000; ++i) {
+            log += "GET /index.html 200\nPOST /login 302\r\n";
+        }
+
+        const auto shards = strpy::par::split_lines(log, false, 4);
+        std::size_t lines = 0;
+
+        for (const auto& shard : shards) {
+            lines += shard.size();
+        }
+
+        std::cout << "Lines: " << lines << '\n';
+        std::cout << "Last line: " << shards.back().back() << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (par::count and par::find with a thread count)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (par::count and par::find with an executor)" << '\n';
+    example2();
+    std::cout << '\n';
+
+    std::cout << "Example 3 (par::split_lines)" << '\n';
+    example3();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (par::count and par::find with a thread count)
+// Text size: 4500008
+// Count of "fox": 100000
+// Position of "The end": 4500000
+//
+// Example 2 (par::count and par::find with an executor)
+// Count of "dog. The": 100000
+// Substring "cat" not found
+//
+// Example 3 (par::split_lines)
+// Lines: 100000
+// Last line: POST /login 302
@@ -5,6 +5,7 @@
 
 #include "stringpy/replace.hpp"
 #include <iostream>
+#include <string>
 
 namespace
 {
@@ -35,6 +36,34 @@ namespace
         std::cout << "Count: " << count << '\n';
         std::cout << "Replaced: " << result << '\n';
     }
+
+    void example3()
+    {
+        constexpr std::string_view str{"2023-06-15"};
+        constexpr auto old_value = '-';
+        constexpr std::string_view new_value{".."};
+        const auto& result = strpy::replace(str, old_value, new_value);
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Old value: " << old_value << '\n';
+        std::cout << "New value: " << new_value << '\n';
+        std::cout << "Replaced: " << result << '\n';
+    }
+
+    void example4()
+    {
+        std::string str{"one--two--three"};
+        constexpr std::string_view old_value{"--"};
+        constexpr std::string_view new_value{";"};
+
+        std::cout << "String: " << str << '\n';
+        const auto count = strpy::replace_inplace(str, old_value, new_value);
+
+        std::cout << "Old value: " << old_value << '\n';
+        std::cout << "New value: " << new_value << '\n';
+        std::cout << "Replacements: " << count << '\n';
+        std::cout << "Replaced: " << str << '\n';
+    }
 }
 
 int main()
@@ -45,6 +74,14 @@ int main()
 
     std::cout << "Example 2 (replace_icase)" << '\n';
     example2();
+    std::cout << '\n';
+
+    std::cout << "Example 3 (replace a character)" << '\n';
+    example3();
+    std::cout << '\n';
+
+    std::cout << "Example 4 (replace_inplace)" << '\n';
+    example4();
 
     return 0;
 }
@@ -63,3 +100,16 @@ int main()
 // New value: dog
 // Count: 1
 // Replaced: I have a dog. My cat is black.
+//
+// Example 3 (replace a character)
+// String: 2023-06-15
+// Old value: -
+// New value: ..
+// Replaced: 2023..06..15
+//
+// Example 4 (replace_inplace)
+// String: one--two--three
+// Old value: --
+// New value: ;
+// Replacements: 2
+// Replaced: one;two;three
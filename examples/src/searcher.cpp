@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/searcher.hpp"
+#include <iostream>
+
+namespace
+{
+    void example1()
+    {
+        constexpr std::string_view str1{"GET /index.html HTTP/1.1"};
+        constexpr std::string_view str2{"POST /api/v1/users HTTP/1.1"};
+        const auto searcher = strpy::make_searcher("HTTP/1.1");
+
+        std::cout << "Needle: " << searcher.needle() << '\n';
+        std::cout << "Position in \"" << str1 << "\": " << searcher.find(str1) << '\n';
+        std::cout << "Position in \"" << str2 << "\": " << searcher.find(str2) << '\n';
+    }
+
+    void example2()
+    {
+        constexpr std::string_view str{"Error: disk full; error: retry failed; ERROR: giving up"};
+        const auto searcher = strpy::make_searcher_icase("error");
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Count: " << searcher.count(str) << '\n';
+        std::cout << "Last: " << searcher.rfind(str) << '\n';
+        std::cout << "Replaced: " << searcher.replace(str, "E") << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (make_searcher)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (make_searcher_icase)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (make_searcher)
+// Needle: HTTP/1.1
+// Position in "GET /index.html HTTP/1.1": 16
+// Position in "POST /api/v1/users HTTP/1.1": 19
+//
+// Example 2 (make_searcher_icase)
+// String: Error: disk full; error: retry failed; ERROR: giving up
+// Count: 3
+// Last: 39
+// Replaced: E: disk full; E: retry failed; E: giving up
@@ -101,6 +101,52 @@ namespace
         print_container(result);
         std::cout << '\n';
     }
+
+    void example5()
+    {
+        constexpr std::string_view str{"key=value;;flag"};
+        constexpr auto delimiter = ';';
+        const auto& result = strpy::split(str, delimiter);
+
+        std::cout << "String: \"" << str << "\"" << '\n';
+        std::cout << "Delimiter: '" << delimiter << "'" << '\n';
+        std::cout << "Result: ";
+        print_container(result);
+        std::cout << '\n';
+    }
+
+    void example6()
+    {
+        constexpr std::string_view str{"id\t name \t\tcity"};
+        constexpr auto delimiter = '\t';
+        const auto& result = strpy::split<std::string_view>(str, delimiter, strpy::StringSplitOptions::trim);
+
+        std::cout << "String: \"";
+        print_string_with_control_chars(str);
+        std::cout << "\"" << '\n';
+
+        std::cout << "Delimiter: '";
+        print_string_with_control_chars({&delimiter, 1});
+        std::cout << "'" << '\n';
+        std::cout << "Options: trim" << '\n';
+        std::cout << "Result: ";
+        print_container(result);
+        std::cout << '\n';
+    }
+
+    void example7()
+    {
+        constexpr std::string_view records[] = {"1,apple,red", "2,banana,yellow", "3,cherry,dark red"};
+        std::vector<std::string> fields{};
+
+        for (const auto record : records) {
+            strpy::split_into(fields, record, ',');
+
+            std::cout << "Record: \"" << record << "\", fields: ";
+            print_container(fields);
+            std::cout << '\n';
+        }
+    }
 }
 
 int main()
@@ -119,6 +165,18 @@ int main()
 
     std::cout << "Example 4 (rsplit with delimiter)" << '\n';
     example4();
+    std::cout << '\n';
+
+    std::cout << "Example 5 (split with delimiter character)" << '\n';
+    example5();
+    std::cout << '\n';
+
+    std::cout << "Example 6 (split into views of the string)" << '\n';
+    example6();
+    std::cout << '\n';
+
+    std::cout << "Example 7 (split into a reused vector)" << '\n';
+    example7();
 
     return 0;
 }
@@ -128,7 +186,7 @@ int main()
 // Example 1 (split)
 // String: apple\t\r\nbanana cherry
 // Max split: 1
-// Result: ["apple", "\r\nbanana cherry"]
+// Result: ["apple", "banana cherry"]
 //
 // Example 2 (split with delimiter)
 // String: "apple,banana,cherry"
@@ -145,3 +203,19 @@ int main()
 // Delimiter: ","
 // Max split: 1
 // Result: ["apple,banana", "cherry"]
+//
+// Example 5 (split with delimiter character)
+// String: "key=value;;flag"
+// Delimiter: ';'
+// Result: ["key=value", "", "flag"]
+//
+// Example 6 (split into views of the string)
+// String: "id\t name \t\tcity"
+// Delimiter: '\t'
+// Options: trim
+// Result: ["id", "name", "", "city"]
+//
+// Example 7 (split into a reused vector)
+// Record: "1,apple,red", fields: ["1", "apple", "red"]
+// Record: "2,banana,yellow", fields: ["2", "banana", "yellow"]
+// Record: "3,cherry,dark red", fields: ["3", "cherry", "dark red"]
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/splitresult.hpp"
+#include "stringpy/split.hpp"
+#include "stringpy/splitlines.hpp"
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    void example1()
+    {
+        constexpr std::string_view str{"2023-06-01,INFO,request served,42"};
+        const auto fields = strpy::split<strpy::SplitResult>(str, ',');
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Number of fields: " << fields.size() << '\n';
+        std::cout << "Buffer: " << fields.buffer() << '\n';
+        std::cout << "Third field: " << fields[2] << '\n';
+    }
+
+    void example2()
+    {
+        constexpr std::string_view text{"alice 30 paris\nbob 25 rome\ncarol 41 oslo"};
+        std::vector<strpy::SplitResult> rows{};
+
+        for (const auto line : strpy::split_lines<std::string_view>(text)) {
+            rows.push_back(strpy::split<strpy::SplitResult>(line));
+        }
+
+        for (const auto& row : rows) {
+            for (const auto token : row) {
+                std::cout << '[' << token << ']';
+            }
+
+            std::cout << '\n';
+        }
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (split into a SplitResult)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (keep many split rows)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (split into a SplitResult)
+// String: 2023-06-01,INFO,request served,42
+// Number of fields: 4
+// Buffer: 2023-06-01INFOrequest served42
+// Third field: request served
+//
+// Example 2 (keep many split rows)
+// [alice][30][paris]
+// [bob][25][rome]
+// [carol][41][oslo]
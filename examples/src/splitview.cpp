@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/splitview.hpp"
+#include <iostream>
+
+namespace
+{
+    void example1()
+    {
+        constexpr std::string_view str{"2023-06-01;INFO; request served ;42ms"};
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Fields:";
+
+        for (const auto field : strpy::split_view(str, ';', strpy::StringSplitOptions::trim)) {
+            std::cout << " [" << field << "]";
+        }
+
+        std::cout << '\n';
+    }
+
+    void example2()
+    {
+        constexpr std::string_view str{"/usr/local/lib/libstringpy.so"};
+        const auto last = *strpy::rsplit_view(str, "/", 1).begin();
+
+        std::cout << "String: " << str << '\n';
+        std::cout << "Last component: " << last << '\n';
+    }
+
+    void example3()
+    {
+        constexpr std::string_view str{"first line\r\nsecond line\nthird line"};
+        std::size_t number = 0;
+
+        for (const auto line : strpy::lines_view(str)) {
+            std::cout << ++number << ": " << line << '\n';
+        }
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (split_view)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (rsplit_view)" << '\n';
+    example2();
+    std::cout << '\n';
+
+    std::cout << "Example 3 (lines_view)" << '\n';
+    example3();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (split_view)
+// String: 2023-06-01;INFO; request served ;42ms
+// Fields: [2023-06-01] [INFO] [request served] [42ms]
+//
+// Example 2 (rsplit_view)
+// String: /usr/local/lib/libstringpy.so
+// Last component: libstringpy.so
+//
+// Example 3 (lines_view)
+// 1: first line
+// 2: second line
+// 3: third line
@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/tochars.hpp"
+#include <array>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+    void example1()
+    {
+        std::array<char, strpy::TO_CHARS_MAX_SIZE> buffer{};
+
+        for (const double value : {100.0, 0.1, 1.0 / 3.0, 0.00001, 6.02214076e23}) {
+            const auto* const end = strpy::to_chars(buffer.data(), value);
+            std::cout << std::string_view(buffer.data(), static_cast<std::size_t>(end - buffer.data())) << '\n';
+        }
+    }
+
+    void example2()
+    {
+        constexpr std::string_view name{"requests_total"};
+        constexpr auto count = -1234567LL;
+        std::array<char, strpy::TO_CHARS_MAX_SIZE> buffer{};
+
+        // Neither the locale nor memory allocation is involved
+        const auto* const end = strpy::to_chars(buffer.data(), count);
+        std::cout << name << ' ' << std::string_view(buffer.data(), static_cast<std::size_t>(end - buffer.data()))
+                  << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "Example 1 (to_chars with floating-point numbers)" << '\n';
+    example1();
+    std::cout << '\n';
+
+    std::cout << "Example 2 (to_chars with integers)" << '\n';
+    example2();
+
+    return 0;
+}
+
+// Program output:
+//
+// Example 1 (to_chars with floating-point numbers)
+// 100
+// 0.1
+// 0.3333333333333333
+// 1e-05
+// 6.02214076e+23
+//
+// Example 2 (to_chars with integers)
+// requests_total -1234567
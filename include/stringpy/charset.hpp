@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a set of characters for the functions that search for or remove any of several characters.
+ *
+ * @example charset.cpp
+ * Demonstrates the use of the CharSet class and the make_charset_icase() function from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/const.hpp"
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace strpy
+{
+    /**
+     * @brief A set of characters stored as a 256-bit bitmap.
+     *
+     * Checking whether a character belongs to the set is a single bit test, regardless of the number
+     * of characters in the set. The functions that accept a set (\ref strpy::find_first_of,
+     * \ref strpy::strip, \ref strpy::split and others) classify the bytes of the string with
+     * a SIMD nibble lookup when it is available. The set also keeps its bitmap in the row layout
+     * of the lookup, so a call on a short string does not pay for building the lookup tables.
+     *
+     * A set can be built at compile time from a string literal:
+     * @code
+     * constexpr strpy::CharSet VOWELS{"aeiouAEIOU"};
+     * @endcode
+     */
+    class CharSet
+    {
+    public:
+        /** @brief Number of 64-bit words in the bitmap. */
+        static constexpr std::size_t WORD_COUNT = 4;
+
+        /** @brief Type of the bitmap. */
+        using Words = std::array<std::uint64_t, WORD_COUNT>;
+
+        /** @brief Number of rows of the bitmap rearranged for the nibble lookup, one per low nibble of a byte. */
+        static constexpr std::size_t ROW_COUNT = 16;
+
+        /** @brief Type of the rows of the bitmap rearranged for the nibble lookup. */
+        using Rows = std::array<std::uint8_t, ROW_COUNT>;
+
+        /**
+         * @brief Constructs an empty set.
+         */
+        constexpr CharSet() noexcept = default;
+
+        /**
+         * @brief Constructs a set containing the given characters.
+         *
+         * @param chars The characters of the set.
+         */
+        constexpr explicit CharSet(const std::string_view chars) noexcept
+        {
+            for (const auto ch : chars) {
+                insert(ch);
+            }
+        }
+
+        /**
+         * @brief Adds a character to the set.
+         *
+         * @param ch The character to add.
+         *
+         * @return A reference to this set.
+         */
+        constexpr CharSet& insert(const char ch) noexcept
+        {
+            const auto byte = static_cast<unsigned char>(ch);
+            const auto high = static_cast<unsigned>(byte / ROW_COUNT);
+            auto& rows = (high < ROW_BITS) ? low_rows_ : high_rows_;
+
+            words_[byte / WORD_BITS] |= std::uint64_t{1} << (byte % WORD_BITS);
+            rows[byte % ROW_COUNT] |= static_cast<std::uint8_t>(1U << (high % ROW_BITS));
+
+            return *this;
+        }
+
+        /**
+         * @brief Checks whether the set contains a character.
+         *
+         * @param ch The character to check.
+         *
+         * @return \c true if \p ch belongs to the set, \c false otherwise.
+         */
+        [[nodiscard]] constexpr bool contains(const char ch) const noexcept
+        {
+            const auto byte = static_cast<unsigned char>(ch);
+            return ((words_[byte / WORD_BITS] >> (byte % WORD_BITS)) & 1U) != 0;
+        }
+
+        /**
+         * @brief Checks whether the set is empty.
+         *
+         * @return \c true if the set contains no characters, \c false otherwise.
+         */
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return (words_[0] | words_[1] | words_[2] | words_[3]) == 0;
+        }
+
+        /**
+         * @brief Returns the bitmap of the set.
+         *
+         * Bit \c n of the bitmap (bit <tt>n % 64</tt> of word <tt>n / 64</tt>) is set
+         * if the byte with the value \c n belongs to the set.
+         *
+         * @return The bitmap.
+         */
+        [[nodiscard]] constexpr const Words& words() const noexcept
+        {
+            return words_;
+        }
+
+        /**
+         * @brief Returns the rows of the bytes from 0 to 127, rearranged for the nibble lookup.
+         *
+         * Bit \c h of row \c n is set if the byte <tt>(h << 4) | n</tt> belongs to the set. The rows are kept
+         * up to date by \ref insert, so the vectorized functions do not rebuild them on every call.
+         *
+         * @return The rows of the lower half of the bytes.
+         */
+        [[nodiscard]] constexpr const Rows& low_rows() const noexcept
+        {
+            return low_rows_;
+        }
+
+        /**
+         * @brief Returns the rows of the bytes from 128 to 255, rearranged for the nibble lookup.
+         *
+         * Bit \c h of row \c n is set if the byte <tt>((h + 8) << 4) | n</tt> belongs to the set.
+         *
+         * @return The rows of the upper half of the bytes.
+         */
+        [[nodiscard]] constexpr const Rows& high_rows() const noexcept
+        {
+            return high_rows_;
+        }
+
+        /**
+         * @brief Checks whether two sets contain the same characters.
+         *
+         * @param lhs The first set.
+         * @param rhs The second set.
+         *
+         * @return \c true if the sets are equal, \c false otherwise.
+         */
+        [[nodiscard]] friend constexpr bool operator==(const CharSet& lhs, const CharSet& rhs) noexcept
+        {
+            return (lhs.words_[0] == rhs.words_[0]) && (lhs.words_[1] == rhs.words_[1]) &&
+                   (lhs.words_[2] == rhs.words_[2]) && (lhs.words_[3] == rhs.words_[3]);
+        }
+
+        /**
+         * @brief Checks whether two sets contain different characters.
+         *
+         * @param lhs The first set.
+         * @param rhs The second set.
+         *
+         * @return \c true if the sets are not equal, \c false otherwise.
+         */
+        [[nodiscard]] friend constexpr bool operator!=(const CharSet& lhs, const CharSet& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        static constexpr unsigned WORD_BITS = 64;
+        static constexpr unsigned ROW_BITS = 8;
+
+        Words words_{};
+        Rows low_rows_{};
+        Rows high_rows_{};
+    };
+
+    /** @brief Set of all space characters. */
+    constexpr CharSet SPACE_SET{SPACE_CHARS};
+
+    /**
+     * @brief Creates a set of characters, ignoring case.
+     *
+     * The set contains every character that compares equal to one of \p chars
+     * according to \ref strpy::equal_char_icase, using the case mapping of the current C locale
+     * at the time of the call.
+     *
+     * @param chars The characters of the set.
+     *
+     * @return The case-insensitive set.
+     */
+    [[nodiscard]] STRINGPY_EXPORT CharSet make_charset_icase(std::string_view chars) noexcept;
+}
@@ -37,6 +37,25 @@ namespace strpy
     [[nodiscard]] STRINGPY_EXPORT std::size_t count(std::string_view str, std::string_view sub, std::size_t start = 0,
                                                     std::size_t end = std::string_view::npos) noexcept;
 
+    /**
+     * @brief Counts the number of occurrences of a character within a string.
+     *
+     * Returns the number of occurrences of the character within the string,
+     * starting at position \p start and ending at position \p end.
+     * The bytes are compared 16 or 32 at a time, depending on \ref strpy::simd_level.
+     *
+     * @param str The string to search within.
+     * @param ch The character to search for.
+     * @param start The starting position for the search (optional).
+     * @param end The ending position for the search (optional).
+     *
+     * @return The number of occurrences of the character.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_count.asp
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t count(std::string_view str, char ch, std::size_t start = 0,
+                                                    std::size_t end = std::string_view::npos) noexcept;
+
     /**
      * @brief Counts the number of non-overlapping occurrences of a substring within a string, ignoring case.
      *
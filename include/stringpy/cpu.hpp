@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides control over the instruction sets used by the vectorized kernels of the library.
+ *
+ * @example cpu.cpp
+ * Demonstrates the use of the simd_level() and set_simd_level() functions from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+
+namespace strpy
+{
+    /**
+     * @brief A set of instructions the kernels of the library can be run with.
+     *
+     * The library is built once for the baseline target of the compiler, while each kernel also contains
+     * the implementations of the higher tiers. The implementation is selected on every call
+     * according to the active level, so the functions of the library give the same results at every level.
+     */
+    enum class SimdLevel : unsigned
+    {
+        /** @brief Plain C++ code. */
+        scalar = 0U,
+
+        /** @brief SSE2, SSSE3, SSE4.1, SSE4.2 and POPCNT, 16 bytes at a time. */
+        sse42 = 1U,
+
+        /** @brief AVX2, 32 bytes at a time. */
+        avx2 = 2U
+    };
+
+    /**
+     * @brief Returns the highest level supported by the processor and the operating system.
+     *
+     * The level is detected with the \c cpuid instruction. It is always \ref SimdLevel::scalar
+     * on processors other than x86.
+     *
+     * @return The highest supported level.
+     */
+    [[nodiscard]] STRINGPY_EXPORT SimdLevel supported_simd_level() noexcept;
+
+    /**
+     * @brief Returns the level used by the kernels.
+     *
+     * The level is the supported one, unless the \c STRINGPY_SIMD_LEVEL environment variable
+     * is set to the name of a lower level (see \ref strpy::simd_level_name) when the level is first used,
+     * or it was changed by \ref strpy::set_simd_level.
+     *
+     * @return The active level.
+     */
+    [[nodiscard]] STRINGPY_EXPORT SimdLevel simd_level() noexcept;
+
+    /**
+     * @brief Sets the level used by the kernels.
+     *
+     * Levels above the supported one are lowered to it. The change affects all threads,
+     * the calls that already run complete with the previous level.
+     *
+     * @param level The requested level.
+     *
+     * @return The level that is now active.
+     */
+    STRINGPY_EXPORT SimdLevel set_simd_level(SimdLevel level) noexcept;
+
+    /**
+     * @brief Returns the name of a level.
+     *
+     * The names are the ones accepted by the \c STRINGPY_SIMD_LEVEL environment variable:
+     * \c "scalar", \c "sse42" and \c "avx2".
+     *
+     * @param level The level.
+     *
+     * @return The name of the level.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::string_view simd_level_name(SimdLevel level) noexcept;
+}
@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides functions and classes for splitting delimiter-separated records such as CSV and TSV.
+ *
+ * @example csv.cpp
+ * Demonstrates the use of the split_csv() function and the CsvReader class from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace strpy
+{
+    /**
+     * @brief The fields of a record of delimiter-separated values.
+     *
+     * The fields are \c std::string_view objects. A field without escaped quotes points into the parsed input,
+     * a field that has to be unescaped points into a buffer of the record. A record that crosses the end
+     * of a chunk owns its copy of the input, so its fields point into the record only. The fields are invalidated
+     * when the parsed input is destroyed, and when the record is parsed again or destroyed.
+     */
+    class STRINGPY_EXPORT CsvRecord
+    {
+    public:
+        /** @brief The type of the fields. */
+        using value_type = std::string_view;
+
+        /** @brief The size type. */
+        using size_type = std::size_t;
+
+        /** @brief A random access iterator over the fields. */
+        using const_iterator = std::vector<std::string_view>::const_iterator;
+
+        /**
+         * @brief Constructs a record without fields.
+         */
+        CsvRecord() noexcept = default;
+
+        /**
+         * @brief Constructs a copy of a record, the unescaped fields point into the buffer of the copy.
+         *
+         * @param other The record to copy.
+         */
+        CsvRecord(const CsvRecord& other) noexcept;
+
+        /**
+         * @brief Constructs a record by moving the fields of another one.
+         *
+         * @param other The record to move.
+         */
+        CsvRecord(CsvRecord&& other) noexcept = default;
+
+        /**
+         * @brief Destroys the record.
+         */
+        ~CsvRecord() noexcept = default;
+
+        /**
+         * @brief Replaces the fields with a copy of the fields of another record.
+         *
+         * @param other The record to copy.
+         *
+         * @return A reference to this record.
+         */
+        CsvRecord& operator=(const CsvRecord& other) noexcept;
+
+        /**
+         * @brief Replaces the fields with the fields of another record.
+         *
+         * @param other The record to move.
+         *
+         * @return A reference to this record.
+         */
+        CsvRecord& operator=(CsvRecord&& other) noexcept = default;
+
+        /**
+         * @brief Returns the number of fields.
+         *
+         * @return The number of fields, zero for an empty line.
+         */
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return fields_.size();
+        }
+
+        /**
+         * @brief Checks whether the record has no fields.
+         *
+         * @return \c true if the record has no fields, \c false otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return fields_.empty();
+        }
+
+        /**
+         * @brief Returns a field.
+         *
+         * @param index The index of the field. Must be less than \ref size.
+         *
+         * @return A view of the unquoted and unescaped field.
+         */
+        [[nodiscard]] std::string_view operator[](const size_type index) const noexcept
+        {
+            return fields_[index];
+        }
+
+        /**
+         * @brief Returns an iterator to the first field.
+         *
+         * @return An iterator to the first field.
+         */
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return fields_.cbegin();
+        }
+
+        /**
+         * @brief Returns the past-the-end iterator.
+         *
+         * @return The past-the-end iterator.
+         */
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return fields_.cend();
+        }
+
+    private:
+        friend class CsvReader;
+
+        /** @brief Points the fields that lie in the buffers of another record into the buffers of this one. */
+        void rebase(const CsvRecord& other) noexcept;
+
+        /** @brief Unquotes and unescapes the fields added as they appear in a record of the given size. */
+        void unquote(size_type record_size, char quote) noexcept;
+
+        std::vector<std::string_view> fields_{};
+        std::vector<char> buffer_{};
+        std::vector<char> source_{};
+    };
+
+    /**
+     * @brief Reads the records of delimiter-separated values, such as CSV and TSV, following RFC 4180.
+     *
+     * Fields are separated by a delimiter character and records by a line feed or CR LF. A field may be
+     * enclosed in quote characters, then it may contain delimiters and line breaks, and a quote character
+     * within it is written twice. A quote character toggles the quoted state wherever it appears,
+     * an empty line is a record without fields.
+     *
+     * The input is classified 32 bytes at a time into bitmasks of quote characters, delimiters and line feeds.
+     * A prefix XOR of the quote mask gives the bytes that are within quotes, the remaining delimiters and
+     * line feeds are the field boundaries and are found with bit scans. The fields are views into the input
+     * and only the fields that contain escaped quotes are copied.
+     *
+     * The input can be given at once, such as the contents of a memory-mapped file, or in consecutive chunks.
+     * A record that crosses the end of a chunk is copied into a buffer of the reader and completed
+     * with the next chunk, then the buffer is handed over to the record. The other records are never copied.
+     */
+    class STRINGPY_EXPORT CsvReader
+    {
+    public:
+        /**
+         * @brief Constructs a reader of chunked input, the chunks are given by \ref feed.
+         *
+         * @param delimiter The field delimiter (optional).
+         * @param quote The quote character (optional).
+         */
+        explicit CsvReader(const char delimiter = ',', const char quote = '"') noexcept :
+            delimiter_(delimiter), quote_(quote)
+        {
+        }
+
+        /**
+         * @brief Constructs a reader of the whole input.
+         *
+         * @param data The input. Must outlive the reader and the records read from it.
+         * @param delimiter The field delimiter (optional).
+         * @param quote The quote character (optional).
+         */
+        explicit CsvReader(const std::string_view data, const char delimiter = ',', const char quote = '"') noexcept :
+            chunk_(data), delimiter_(delimiter), quote_(quote), last_(true)
+        {
+        }
+
+        /**
+         * @brief Gives the next chunk of the input.
+         *
+         * Must be called after \ref next returned \c false for the previous chunk.
+         * A record without a line break at the end of the last chunk is read as well.
+         *
+         * @param chunk The next chunk. Must outlive the records read from it.
+         * @param last Whether the chunk is the last one (optional). The end of the input
+         * can also be given by an empty last chunk.
+         */
+        void feed(const std::string_view chunk, const bool last = false) noexcept
+        {
+            chunk_ = chunk;
+            pos_ = 0;
+            last_ = last;
+        }
+
+        /**
+         * @brief Reads the next record.
+         *
+         * @param record The record to fill, its previous fields are invalidated.
+         *
+         * @return \c true if a record was read, \c false if the chunk holds no more complete records.
+         */
+        [[nodiscard]] bool next(CsvRecord& record) noexcept;
+
+    private:
+        /** @brief Completes the record that crosses the end of the previous chunk. */
+        [[nodiscard]] bool next_carried(CsvRecord& record) noexcept;
+
+        /**
+         * @brief Adds the fields of the record at the start of the data, as they appear in it, to a record.
+         *
+         * Returns the position of the line feed that ends the record. If the data ends first, the rest of
+         * the data is the last field, \c std::string_view::npos is returned and the quoted state
+         * at the end of the data is kept.
+         */
+        std::size_t read_fields(std::string_view data, bool quoted, CsvRecord& record) noexcept;
+
+        std::string_view chunk_{};
+        std::size_t pos_ = 0;
+        std::vector<char> carry_{};
+        char delimiter_;
+        char quote_;
+        bool carry_quoted_ = false;
+        bool last_ = false;
+    };
+
+    /**
+     * @brief Splits a record of delimiter-separated values into fields, following RFC 4180.
+     *
+     * Only the first record of the string is split, a line break outside of quotes ends it.
+     * The fields are parsed the same way as by \ref strpy::CsvReader.
+     *
+     * @param record The record to split. Must outlive the returned record.
+     * @param delimiter The field delimiter (optional).
+     * @param quote The quote character (optional).
+     *
+     * @return The fields of the record.
+     *
+     * @sa https://www.rfc-editor.org/rfc/rfc4180
+     */
+    [[nodiscard]] STRINGPY_EXPORT CsvRecord split_csv(std::string_view record, char delimiter = ',',
+                                                      char quote = '"') noexcept;
+}
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include "stringpy/charset.hpp"
 #include "stringpy/export.hpp"
 #include <string_view>
 #include <cstddef>
@@ -116,6 +117,26 @@ namespace strpy
                                                             std::size_t start = 0,
                                                             std::size_t end = std::string_view::npos) noexcept;
 
+    /**
+     * @brief Finds the first occurrence of any character from a set of characters within a string.
+     *
+     * Returns the position of the first character of the string that belongs to the set,
+     * starting at position \p start and ending at position \p end.
+     * This is an overloaded function that accepts a precompiled \ref strpy::CharSet,
+     * use \ref strpy::make_charset_icase to ignore case.
+     *
+     * @param str The string to search within.
+     * @param chars The set of characters to search for.
+     * @param start The starting position for the search (optional).
+     * @param end The ending position for the search (optional).
+     *
+     * @return The position of the first occurrence of any character from chars within str,
+     * or \c std::string_view::npos if no such character is found.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t find_first_of(std::string_view str, const CharSet& chars,
+                                                            std::size_t start = 0,
+                                                            std::size_t end = std::string_view::npos) noexcept;
+
     /**
      * @brief Finds the first occurrence of any character from a set of characters within a string, ignoring case.
      *
@@ -154,6 +175,26 @@ namespace strpy
                                                                 std::size_t start = 0,
                                                                 std::size_t end = std::string_view::npos) noexcept;
 
+    /**
+     * @brief Finds the first occurrence of a character not in a set of characters within a string.
+     *
+     * Returns the position of the first character of the string that does not belong to the set,
+     * starting at position \p start and ending at position \p end.
+     * This is an overloaded function that accepts a precompiled \ref strpy::CharSet,
+     * use \ref strpy::make_charset_icase to ignore case.
+     *
+     * @param str The string to search within.
+     * @param chars The set of characters to exclude from the search.
+     * @param start The starting position for the search (optional).
+     * @param end The ending position for the search (optional).
+     *
+     * @return The position of the first occurrence of a character not in chars within str,
+     * or \c std::string_view::npos if no such character is found.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t find_first_not_of(std::string_view str, const CharSet& chars,
+                                                                std::size_t start = 0,
+                                                                std::size_t end = std::string_view::npos) noexcept;
+
     /**
      * @brief Finds the first occurrence of a character not in a set of characters within a string, ignoring case.
      *
@@ -192,6 +233,26 @@ namespace strpy
                                                            std::size_t start = 0,
                                                            std::size_t end = std::string_view::npos) noexcept;
 
+    /**
+     * @brief Finds the last occurrence of any character from a set of characters within a string.
+     *
+     * Returns the position of the last character of the string that belongs to the set,
+     * starting at position \p start and ending at position \p end.
+     * This is an overloaded function that accepts a precompiled \ref strpy::CharSet,
+     * use \ref strpy::make_charset_icase to ignore case.
+     *
+     * @param str The string to search within.
+     * @param chars The set of characters to search for.
+     * @param start The starting position for the search (optional).
+     * @param end The ending position for the search (optional).
+     *
+     * @return The position of the last occurrence of any character from chars within str,
+     * or \c std::string_view::npos if no such character is found.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t find_last_of(std::string_view str, const CharSet& chars,
+                                                           std::size_t start = 0,
+                                                           std::size_t end = std::string_view::npos) noexcept;
+
     /**
      * @brief Finds the last occurrence of any character from a set of characters within a string, ignoring case.
      *
@@ -230,6 +291,26 @@ namespace strpy
                                                                std::size_t start = 0,
                                                                std::size_t end = std::string_view::npos) noexcept;
 
+    /**
+     * @brief Finds the last occurrence of a character not in a set of characters within a string.
+     *
+     * Returns the position of the last character of the string that does not belong to the set,
+     * starting at position \p start and ending at position \p end.
+     * This is an overloaded function that accepts a precompiled \ref strpy::CharSet,
+     * use \ref strpy::make_charset_icase to ignore case.
+     *
+     * @param str The string to search within.
+     * @param chars The set of characters to exclude from the search.
+     * @param start The starting position for the search (optional).
+     * @param end The ending position for the search (optional).
+     *
+     * @return The position of the last occurrence of a character not in chars within str,
+     * or \c std::string_view::npos if no such character is found.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t find_last_not_of(std::string_view str, const CharSet& chars,
+                                                               std::size_t start = 0,
+                                                               std::size_t end = std::string_view::npos) noexcept;
+
     /**
      * @brief Finds the last occurrence of a character not in a set of characters within a string, ignoring case.
      *
@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides lazy ranges over all occurrences of a substring within a string.
+ *
+ * @example findall.cpp
+ * Demonstrates the use of the find_all() and find_all_icase() functions from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <cstddef>
+#include <iterator>
+
+namespace strpy
+{
+    /**
+     * @brief A forward iterator over the positions of the occurrences of a substring.
+     *
+     * The iterator keeps the position of the current occurrence and resumes the search right after it,
+     * so stepping through the occurrences never validates or copies the input and never allocates.
+     * The iterator refers to the searched strings and must not outlive them.
+     */
+    class STRINGPY_EXPORT FindAllIterator
+    {
+    public:
+        /** @brief The iterator category. */
+        using iterator_category = std::forward_iterator_tag;
+
+        /** @brief The type of the values the iterator points to. */
+        using value_type = std::size_t;
+
+        /** @brief The type of the distance between two iterators. */
+        using difference_type = std::ptrdiff_t;
+
+        /** @brief The pointer type. */
+        using pointer = const std::size_t*;
+
+        /** @brief The reference type. */
+        using reference = const std::size_t&;
+
+        /**
+         * @brief Constructs a past-the-end iterator.
+         */
+        FindAllIterator() noexcept = default;
+
+        /**
+         * @brief Returns the position of the current occurrence.
+         *
+         * @return The index of the occurrence within the searched string.
+         */
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            return pos_;
+        }
+
+        /**
+         * @brief Returns a pointer to the position of the current occurrence.
+         *
+         * @return A pointer to the index of the occurrence within the searched string.
+         */
+        [[nodiscard]] pointer operator->() const noexcept
+        {
+            return &pos_;
+        }
+
+        /**
+         * @brief Advances the iterator to the next occurrence.
+         *
+         * @return A reference to this iterator.
+         */
+        FindAllIterator& operator++() noexcept;
+
+        /**
+         * @brief Advances the iterator to the next occurrence.
+         *
+         * @return A copy of the iterator before it was advanced.
+         */
+        FindAllIterator operator++(int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        /**
+         * @brief Checks whether two iterators point to the same occurrence.
+         *
+         * @param lhs The first iterator.
+         * @param rhs The second iterator.
+         *
+         * @return \c true if the iterators are equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator==(const FindAllIterator& lhs, const FindAllIterator& rhs) noexcept
+        {
+            return lhs.pos_ == rhs.pos_;
+        }
+
+        /**
+         * @brief Checks whether two iterators point to different occurrences.
+         *
+         * @param lhs The first iterator.
+         * @param rhs The second iterator.
+         *
+         * @return \c true if the iterators are not equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator!=(const FindAllIterator& lhs, const FindAllIterator& rhs) noexcept
+        {
+            return lhs.pos_ != rhs.pos_;
+        }
+
+    private:
+        friend class FindAllRange;
+
+        FindAllIterator(std::string_view str, std::string_view sub, bool icase, bool overlapping) noexcept;
+
+        /** @brief Finds the first occurrence starting at or after the given position. */
+        [[nodiscard]] std::size_t search(std::size_t pos) const noexcept;
+
+        std::string_view str_{};
+        std::string_view sub_{};
+        std::size_t pos_ = std::string_view::npos;
+        bool icase_ = false;
+        bool overlapping_ = false;
+    };
+
+    /**
+     * @brief A lazy forward range over the positions of the occurrences of a substring.
+     *
+     * Created by the \ref strpy::find_all and \ref strpy::find_all_icase functions.
+     * The occurrences are found one at a time while the range is iterated.
+     * The range refers to the searched strings and must not outlive them.
+     */
+    class STRINGPY_EXPORT FindAllRange
+    {
+    public:
+        /** @brief The iterator type. */
+        using iterator = FindAllIterator;
+
+        /** @brief The constant iterator type. */
+        using const_iterator = FindAllIterator;
+
+        /**
+         * @brief Constructs a range over the occurrences of a substring.
+         *
+         * @param str The string to search within.
+         * @param sub The substring to search for.
+         * @param icase Whether the case is ignored.
+         * @param overlapping Whether overlapping occurrences are included.
+         */
+        FindAllRange(std::string_view str, std::string_view sub, bool icase, bool overlapping) noexcept :
+            str_(str), sub_(sub), icase_(icase), overlapping_(overlapping)
+        {
+        }
+
+        /**
+         * @brief Returns an iterator to the first occurrence.
+         *
+         * @return An iterator to the first occurrence, or \ref end if there are no occurrences.
+         */
+        [[nodiscard]] FindAllIterator begin() const noexcept
+        {
+            return FindAllIterator{str_, sub_, icase_, overlapping_};
+        }
+
+        /**
+         * @brief Returns the past-the-end iterator.
+         *
+         * @return The past-the-end iterator.
+         */
+        [[nodiscard]] FindAllIterator end() const noexcept
+        {
+            return FindAllIterator{};
+        }
+
+        /**
+         * @brief Checks whether there are no occurrences.
+         *
+         * @return \c true if the substring does not occur within the string, \c false otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return begin() == end();
+        }
+
+    private:
+        std::string_view str_;
+        std::string_view sub_;
+        bool icase_;
+        bool overlapping_;
+    };
+
+    /**
+     * @brief Returns a lazy range over the positions of all occurrences of a substring within a string.
+     *
+     * In the non-overlapping mode the occurrences are the ones that \ref strpy::count counts.
+     * An empty substring occurs at every position from \c 0 to <tt>str.size()</tt> inclusive
+     * unless the string is empty.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     * @param overlapping Whether overlapping occurrences are included (optional).
+     *
+     * @return A forward range of the positions of the occurrences, in ascending order.
+     */
+    [[nodiscard]] inline FindAllRange find_all(const std::string_view str, const std::string_view sub,
+                                               const bool overlapping = false) noexcept
+    {
+        return FindAllRange{str, sub, false, overlapping};
+    }
+
+    /**
+     * @brief Returns a lazy range over the positions of all occurrences of a substring within a string,
+     * ignoring case.
+     *
+     * In the non-overlapping mode the occurrences are the ones that \ref strpy::count_icase counts.
+     * An empty substring occurs at every position from \c 0 to <tt>str.size()</tt> inclusive
+     * unless the string is empty.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     * @param overlapping Whether overlapping occurrences are included (optional).
+     *
+     * @return A forward range of the positions of the occurrences, in ascending order.
+     */
+    [[nodiscard]] inline FindAllRange find_all_icase(const std::string_view str, const std::string_view sub,
+                                                     const bool overlapping = false) noexcept
+    {
+        return FindAllRange{str, sub, true, overlapping};
+    }
+}
@@ -8,17 +8,25 @@
  * @brief Provides functions for formatting strings.
  *
  * @example format.cpp
- * Demonstrates the use of the format() and to_string() functions from the strpy namespace.
+ * Demonstrates the use of the format(), format_append() and to_string() functions and the STRPY_FMT macro
+ * from the strpy namespace.
  */
 
 #pragma once
 
 #include "stringpy/const.hpp"
 #include "stringpy/export.hpp"
-#include "stringpy/strip.hpp"
+#include "stringpy/tochars.hpp"
+#include <algorithm>
+#include <array>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
 #include <string_view>
 #include <type_traits>
+#include <cstddef>
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -135,7 +143,7 @@ namespace strpy::detail
      * @brief A constant that checks if a type can be converted to a string.
      *
      * This constant is \c true if the given type can be converted to a string
-     * using the \c std::to_string function, and \c false otherwise.
+     * using the \ref strpy::to_chars function, and \c false otherwise.
      *
      * @tparam T The type to check.
      * @private
@@ -144,11 +152,120 @@ namespace strpy::detail
     inline constexpr bool IS_TO_STRINGABLE = IsToStringable<T>::value;
 }
 
+namespace strpy
+{
+    /**
+     * @brief Formats the values of a type for \ref strpy::format, \ref strpy::join and \ref strpy::to_string.
+     *
+     * A specialization has a static \c format function that appends the characters of a value to a string:
+     *
+     * @code
+     * template <>
+     * struct strpy::formatter<Point>
+     * {
+     *     static void format(std::string& out, const Point& value)
+     *     {
+     *         strpy::format_append(out, "({}, {})", value.x, value.y);
+     *     }
+     * };
+     * @endcode
+     *
+     * The library provides specializations for \c std::string_view, \c std::optional, enumerations and ranges.
+     * Strings, characters, booleans and numbers are formatted by the library directly.
+     * A type that is only written by its stream operator opts in by deriving its specialization
+     * from \ref strpy::ostream_formatter.
+     *
+     * @tparam T The type of the values.
+     * @tparam Enable The type that partial specializations constrain with \c std::enable_if_t (optional).
+     */
+    template <typename T, typename Enable = void>
+    struct formatter
+    {
+    };
+
+    /**
+     * @brief A base of the \ref strpy::formatter specializations that format values by their stream operator.
+     *
+     * A \c std::ostringstream is created for every value, so a formatter that appends to the string directly
+     * is faster: <tt>template <> struct strpy::formatter<Point> : strpy::ostream_formatter {};</tt>
+     */
+    struct ostream_formatter
+    {
+        /**
+         * @brief Appends a value written by its stream operator.
+         *
+         * @tparam T The type of the value.
+         *
+         * @param out The string to append the value to.
+         * @param value The value to format.
+         */
+        template <typename T>
+        static void format(std::string& out, const T& value)
+        {
+            std::ostringstream stream{}; // NOLINT(misc-const-correctness)
+            stream << value;
+            out.append(stream.str());
+        }
+    };
+}
+
+namespace strpy::detail
+{
+    /** @private */
+    template <typename T, typename = void>
+    struct HasFormatter : std::false_type
+    {
+    };
+
+    /** @private */
+    template <typename T>
+    struct HasFormatter<
+      T, std::void_t<decltype(formatter<T>::format(std::declval<std::string&>(), std::declval<const T&>()))>>
+      : std::true_type
+    {
+    };
+
+    /** @private */
+    template <typename T, typename = void>
+    struct IsRange : std::false_type
+    {
+    };
+
+    /** @private */
+    template <typename T>
+    struct IsRange<T, std::void_t<decltype(std::begin(std::declval<const T&>())),
+                                  decltype(std::end(std::declval<const T&>()))>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief A constant that checks if a type has a \ref strpy::formatter specialization.
+     *
+     * @tparam T The type to check.
+     * @private
+     */
+    template <typename T>
+    inline constexpr bool HAS_FORMATTER = HasFormatter<T>::value;
+
+    /**
+     * @brief A constant that checks if a type is a range, whose elements are iterated by \c std::begin
+     * and \c std::end.
+     *
+     * @tparam T The type to check.
+     * @private
+     */
+    template <typename T>
+    inline constexpr bool IS_RANGE = IsRange<T>::value;
+}
+
 namespace strpy
 {
     /**
      * @brief Converts a value of type T to a string.
      *
+     * Numbers are converted by \ref strpy::to_chars, the types other than strings, characters and numbers
+     * are converted by their \ref strpy::formatter specialization.
+     *
      * @tparam T The type of the value to be converted.
      *
      * @param value The value to be converted.
@@ -171,17 +288,17 @@ namespace strpy
             return std::string{static_cast<CharType>(value)};
         }
         else if constexpr (detail::IS_TO_STRINGABLE<DecayedType>) {
-            if constexpr (std::is_floating_point_v<DecayedType>) {
-                return rstrip<std::string>(std::to_string(std::forward<T>(value)), ".0");
-            }
-            else {
-                return std::to_string(std::forward<T>(value));
-            }
+            std::array<CharType, TO_CHARS_MAX_SIZE> buffer{};
+            return std::string{buffer.data(), to_chars(buffer.data(), value)};
         }
         else {
-            std::ostringstream stream{}; // NOLINT(misc-const-correctness)
-            stream << std::forward<T>(value);
-            return stream.str();
+            static_assert(detail::HAS_FORMATTER<DecayedType>,
+                          "The type has no strpy::formatter specialization, derive one from strpy::ostream_formatter "
+                          "to format the type with its stream operator");
+
+            std::string result{};
+            formatter<DecayedType>::format(result, value);
+            return result;
         }
     }
 
@@ -258,11 +375,486 @@ namespace strpy
     [[nodiscard]] STRINGPY_EXPORT std::string format(std::string_view str,
                                                      const std::initializer_list<std::string>& args);
 
+}
+
+namespace strpy::detail
+{
+    /**
+     * @brief The base of the types that carry a format string checked at compile time.
+     *
+     * A derived type provides the string by a static member function <tt>value()</tt>
+     * that returns a constant \c std::string_view.
+     *
+     * @private
+     */
+    struct CompiledStringBase
+    {
+    };
+
+    /**
+     * @brief A constant that checks if a type carries a format string checked at compile time.
+     *
+     * @tparam T The type to check.
+     * @private
+     */
+    template <typename T>
+    inline constexpr bool IS_COMPILED_STRING = std::is_base_of_v<CompiledStringBase, T>;
+
+    /**
+     * @brief Counts the <tt>"{}"</tt> placeholders of a format string, in the order \ref strpy::format replaces them.
+     *
+     * @private
+     */
+    [[nodiscard]] constexpr std::size_t count_placeholders(const std::string_view str) noexcept
+    {
+        std::size_t count = 0;
+
+        for (auto pos = str.find("{}"); std::string_view::npos != pos; pos = str.find("{}", pos + 2)) {
+            ++count;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief The literal text between the placeholders of a format string.
+     *
+     * Segment \c i is the text before placeholder \c i, the last segment is the text after the last placeholder.
+     *
+     * @private
+     */
+    template <std::size_t Count>
+    struct FormatSegments
+    {
+        std::array<std::size_t, Count + 1> begins{};
+        std::array<std::size_t, Count + 1> ends{};
+    };
+
+    /**
+     * @brief Finds the literal text between the placeholders of a format string.
+     *
+     * @private
+     */
+    template <std::size_t Count>
+    [[nodiscard]] constexpr FormatSegments<Count> find_segments(const std::string_view str) noexcept
+    {
+        FormatSegments<Count> result{};
+        std::size_t begin = 0;
+
+        for (std::size_t i = 0; i < Count; ++i) {
+            const auto pos = str.find("{}", begin);
+            result.begins[i] = begin;
+            result.ends[i] = pos;
+            begin = pos + 2;
+        }
+
+        result.begins[Count] = begin;
+        result.ends[Count] = str.size();
+
+        return result;
+    }
+
+    /**
+     * @brief The placeholders of a format string that are found at compile time.
+     *
+     * @tparam S The type that carries the format string.
+     * @private
+     */
+    template <typename S>
+    struct CompiledFormat
+    {
+        static constexpr std::string_view STR = S::value();
+        static constexpr std::size_t COUNT = count_placeholders(STR);
+        static constexpr auto SEGMENTS = find_segments<COUNT>(STR);
+        static constexpr std::size_t LITERAL_SIZE = STR.size() - (2 * COUNT);
+
+        /** @brief Returns the literal text before a placeholder, or after the last one. */
+        [[nodiscard]] static constexpr std::string_view segment(const std::size_t index) noexcept
+        {
+            return STR.substr(SEGMENTS.begins[index], SEGMENTS.ends[index] - SEGMENTS.begins[index]);
+        }
+    };
+
+    /**
+     * @brief A constant that checks if a type is a pointer to a null-terminated string.
+     *
+     * @tparam T The type to check.
+     * @private
+     */
+    template <typename T>
+    inline constexpr bool IS_C_STRING =
+      std::is_pointer_v<T> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, std::string::value_type>;
+
+    /**
+     * @brief Returns a view of a null-terminated string, or an empty view for a null pointer.
+     *
+     * The string is taken as a pointer, so that a string literal decays before it is compared to \c nullptr.
+     *
+     * @private
+     */
+    [[nodiscard]] inline std::string_view c_string_view(const std::string::value_type* const str) noexcept
+    {
+        return (nullptr == str) ? std::string_view{} : std::string_view{str};
+    }
+
+    /**
+     * @brief Returns the expected number of characters that an argument adds to a formatted string.
+     *
+     * @private
+     */
+    template <typename T>
+    [[nodiscard]] std::size_t format_size_hint(const T& value) noexcept
+    {
+        using DecayedType = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<DecayedType, bool>) {
+            return std::string_view{"false"}.size();
+        }
+        else if constexpr (IS_CHAR<DecayedType>) {
+            return 1;
+        }
+        else if constexpr (std::is_integral_v<DecayedType>) {
+            return std::numeric_limits<DecayedType>::digits10 + 2;
+        }
+        else if constexpr (std::is_floating_point_v<DecayedType>) {
+            return std::numeric_limits<DecayedType>::max_digits10 + 8;
+        }
+        else if constexpr (IS_C_STRING<DecayedType>) {
+            return c_string_view(value).size();
+        }
+        else if constexpr (std::is_convertible_v<const DecayedType&, std::string_view>) {
+            return std::string_view{value}.size();
+        }
+        else {
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Returns the exact number of characters that an argument adds to a formatted string.
+     *
+     * @private
+     */
+    template <typename T>
+    [[nodiscard]] std::size_t formatted_arg_size(const T& value)
+    {
+        using DecayedType = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<DecayedType, bool>) {
+            return value ? std::string_view{"true"}.size() : std::string_view{"false"}.size();
+        }
+        else if constexpr (IS_CHAR<DecayedType>) {
+            return 1;
+        }
+        else if constexpr (IS_C_STRING<DecayedType>) {
+            return c_string_view(value).size();
+        }
+        else if constexpr (std::is_null_pointer_v<DecayedType>) {
+            return 0;
+        }
+        else if constexpr (std::is_convertible_v<const DecayedType&, std::string_view>) {
+            return std::string_view{value}.size();
+        }
+        else if constexpr (IS_NUMBER<DecayedType>) {
+            std::array<std::string::value_type, TO_CHARS_MAX_SIZE> buffer{};
+            return static_cast<std::size_t>(to_chars(buffer.data(), value) - buffer.data());
+        }
+        else {
+            return to_string(value).size();
+        }
+    }
+
+    /**
+     * @brief Adapts an output iterator to the interface of \c std::string that the formatting functions write to.
+     *
+     * @private
+     */
+    template <typename OutputIt>
+    struct IteratorOutput
+    {
+        OutputIt it;
+
+        void append(const std::string_view str)
+        {
+            it = std::copy(str.cbegin(), str.cend(), it);
+        }
+
+        void push_back(const std::string::value_type ch)
+        {
+            *it = ch;
+            ++it;
+        }
+    };
+
+    /**
+     * @brief Appends the string representation of an argument to a formatted string.
+     *
+     * Strings, characters and numbers are appended directly, other values are appended
+     * by their \ref strpy::formatter specialization.
+     *
+     * @private
+     */
+    template <typename Out, typename T>
+    void append_arg(Out& out, T&& value)
+    {
+        using DecayedType = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<DecayedType, bool>) {
+            out.append(std::string_view{value ? "true" : "false"});
+        }
+        else if constexpr (IS_CHAR<DecayedType>) {
+            out.push_back(static_cast<std::string::value_type>(value));
+        }
+        else if constexpr (IS_C_STRING<DecayedType>) {
+            out.append(c_string_view(value));
+        }
+        else if constexpr (std::is_null_pointer_v<DecayedType>) {
+            // A null pointer is formatted as an empty string
+        }
+        else if constexpr (std::is_convertible_v<const DecayedType&, std::string_view>) {
+            out.append(std::string_view{value});
+        }
+        else if constexpr (IS_NUMBER<DecayedType>) {
+            std::array<std::string::value_type, TO_CHARS_MAX_SIZE> buffer{};
+            const auto size = static_cast<std::size_t>(to_chars(buffer.data(), value) - buffer.data());
+            out.append(std::string_view{buffer.data(), size});
+        }
+        else {
+            static_assert(HAS_FORMATTER<DecayedType>,
+                          "The type has no strpy::formatter specialization, derive one from strpy::ostream_formatter "
+                          "to format the type with its stream operator");
+
+            if constexpr (std::is_same_v<Out, std::string>) {
+                formatter<DecayedType>::format(out, value);
+            }
+            else {
+                // The formatters append to a string, so the value is copied to other outputs
+                std::string str{};
+                formatter<DecayedType>::format(str, value);
+                out.append(std::string_view{str});
+            }
+        }
+    }
+
+    /**
+     * @brief Appends a format string, with the arguments in place of its <tt>"{}"</tt> placeholders.
+     *
+     * The placeholders are replaced from left to right, the arguments without a placeholder are ignored
+     * and the placeholders without an argument are kept.
+     *
+     * @private
+     */
+    template <typename Out, typename... Args>
+    void append_format(Out& out, const std::string_view str, Args&&... args)
+    {
+        std::size_t pos = 0;
+
+        const auto append_next = [&out, str, &pos](auto&& arg) {
+            if (std::string_view::npos == pos) {
+                return;
+            }
+
+            const auto found = str.find("{}", pos);
+
+            if (std::string_view::npos == found) {
+                out.append(str.substr(pos));
+                pos = std::string_view::npos;
+                return;
+            }
+
+            out.append(str.substr(pos, found - pos));
+            append_arg(out, std::forward<decltype(arg)>(arg));
+            pos = found + 2;
+        };
+
+        (append_next(std::forward<Args>(args)), ...);
+
+        if (std::string_view::npos != pos) {
+            out.append(str.substr(pos));
+        }
+    }
+
+    /**
+     * @brief Appends a format string checked at compile time, with the arguments in place of its placeholders.
+     *
+     * @private
+     */
+    template <typename S, typename Out, std::size_t... Indices, typename... Args>
+    void append_compiled(Out& out, std::index_sequence<Indices...> /*indices*/, Args&&... args)
+    {
+        using Format = CompiledFormat<S>;
+        static_assert(Format::COUNT == sizeof...(Args),
+                      "The number of arguments must match the number of placeholders of the format string");
+
+        ((out.append(Format::segment(Indices)), append_arg(out, std::forward<Args>(args))), ...);
+        out.append(Format::segment(Format::COUNT));
+    }
+}
+
+namespace strpy
+{
+    /**
+     * @brief Formats a \c std::string_view.
+     */
+    template <>
+    struct formatter<std::string_view>
+    {
+        /**
+         * @brief Appends the characters of a string view.
+         *
+         * @param out The string to append the value to.
+         * @param value The value to format.
+         */
+        static void format(std::string& out, const std::string_view value)
+        {
+            out.append(value);
+        }
+    };
+
+    /**
+     * @brief Formats a \c std::optional as its value, or as <tt>"none"</tt> if it has no value.
+     *
+     * @tparam T The type of the value.
+     */
+    template <typename T>
+    struct formatter<std::optional<T>>
+    {
+        /**
+         * @brief Appends the value of an optional.
+         *
+         * @param out The string to append the value to.
+         * @param value The value to format.
+         */
+        static void format(std::string& out, const std::optional<T>& value)
+        {
+            if (value.has_value()) {
+                detail::append_arg(out, *value);
+            }
+            else {
+                out.append("none");
+            }
+        }
+    };
+
+    /**
+     * @brief Formats an enumeration as its underlying integer.
+     *
+     * An enumeration whose values have names is formatted by names with a specialization of its own.
+     *
+     * @tparam T The type of the enumeration.
+     */
+    template <typename T>
+    struct formatter<T, std::enable_if_t<std::is_enum_v<T>>>
+    {
+        /**
+         * @brief Appends the integer of an enumerator.
+         *
+         * @param out The string to append the value to.
+         * @param value The value to format.
+         */
+        static void format(std::string& out, const T value)
+        {
+            using UnderlyingType = std::underlying_type_t<T>;
+            using IntegerType = std::conditional_t<std::is_signed_v<UnderlyingType>, std::int64_t, std::uint64_t>;
+
+            detail::append_arg(out, static_cast<IntegerType>(value));
+        }
+    };
+
+    /**
+     * @brief Formats a range as a list of its elements: <tt>"[1, 2, 3]"</tt>.
+     *
+     * The elements are formatted the same way as the arguments of \ref strpy::format.
+     * A range of characters, such as \c std::initializer_list<char>, is formatted as a string.
+     *
+     * @tparam T The type of the range.
+     */
+    template <typename T>
+    struct formatter<T, std::enable_if_t<detail::IS_RANGE<T> && !std::is_convertible_v<const T&, std::string_view>>>
+    {
+        /**
+         * @brief Appends the elements of a range.
+         *
+         * @param out The string to append the value to.
+         * @param value The value to format.
+         */
+        static void format(std::string& out, const T& value)
+        {
+            using ValueType = std::decay_t<decltype(*std::begin(value))>;
+
+            if constexpr (detail::IS_CHAR<ValueType>) {
+                for (const auto ch : value) {
+                    out.push_back(static_cast<std::string::value_type>(ch));
+                }
+            }
+            else {
+                out.push_back('[');
+                auto first = std::begin(value);
+                const auto last = std::end(value);
+
+                if (first != last) {
+                    detail::append_arg(out, *first);
+
+                    while (++first != last) {
+                        out.append(", ");
+                        detail::append_arg(out, *first);
+                    }
+                }
+
+                out.push_back(']');
+            }
+        }
+    };
+
+    /**
+     * @brief Appends a formatted string to a string by replacing placeholders with the given arguments.
+     *
+     * The placeholders are replaced the same way as by \ref strpy::format. The string is grown once
+     * by the size of the literal text and the expected size of the arguments, and the arguments
+     * are written into it directly, so a buffer that is reused for many formatted strings
+     * is rarely reallocated.
+     *
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param out The string to append the formatted string to.
+     * @param str The string containing placeholders to be replaced.
+     * @param args The arguments to be inserted into the string.
+     */
+    template <typename... Args>
+    void format_append(std::string& out, const std::string_view str, Args&&... args)
+    {
+        out.reserve(out.size() + str.size() + (std::size_t{0} + ... + detail::format_size_hint(args)));
+        detail::append_format(out, str, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Appends a formatted string checked at compile time to a string.
+     *
+     * The same as the run-time overload, with a format string created by the \ref STRPY_FMT macro.
+     * The positions of its <tt>"{}"</tt> placeholders are found at compile time, and a format string whose
+     * number of placeholders differs from the number of arguments does not compile.
+     *
+     * @tparam S The type that carries the format string.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param out The string to append the formatted string to.
+     * @param str The format string.
+     * @param args The arguments to be inserted into the string.
+     */
+    template <typename S, typename... Args, std::enable_if_t<detail::IS_COMPILED_STRING<S>, int> = 0>
+    void format_append(std::string& out, [[maybe_unused]] const S& str, Args&&... args)
+    {
+        out.reserve(out.size() + detail::CompiledFormat<S>::LITERAL_SIZE +
+                    (std::size_t{0} + ... + detail::format_size_hint(args)));
+        detail::append_compiled<S>(out, std::index_sequence_for<Args...>{}, std::forward<Args>(args)...);
+    }
+
     /**
      * @brief Formats a string by replacing placeholders with the given arguments.
      *
      * The function uses <tt>"{}"</tt> as a placeholder to specify where the arguments
      * should be inserted in the string to produce a formatted string.
+     * The arguments are written into the result directly, see \ref strpy::format_append.
      *
      * @tparam Args The types of the arguments to be inserted into the string.
      *
@@ -274,6 +866,269 @@ namespace strpy
     template <typename... Args>
     [[nodiscard]] std::string format(const std::string_view str, Args&&... args)
     {
-        return format(str, {to_string(std::forward<Args>(args))...});
+        std::string result{};
+        format_append(result, str, std::forward<Args>(args)...);
+
+        return result;
+    }
+
+    /**
+     * @brief Formats a string checked at compile time by replacing placeholders with the given arguments.
+     *
+     * The format string is created by the \ref STRPY_FMT macro, or by the \ref strpy::FixedString
+     * overload under C++20. The positions of its <tt>"{}"</tt> placeholders are found at compile time,
+     * and a format string whose number of placeholders differs from the number of arguments
+     * does not compile. The result is reserved once and the arguments are written into it directly.
+     * For the same arguments, the result is the same as the result of the run-time overload.
+     *
+     * @tparam S The type that carries the format string.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param str The format string.
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return A formatted string with placeholders replaced by the given arguments.
+     */
+    template <typename S, typename... Args, std::enable_if_t<detail::IS_COMPILED_STRING<S>, int> = 0>
+    [[nodiscard]] std::string format(const S& str, Args&&... args)
+    {
+        std::string result{};
+        format_append(result, str, std::forward<Args>(args)...);
+
+        return result;
     }
+
+    /**
+     * @brief Formats a string into an output iterator by replacing placeholders with the given arguments.
+     *
+     * The placeholders are replaced the same way as by \ref strpy::format, and the literal text
+     * and the arguments are written to the iterator as they are formatted.
+     *
+     * @tparam OutputIt The type of the output iterator of characters.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param out The iterator to write the formatted string to.
+     * @param str The string containing placeholders to be replaced.
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return The iterator past the last written character.
+     */
+    template <typename OutputIt, typename... Args>
+    OutputIt format_to(const OutputIt out, const std::string_view str, Args&&... args)
+    {
+        detail::IteratorOutput<OutputIt> output{out};
+        detail::append_format(output, str, std::forward<Args>(args)...);
+
+        return output.it;
+    }
+
+    /**
+     * @brief Formats a string checked at compile time into an output iterator.
+     *
+     * The same as the run-time overload, with a format string created by the \ref STRPY_FMT macro.
+     *
+     * @tparam OutputIt The type of the output iterator of characters.
+     * @tparam S The type that carries the format string.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param out The iterator to write the formatted string to.
+     * @param str The format string.
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return The iterator past the last written character.
+     */
+    template <typename OutputIt, typename S, typename... Args,
+              std::enable_if_t<detail::IS_COMPILED_STRING<S>, int> = 0>
+    OutputIt format_to(const OutputIt out, [[maybe_unused]] const S& str, Args&&... args)
+    {
+        detail::IteratorOutput<OutputIt> output{out};
+        detail::append_compiled<S>(output, std::index_sequence_for<Args...>{}, std::forward<Args>(args)...);
+
+        return output.it;
+    }
+
+    /**
+     * @brief Returns the size of the string that \ref strpy::format returns for the given arguments.
+     *
+     * The size of strings, characters and booleans is computed without formatting them,
+     * numbers are written to a buffer on the stack.
+     *
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param str The string containing placeholders to be replaced.
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return The size of the formatted string.
+     */
+    template <typename... Args>
+    [[nodiscard]] std::size_t formatted_size(const std::string_view str, const Args&... args)
+    {
+        const auto count = std::min(detail::count_placeholders(str), sizeof...(Args));
+        auto size = str.size() - (2 * count);
+        std::size_t index = 0;
+
+        ((size += (index++ < count) ? detail::formatted_arg_size(args) : 0), ...);
+
+        return size;
+    }
+
+    /**
+     * @brief Returns the size of the string that \ref strpy::format returns for a format string checked
+     * at compile time and the given arguments.
+     *
+     * @tparam S The type that carries the format string.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param str The format string.
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return The size of the formatted string.
+     */
+    template <typename S, typename... Args, std::enable_if_t<detail::IS_COMPILED_STRING<S>, int> = 0>
+    [[nodiscard]] std::size_t formatted_size([[maybe_unused]] const S& str, const Args&... args)
+    {
+        using Format = detail::CompiledFormat<S>;
+        static_assert(Format::COUNT == sizeof...(Args),
+                      "The number of arguments must match the number of placeholders of the format string");
+
+        return (Format::LITERAL_SIZE + ... + detail::formatted_arg_size(args));
+    }
+
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+    /**
+     * @brief A string literal that can be passed as a template argument (C++20).
+     *
+     * @tparam Size The size of the string literal, including the terminating null character.
+     */
+    template <std::size_t Size>
+    struct FixedString
+    {
+        /**
+         * @brief Constructs a copy of a string literal.
+         *
+         * @param str The string literal.
+         */
+        constexpr FixedString(const std::string::value_type (&str)[Size]) noexcept // NOLINT
+        {
+            for (std::size_t i = 0; i < Size; ++i) {
+                data[i] = str[i];
+            }
+        }
+
+        /**
+         * @brief Returns the string without the terminating null character.
+         *
+         * @return A view of the string.
+         */
+        [[nodiscard]] constexpr std::string_view view() const noexcept
+        {
+            return {data, Size - 1};
+        }
+
+        /** @brief The characters of the string literal. */
+        std::string::value_type data[Size]{}; // NOLINT
+    };
+
+    namespace detail
+    {
+        /** @private */
+        template <FixedString Str>
+        struct FixedCompiledString : CompiledStringBase
+        {
+            [[nodiscard]] static constexpr std::string_view value() noexcept
+            {
+                return Str.view();
+            }
+        };
+    }
+
+    /**
+     * @brief Formats a string literal checked at compile time by replacing placeholders with the given arguments
+     * (C++20).
+     *
+     * The same as the \ref STRPY_FMT overload, with the format string given as a template argument:
+     * <tt>strpy::format<"{} + {}">(1, 2)</tt>.
+     *
+     * @tparam Str The format string.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return A formatted string with placeholders replaced by the given arguments.
+     */
+    template <FixedString Str, typename... Args>
+    [[nodiscard]] std::string format(Args&&... args)
+    {
+        return format(detail::FixedCompiledString<Str>{}, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Appends a formatted string literal checked at compile time to a string (C++20).
+     *
+     * @tparam Str The format string.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param out The string to append the formatted string to.
+     * @param args The arguments to be inserted into the string.
+     */
+    template <FixedString Str, typename... Args>
+    void format_append(std::string& out, Args&&... args)
+    {
+        format_append(out, detail::FixedCompiledString<Str>{}, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Formats a string literal checked at compile time into an output iterator (C++20).
+     *
+     * @tparam Str The format string.
+     * @tparam OutputIt The type of the output iterator of characters.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param out The iterator to write the formatted string to.
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return The iterator past the last written character.
+     */
+    template <FixedString Str, typename OutputIt, typename... Args>
+    OutputIt format_to(const OutputIt out, Args&&... args)
+    {
+        return format_to(out, detail::FixedCompiledString<Str>{}, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns the size of a formatted string literal checked at compile time (C++20).
+     *
+     * @tparam Str The format string.
+     * @tparam Args The types of the arguments to be inserted into the string.
+     *
+     * @param args The arguments to be inserted into the string.
+     *
+     * @return The size of the formatted string.
+     */
+    template <FixedString Str, typename... Args>
+    [[nodiscard]] std::size_t formatted_size(const Args&... args)
+    {
+        return formatted_size(detail::FixedCompiledString<Str>{}, args...);
+    }
+#endif
 }
+
+/**
+ * @brief Creates a format string whose placeholders are found and checked at compile time.
+ *
+ * The result is passed to \ref strpy::format instead of a run-time format string:
+ * <tt>strpy::format(STRPY_FMT("{} + {}"), 1, 2)</tt>.
+ *
+ * @param str A string literal.
+ */
+#define STRPY_FMT(str)                                                                                                 \
+    [] {                                                                                                               \
+        struct CompiledString : ::strpy::detail::CompiledStringBase                                                    \
+        {                                                                                                              \
+            [[nodiscard]] static constexpr std::string_view value() noexcept                                           \
+            {                                                                                                          \
+                return str;                                                                                            \
+            }                                                                                                          \
+        };                                                                                                             \
+        return CompiledString{};                                                                                       \
+    }()
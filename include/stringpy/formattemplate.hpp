@@ -0,0 +1,328 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a format string that is parsed once and rendered many times, and a cache of them.
+ *
+ * @example formattemplate.cpp
+ * Demonstrates the use of the FormatTemplate and FormatTemplateCache classes and the arg() function
+ * from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include "stringpy/format.hpp"
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace strpy::detail
+{
+    /** @private */
+    template <typename T>
+    struct NamedArg
+    {
+        std::string_view name;
+        const T& value;
+    };
+
+    /**
+     * @brief An argument of a template whose type is erased, so that the templates are rendered
+     * by a single function.
+     *
+     * @private
+     */
+    struct TemplateArg
+    {
+        std::string_view name;
+        bool named;
+        const void* value;
+        void (*append)(std::string& out, const void* value);
+    };
+
+    /** @private */
+    template <typename T>
+    void append_erased(std::string& out, const void* const value)
+    {
+        append_arg(out, *static_cast<const T*>(value));
+    }
+
+    /** @private */
+    template <typename T>
+    [[nodiscard]] TemplateArg make_template_arg(const T& value) noexcept
+    {
+        return {{}, false, &value, &append_erased<T>};
+    }
+
+    /** @private */
+    template <typename T>
+    [[nodiscard]] TemplateArg make_template_arg(const NamedArg<T>& arg) noexcept
+    {
+        return {arg.name, true, &arg.value, &append_erased<T>};
+    }
+}
+
+namespace strpy
+{
+    /**
+     * @brief Names an argument of \ref strpy::FormatTemplate::render.
+     *
+     * The argument refers to the value, so it is passed directly to \c render:
+     * <tt>tpl.render(strpy::arg("user", name))</tt>. The fields of a struct are passed the same way,
+     * one named argument per field.
+     *
+     * @tparam T The type of the value.
+     *
+     * @param name The name of the placeholder to replace with the value.
+     * @param value The value.
+     *
+     * @return The named argument.
+     */
+    template <typename T>
+    [[nodiscard]] detail::NamedArg<T> arg(const std::string_view name, const T& value) noexcept
+    {
+        return {name, value};
+    }
+
+    /**
+     * @brief A format string that is parsed once into segments, and rendered many times.
+     *
+     * Unlike \ref strpy::format, the format string may come from a configuration at run time,
+     * and it has the placeholders of Python's \c str.format:
+     *
+     * - <tt>"{}"</tt> is replaced by the next positional argument;
+     * - <tt>"{0}"</tt>, <tt>"{1}"</tt>, ... are replaced by the positional argument with the index;
+     * - <tt>"{name}"</tt>, where the name is made of letters, digits and underscores, is replaced
+     *   by the argument with the name;
+     * - <tt>"{{"</tt> and <tt>"}}"</tt> are the characters <tt>'{'</tt> and <tt>'}'</tt>.
+     *
+     * Braces that do not make a placeholder are kept as they are, and so are the placeholders
+     * without an argument. The arguments are formatted the same way as the arguments of \ref strpy::format.
+     *
+     * The template owns a copy of the format string, it can be copied and shared between threads.
+     */
+    class STRINGPY_EXPORT FormatTemplate
+    {
+    public:
+        /**
+         * @brief Constructs an empty template.
+         */
+        FormatTemplate() noexcept = default;
+
+        /**
+         * @brief Parses a format string.
+         *
+         * @param text The format string.
+         */
+        explicit FormatTemplate(std::string_view text) noexcept;
+
+        /**
+         * @brief Renders the template with positional and named arguments.
+         *
+         * The positional arguments are the ones not created by \ref strpy::arg, in their order.
+         *
+         * @tparam Args The types of the arguments.
+         *
+         * @param args The arguments.
+         *
+         * @return The rendered string.
+         */
+        template <typename... Args>
+        [[nodiscard]] std::string render(const Args&... args) const
+        {
+            std::string result{};
+            render_append(result, args...);
+
+            return result;
+        }
+
+        /**
+         * @brief Appends the template rendered with positional and named arguments to a string.
+         *
+         * @tparam Args The types of the arguments.
+         *
+         * @param out The string to append the rendered template to.
+         * @param args The arguments.
+         */
+        template <typename... Args>
+        void render_append(std::string& out, const Args&... args) const
+        {
+            const std::array<detail::TemplateArg, sizeof...(Args)> erased{detail::make_template_arg(args)...};
+
+            out.reserve(out.size() + literals_.size() + (std::size_t{0} + ... + detail::format_size_hint(args)));
+            render_args(out, erased.data(), erased.size());
+        }
+
+        /**
+         * @brief Renders the template with the named arguments of a map.
+         *
+         * @tparam Map The type of the map, such as <tt>std::map<std::string, T></tt>
+         * or <tt>std::unordered_map<std::string, T></tt>.
+         *
+         * @param args The map of the argument names to the arguments.
+         *
+         * @return The rendered string.
+         */
+        template <typename Map>
+        [[nodiscard]] std::string render_map(const Map& args) const
+        {
+            std::string result{};
+            render_map_append(result, args);
+
+            return result;
+        }
+
+        /**
+         * @brief Appends the template rendered with the named arguments of a map to a string.
+         *
+         * The positional placeholders are kept.
+         *
+         * @tparam Map The type of the map.
+         *
+         * @param out The string to append the rendered template to.
+         * @param args The map of the argument names to the arguments.
+         */
+        template <typename Map>
+        void render_map_append(std::string& out, const Map& args) const
+        {
+            out.reserve(out.size() + literals_.size());
+
+            for (const auto& segment : segments_) {
+                out.append(literals_, segment.literal_begin, segment.literal_size);
+
+                if (0 == segment.placeholder_size) {
+                    continue;
+                }
+
+                if (!segment.positional()) {
+                    if (const auto it = args.find(typename Map::key_type{name(segment)}); it != args.end()) {
+                        detail::append_arg(out, it->second);
+                        continue;
+                    }
+                }
+
+                out.append(text_, segment.placeholder_begin, segment.placeholder_size);
+            }
+        }
+
+        /**
+         * @brief Returns the format string.
+         *
+         * @return A view of the format string, valid as long as the template.
+         */
+        [[nodiscard]] std::string_view text() const noexcept
+        {
+            return text_;
+        }
+
+    private:
+        /** @brief A literal text and the placeholder that follows it. */
+        struct Segment
+        {
+            /** @brief Returns whether the placeholder has an index instead of a name. */
+            [[nodiscard]] bool positional() const noexcept
+            {
+                return std::string_view::npos != index;
+            }
+
+            /** @brief The position of the literal text in \ref literals_. */
+            std::size_t literal_begin = 0;
+
+            /** @brief The size of the literal text. */
+            std::size_t literal_size = 0;
+
+            /** @brief The position of the placeholder, with its braces, in \ref text_. */
+            std::size_t placeholder_begin = 0;
+
+            /** @brief The size of the placeholder, 0 in the last segment that has no placeholder. */
+            std::size_t placeholder_size = 0;
+
+            /** @brief The index of a positional placeholder, or \c std::string_view::npos for a named one. */
+            std::size_t index = std::string_view::npos;
+        };
+
+        /** @brief Returns the name of a named placeholder. */
+        [[nodiscard]] std::string_view name(const Segment& segment) const noexcept
+        {
+            return std::string_view{text_}.substr(segment.placeholder_begin + 1, segment.placeholder_size - 2);
+        }
+
+        /** @brief Appends the template rendered with arguments whose types are erased. */
+        void render_args(std::string& out, const detail::TemplateArg* args, std::size_t count) const;
+
+        std::string text_{};
+        std::string literals_{};
+        std::vector<Segment> segments_{};
+    };
+
+    /**
+     * @brief A thread-safe cache of the templates of format strings, which evicts the least recently used one.
+     *
+     * The templates are shared: a template that is evicted stays valid as long as it is used.
+     */
+    class STRINGPY_EXPORT FormatTemplateCache
+    {
+    public:
+        /** @brief The number of templates kept by default. */
+        static constexpr std::size_t DEFAULT_CAPACITY = 128;
+
+        /**
+         * @brief Constructs an empty cache.
+         *
+         * @param capacity The maximum number of templates to keep (optional).
+         */
+        explicit FormatTemplateCache(const std::size_t capacity = DEFAULT_CAPACITY) noexcept :
+            capacity_(capacity)
+        {
+        }
+
+        /**
+         * @brief Returns the template of a format string, parsing it if it is not in the cache.
+         *
+         * @param text The format string.
+         *
+         * @return The template.
+         */
+        [[nodiscard]] std::shared_ptr<const FormatTemplate> get(std::string_view text);
+
+        /**
+         * @brief Returns the number of templates in the cache.
+         *
+         * @return The number of templates.
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        /**
+         * @brief Returns the maximum number of templates kept by the cache.
+         *
+         * @return The capacity of the cache.
+         */
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /**
+         * @brief Removes all templates from the cache.
+         */
+        void clear();
+
+    private:
+        using Entries = std::list<std::shared_ptr<const FormatTemplate>>;
+
+        mutable std::mutex mutex_{};
+        Entries entries_{};
+        std::unordered_map<std::string_view, Entries::iterator> index_{};
+        std::size_t capacity_;
+    };
+}
@@ -13,9 +13,8 @@
 
 #pragma once
 
-#include <algorithm>
+#include "stringpy/format.hpp"
 #include <iterator>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -26,6 +25,8 @@ namespace strpy
      *
      * Takes a container of elements and a delimiter string as arguments and returns a new string
      * that is the concatenation of the elements in the container with the delimiter between them.
+     * The elements are written the same way as the arguments of \ref strpy::format: strings, characters
+     * and numbers directly into the result, other types by their \ref strpy::formatter specialization.
      *
      * @tparam Container The type of the container to join.
      * @tparam ValueType The type of the values in the container (optional).
@@ -41,21 +42,20 @@ namespace strpy
     [[nodiscard]] std::string join(const Container& container, const std::string& delimiter)
     {
         auto first = std::begin(container);
-        auto last = std::end(container);
+        const auto last = std::end(container);
 
         if (first == last) {
             return {};
         }
 
-        std::ostringstream result_stream{};
-        result_stream.rdbuf()->pubsetbuf(nullptr, std::distance(first, last));
-        std::copy(first, std::prev(last), std::ostream_iterator<ValueType>(result_stream, delimiter.c_str()));
-        first = std::prev(last);
+        std::string result{};
+        detail::append_arg(result, static_cast<const ValueType&>(*first));
 
-        if (first != last) {
-            result_stream << *first;
+        while (++first != last) {
+            result.append(delimiter);
+            detail::append_arg(result, static_cast<const ValueType&>(*first));
         }
 
-        return result_stream.rdbuf()->str();
+        return result;
     }
 }
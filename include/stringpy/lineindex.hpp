@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a class for random access to the lines of a large text.
+ *
+ * @example lineindex.cpp
+ * Demonstrates the use of the LineIndex class from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace strpy
+{
+    /**
+     * @brief A table of the line starts of a text, for random access to its lines.
+     *
+     * The lines are the same as the lines returned by \ref strpy::split_lines: a line break is either CR, LF
+     * or CR LF. The line breaks are found in one pass with the vectorized scanner of \ref strpy::split_lines.
+     *
+     * The line starts are kept in blocks of \ref BLOCK_LINES lines: the absolute start of the first line
+     * of a block and a 32-bit offset of every line from it, that is about 4 bytes per line.
+     * If the lines of a block span more than 4 GiB, all line starts are kept as full \c std::size_t values instead.
+     *
+     * The index refers to the text and must not outlive it. A text that keeps growing, such as a log file
+     * being written, is indexed incrementally with \ref append.
+     */
+    class STRINGPY_EXPORT LineIndex
+    {
+    public:
+        /** @brief The number of lines that share the absolute start of a block. */
+        static constexpr std::size_t BLOCK_LINES = 64;
+
+        /**
+         * @brief Constructs an index of an empty text.
+         */
+        LineIndex() noexcept = default;
+
+        /**
+         * @brief Constructs an index of a text.
+         *
+         * @param text The text to index.
+         */
+        explicit LineIndex(const std::string_view text) noexcept
+        {
+            append(text);
+        }
+
+        /**
+         * @brief Extends the index to a longer version of the indexed text.
+         *
+         * Only the bytes after the end of the indexed text are scanned. A line that was incomplete at the end
+         * of the indexed text is extended, and a CR at its end joins an LF at the start of the new bytes.
+         *
+         * @param text The text to index. The indexed text must be a prefix of it, it may be at another address,
+         * such as a string that has been reallocated or a file that has been mapped again.
+         */
+        void append(std::string_view text) noexcept;
+
+        /**
+         * @brief Returns the number of lines.
+         *
+         * @return The number of lines, the same as the size of <tt>strpy::split_lines(text())</tt>.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return ((count_ != 0) && (start(count_ - 1) == text_.size())) ? (count_ - 1) : count_;
+        }
+
+        /**
+         * @brief Checks whether the text has no lines.
+         *
+         * @return \c true if the text is empty, \c false otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return text_.empty();
+        }
+
+        /**
+         * @brief Returns a line, in constant time.
+         *
+         * @param index The index of the line. Must be less than \ref size.
+         * @param keep_ends Whether to keep the line break in the line (optional).
+         *
+         * @return A view of the line in the text.
+         */
+        [[nodiscard]] std::string_view line(std::size_t index, bool keep_ends = false) const noexcept;
+
+        /**
+         * @brief Finds the line that contains a byte, in logarithmic time.
+         *
+         * The line break at the end of a line belongs to that line.
+         *
+         * @param offset The position of the byte in the text.
+         *
+         * @return The index of the line, or \c std::string_view::npos if the offset is not less than
+         * the size of the text.
+         */
+        [[nodiscard]] std::size_t line_of(std::size_t offset) const noexcept;
+
+        /**
+         * @brief Returns the position of the first byte of a line.
+         *
+         * @param index The index of the line. Must be less than \ref size.
+         *
+         * @return The position of the line in the text.
+         */
+        [[nodiscard]] std::size_t line_start(const std::size_t index) const noexcept
+        {
+            return start(index);
+        }
+
+        /**
+         * @brief Returns the indexed text.
+         *
+         * @return A view of the text passed to the constructor or to the last call of \ref append.
+         */
+        [[nodiscard]] std::string_view text() const noexcept
+        {
+            return text_;
+        }
+
+    private:
+        /** @brief Returns the recorded start of a line, including the start at the end of the text after a break. */
+        [[nodiscard]] std::size_t start(const std::size_t index) const noexcept
+        {
+            return wide_ ? starts_[index] : (bases_[index / BLOCK_LINES] + offsets_[index]);
+        }
+
+        /** @brief Records the start of the next line. */
+        void push_start(std::size_t pos) noexcept;
+
+        /** @brief Replaces the start of the last line. */
+        void set_last_start(std::size_t pos) noexcept;
+
+        /** @brief Converts the blocks into full line starts. */
+        void widen() noexcept;
+
+        std::string_view text_{};
+        std::vector<std::size_t> bases_{};
+        std::vector<std::uint32_t> offsets_{};
+        std::vector<std::size_t> starts_{};
+        std::size_t count_ = 0;
+        bool wide_ = false;
+    };
+}
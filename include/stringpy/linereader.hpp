@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a class for reading the lines of a stream that cannot be held in memory at once.
+ *
+ * @example linereader.cpp
+ * Demonstrates the use of the LineReader class from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <istream>
+#include <string_view>
+#include <system_error>
+#include <cstddef>
+#include <vector>
+
+namespace strpy
+{
+    /**
+     * @brief Reads the lines of a file descriptor or an input stream, such as a pipe, a socket or \c stdin.
+     *
+     * The lines are the same as the lines returned by \ref strpy::split_lines for the whole input:
+     * a line break is either CR, LF or CR LF, including a CR LF whose two characters arrive in different reads.
+     *
+     * The input is read into a buffer of a fixed size that is allocated once. When the buffer holds no complete
+     * line, the incomplete line is moved to the front of the buffer and the rest of it is refilled,
+     * so the memory use does not depend on the size of the input. A line that does not fit
+     * into the buffer is returned in consecutive parts, see \ref partial.
+     */
+    class STRINGPY_EXPORT LineReader
+    {
+    public:
+        /** @brief The default size of the buffer. */
+        static constexpr std::size_t DEFAULT_BUFFER_SIZE = std::size_t{1} << 16U;
+
+        /**
+         * @brief Constructs a reader of a file descriptor.
+         *
+         * @param fd The file descriptor to read from. It is not closed by the reader.
+         * @param keep_ends Whether to keep the line breaks in the resulting lines (optional).
+         * @param buffer_size The size of the buffer, at least \c 2 (optional).
+         */
+        explicit LineReader(int fd, bool keep_ends = false, std::size_t buffer_size = DEFAULT_BUFFER_SIZE) noexcept;
+
+        /**
+         * @brief Constructs a reader of an input stream.
+         *
+         * @param stream The stream to read from. Must outlive the reader.
+         * @param keep_ends Whether to keep the line breaks in the resulting lines (optional).
+         * @param buffer_size The size of the buffer, at least \c 2 (optional).
+         */
+        explicit LineReader(std::istream& stream, bool keep_ends = false,
+                            std::size_t buffer_size = DEFAULT_BUFFER_SIZE) noexcept;
+
+        LineReader(const LineReader&) = delete;
+
+        /**
+         * @brief Constructs a reader by taking over the input and the buffer of another one.
+         *
+         * @param other The reader to move, it must not be used afterwards.
+         */
+        LineReader(LineReader&& other) noexcept = default;
+
+        /**
+         * @brief Destroys the reader, the input is not closed.
+         */
+        ~LineReader() noexcept = default;
+
+        LineReader& operator=(const LineReader&) = delete;
+
+        /**
+         * @brief Takes over the input and the buffer of another reader.
+         *
+         * @param other The reader to move, it must not be used afterwards.
+         *
+         * @return A reference to this reader.
+         */
+        LineReader& operator=(LineReader&& other) noexcept = default;
+
+        /**
+         * @brief Reads the next line.
+         *
+         * If reading the input fails, the lines read so far are returned and then the input is treated
+         * as if it had ended, the error is reported by \ref error.
+         *
+         * @param line Set to a view of the line, valid until the next call of this function.
+         *
+         * @return \c true if a line was read, \c false at the end of the input.
+         */
+        [[nodiscard]] bool next(std::string_view& line) noexcept;
+
+        /**
+         * @brief Checks whether the last line read is a part of a line that does not fit into the buffer.
+         *
+         * @return \c true if the line continues in the next line read, \c false otherwise.
+         */
+        [[nodiscard]] bool partial() const noexcept
+        {
+            return partial_;
+        }
+
+        /**
+         * @brief Returns the error that ended the input.
+         *
+         * @return The error of the failed read, or an empty error code if none occurred.
+         */
+        [[nodiscard]] std::error_code error() const noexcept
+        {
+            return error_;
+        }
+
+    private:
+        /** @brief Reads more input into the buffer after its end, returns the number of bytes read. */
+        std::size_t read(char* data, std::size_t size) noexcept;
+
+        /** @brief Moves the incomplete line to the front of the buffer and reads more input after it. */
+        void refill() noexcept;
+
+        int fd_ = -1;
+        std::istream* stream_ = nullptr;
+        std::vector<char> buffer_;
+        std::size_t begin_ = 0;
+        std::size_t end_ = 0;
+        std::size_t scan_ = 0;
+        std::error_code error_{};
+        bool keep_ends_;
+        bool partial_ = false;
+        bool eof_ = false;
+    };
+}
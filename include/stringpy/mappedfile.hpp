@@ -0,0 +1,208 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a read-only memory-mapped file whose contents can be passed to the string functions.
+ *
+ * @example mappedfile.cpp
+ * Demonstrates the use of the make_mapped_file() function and the MappedFile class from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace strpy
+{
+    /**
+     * @brief Specifies options for mapping files.
+     */
+    enum class MappedFileOptions : unsigned
+    {
+        /** @brief Indicates that no options should be used when mapping files. */
+        none = 0U,
+
+        /** @brief Indicates that the file will be read from the beginning to the end, so pages are read ahead. */
+        sequential = 1U << 0U,
+
+        /** @brief Indicates that the mapping should be backed by huge pages where the system supports it. */
+        huge_pages = 1U << 1U,
+
+        /** @brief Indicates that the file should be read into memory instead of being mapped. */
+        no_map = 1U << 2U
+    };
+
+    /**
+     * @brief The read-only contents of a file, mapped into memory.
+     *
+     * The contents are exposed as a \c std::string_view and can be passed directly to the string functions
+     * and views of the library without copying the file into a \c std::string.
+     *
+     * On POSIX systems, a regular file is mapped with \c mmap and the options are given to the kernel
+     * with \c madvise. Files that cannot be mapped, such as pipes, character devices and files of the
+     * \c /proc file system, are read into a buffer of the object instead. On other systems the file
+     * is always read into the buffer.
+     *
+     * Created by the \ref strpy::make_mapped_file function. The object can be moved but not copied;
+     * the views of its contents are invalidated when it is destroyed or assigned to.
+     */
+    class STRINGPY_EXPORT MappedFile
+    {
+    public:
+        /**
+         * @brief Constructs an object without contents.
+         */
+        MappedFile() noexcept = default;
+
+        MappedFile(const MappedFile&) = delete;
+
+        /**
+         * @brief Constructs an object by taking over the contents of another one.
+         *
+         * @param other The object to move, it is left without contents.
+         */
+        MappedFile(MappedFile&& other) noexcept;
+
+        /**
+         * @brief Unmaps the file.
+         */
+        ~MappedFile() noexcept;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Unmaps the file and takes over the contents of another object.
+         *
+         * @param other The object to move, it is left without contents.
+         *
+         * @return A reference to this object.
+         */
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+         * @brief Returns the contents of the file.
+         *
+         * @return A view of the contents, valid as long as the object.
+         */
+        [[nodiscard]] std::string_view view() const noexcept
+        {
+            return contents_;
+        }
+
+        /**
+         * @brief Returns the contents of the file.
+         *
+         * @return A view of the contents, valid as long as the object.
+         */
+        [[nodiscard]] operator std::string_view() const noexcept // NOLINT(google-explicit-constructor)
+        {
+            return contents_;
+        }
+
+        /**
+         * @brief Returns a pointer to the first byte of the contents.
+         *
+         * @return A pointer to the contents, not terminated by a null character.
+         */
+        [[nodiscard]] const char* data() const noexcept
+        {
+            return contents_.data();
+        }
+
+        /**
+         * @brief Returns the size of the contents.
+         *
+         * @return The size of the file in bytes.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return contents_.size();
+        }
+
+        /**
+         * @brief Checks whether the contents are empty.
+         *
+         * @return \c true if the file is empty or no file has been mapped, \c false otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return contents_.empty();
+        }
+
+        /**
+         * @brief Checks whether the contents are mapped into memory.
+         *
+         * @return \c true if the file is mapped, \c false if it has been read into a buffer or is empty.
+         */
+        [[nodiscard]] bool mapped() const noexcept
+        {
+            return nullptr != mapping_;
+        }
+
+    private:
+        friend MappedFile make_mapped_file(const std::string& path, std::error_code& error,
+                                           MappedFileOptions options) noexcept;
+
+        /** @brief Unmaps the file and releases the buffer. */
+        void reset() noexcept;
+
+        void* mapping_ = nullptr;
+        std::vector<char> buffer_{};
+        std::string_view contents_{};
+    };
+
+    /**
+     * @brief Maps a file into memory for reading.
+     *
+     * @param path The path of the file.
+     * @param error Set to the error that occurred, or cleared on success.
+     * @param options A bitwise combination of MappedFileOptions values that specifies options for mapping
+     * the file (optional).
+     *
+     * @return The contents of the file, or an object without contents if an error occurred.
+     */
+    [[nodiscard]] STRINGPY_EXPORT MappedFile
+      make_mapped_file(const std::string& path, std::error_code& error,
+                       MappedFileOptions options = MappedFileOptions::sequential) noexcept;
+}
+
+/**
+ * @brief Bitwise OR operator for the \c MappedFileOptions enumeration.
+ *
+ * @param lhs The left-hand side operand.
+ * @param rhs The right-hand side operand.
+ *
+ * @return The result of the bitwise OR operation.
+ * @private
+ */
+[[nodiscard]] constexpr strpy::MappedFileOptions operator|(const strpy::MappedFileOptions lhs,
+                                                           const strpy::MappedFileOptions rhs) noexcept
+{
+    return static_cast<strpy::MappedFileOptions>(static_cast<std::underlying_type_t<strpy::MappedFileOptions>>(lhs) |
+                                                 static_cast<std::underlying_type_t<strpy::MappedFileOptions>>(rhs));
+}
+
+/**
+ * @brief Bitwise AND operator for the \c MappedFileOptions enumeration.
+ *
+ * @param lhs The left-hand side operand.
+ * @param rhs The right-hand side operand.
+ *
+ * @return The result of the bitwise AND operation.
+ * @private
+ */
+[[nodiscard]] constexpr strpy::MappedFileOptions operator&(const strpy::MappedFileOptions lhs,
+                                                           const strpy::MappedFileOptions rhs) noexcept
+{
+    return static_cast<strpy::MappedFileOptions>(static_cast<std::underlying_type_t<strpy::MappedFileOptions>>(lhs) &
+                                                 static_cast<std::underlying_type_t<strpy::MappedFileOptions>>(rhs));
+}
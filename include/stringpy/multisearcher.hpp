@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a compiled multi-pattern searcher based on the Aho-Corasick automaton.
+ *
+ * @example multisearcher.cpp
+ * Demonstrates the use of the make_multi_searcher() and make_multi_searcher_icase() functions
+ * from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace strpy
+{
+    namespace detail
+    {
+        /** @private */
+        struct MultiSearcherData;
+    }
+
+    /**
+     * @brief Specifies which match wins when several patterns match at the same leftmost position.
+     */
+    enum class MatchKind : unsigned
+    {
+        /** @brief The pattern that comes first in the pattern list wins. */
+        first = 0U,
+
+        /** @brief The longest pattern wins, ties are resolved by the pattern order. */
+        leftmost_longest = 1U
+    };
+
+    /**
+     * @brief Describes an occurrence of a pattern found by \ref strpy::MultiSearcher.
+     */
+    struct Match
+    {
+        /** @brief The index of the occurrence, or \c std::string_view::npos if nothing was found. */
+        std::size_t position = std::string_view::npos;
+
+        /** @brief The length of the occurrence. */
+        std::size_t length = 0;
+
+        /** @brief The index of the matched pattern in the pattern list. */
+        std::size_t pattern = std::string_view::npos;
+    };
+
+    /**
+     * @brief A set of patterns compiled into an Aho-Corasick automaton and searched for in a single pass.
+     *
+     * Created by the \ref strpy::make_multi_searcher and \ref strpy::make_multi_searcher_icase functions.
+     * The automaton is a full DFA over the byte classes that occur in the patterns,
+     * so every input byte costs one table lookup regardless of the number of patterns.
+     * The leftmost searches of \ref find_any and \ref replace_many use an automaton per \ref strpy::MatchKind,
+     * built on first use, which stops as soon as no later match can win over the found one.
+     *
+     * Empty patterns never match, except in \ref count_each which follows \ref strpy::count.
+     * The compiled automaton is immutable and shared between copies, so a searcher is cheap to copy
+     * and can be used from several threads at the same time.
+     */
+    class STRINGPY_EXPORT MultiSearcher
+    {
+    public:
+        /**
+         * @brief Constructs a searcher without patterns.
+         */
+        MultiSearcher() noexcept;
+
+        /**
+         * @brief Finds the leftmost occurrence of any pattern within a string.
+         *
+         * @param str The string to search within.
+         * @param start The starting position for the search (optional).
+         * @param kind Which pattern wins when several patterns match at the same position (optional).
+         *
+         * @return The leftmost occurrence, or a match with \c std::string_view::npos position if nothing is found.
+         */
+        [[nodiscard]] Match find_any(std::string_view str, std::size_t start = 0,
+                                     MatchKind kind = MatchKind::first) const noexcept;
+
+        /**
+         * @brief Counts the non-overlapping occurrences of each pattern within a string.
+         *
+         * The element \c i of the result is equal to <tt>strpy::count(str, patterns[i])</tt>
+         * (or \ref strpy::count_icase for a case-insensitive searcher).
+         *
+         * @param str The string to search within.
+         *
+         * @return A vector with the number of occurrences of every pattern.
+         */
+        [[nodiscard]] std::vector<std::size_t> count_each(std::string_view str) const noexcept;
+
+        /**
+         * @brief Finds all occurrences of all patterns within a string, including overlapping ones.
+         *
+         * @param str The string to search within.
+         *
+         * @return A vector of matches sorted by position and then by pattern index.
+         */
+        [[nodiscard]] std::vector<Match> find_all_matches(std::string_view str) const noexcept;
+
+        /**
+         * @brief Replaces the occurrences of the patterns within a string in a single pass.
+         *
+         * The string is scanned from left to right, the leftmost occurrence is replaced with the
+         * replacement of its pattern and the scan continues after the occurrence.
+         * Patterns without a corresponding replacement are replaced with an empty string.
+         *
+         * @param str The input string to perform the replacement on.
+         * @param replacements The replacements, one for each pattern.
+         * @param kind Which pattern wins when several patterns match at the same position (optional).
+         *
+         * @return A new string with the replacements made.
+         */
+        [[nodiscard]] std::string replace_many(std::string_view str, const std::vector<std::string_view>& replacements,
+                                               MatchKind kind = MatchKind::first) const noexcept;
+
+        /**
+         * @brief Replaces the occurrences of the patterns within a string in a single pass.
+         *
+         * This is an overloaded function that accepts any container of values convertible to \c std::string_view.
+         *
+         * @tparam Container The type of the container with the replacements.
+         *
+         * @param str The input string to perform the replacement on.
+         * @param replacements The replacements, one for each pattern.
+         * @param kind Which pattern wins when several patterns match at the same position (optional).
+         *
+         * @return A new string with the replacements made.
+         */
+        template <typename Container>
+        [[nodiscard]] std::string replace_many(const std::string_view str, const Container& replacements,
+                                               const MatchKind kind = MatchKind::first) const noexcept
+        {
+            return replace_many(str, std::vector<std::string_view>(std::begin(replacements), std::end(replacements)),
+                                kind);
+        }
+
+        /**
+         * @brief Returns the number of patterns.
+         *
+         * @return The number of patterns.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Returns a pattern by its index.
+         *
+         * @param index The index of the pattern.
+         *
+         * @return The pattern.
+         */
+        [[nodiscard]] std::string_view pattern(std::size_t index) const noexcept;
+
+        /**
+         * @brief Checks whether the searcher ignores case.
+         *
+         * @return \c true if the searcher was created by \ref strpy::make_multi_searcher_icase, \c false otherwise.
+         */
+        [[nodiscard]] bool icase() const noexcept;
+
+    private:
+        friend MultiSearcher make_multi_searcher(const std::vector<std::string_view>& patterns) noexcept;
+        friend MultiSearcher make_multi_searcher_icase(const std::vector<std::string_view>& patterns) noexcept;
+
+        explicit MultiSearcher(std::shared_ptr<const detail::MultiSearcherData> data) noexcept;
+
+        std::shared_ptr<const detail::MultiSearcherData> data_;
+    };
+
+    /**
+     * @brief Compiles a list of patterns into a multi-pattern searcher.
+     *
+     * @param patterns The patterns to search for.
+     *
+     * @return A searcher for \p patterns.
+     */
+    [[nodiscard]] STRINGPY_EXPORT MultiSearcher
+      make_multi_searcher(const std::vector<std::string_view>& patterns) noexcept;
+
+    /**
+     * @brief Compiles a list of patterns into a multi-pattern searcher, ignoring case.
+     *
+     * The case mapping of the current C locale is captured when the searcher is created.
+     *
+     * @param patterns The patterns to search for.
+     *
+     * @return A case-insensitive searcher for \p patterns.
+     */
+    [[nodiscard]] STRINGPY_EXPORT MultiSearcher
+      make_multi_searcher_icase(const std::vector<std::string_view>& patterns) noexcept;
+
+    /**
+     * @brief Compiles a container of patterns into a multi-pattern searcher.
+     *
+     * @tparam Container The type of the container with the patterns.
+     *
+     * @param patterns The patterns to search for.
+     *
+     * @return A searcher for \p patterns.
+     */
+    template <typename Container>
+    [[nodiscard]] MultiSearcher make_multi_searcher(const Container& patterns) noexcept
+    {
+        return make_multi_searcher(std::vector<std::string_view>(std::begin(patterns), std::end(patterns)));
+    }
+
+    /**
+     * @brief Compiles a container of patterns into a multi-pattern searcher, ignoring case.
+     *
+     * @tparam Container The type of the container with the patterns.
+     *
+     * @param patterns The patterns to search for.
+     *
+     * @return A case-insensitive searcher for \p patterns.
+     */
+    template <typename Container>
+    [[nodiscard]] MultiSearcher make_multi_searcher_icase(const Container& patterns) noexcept
+    {
+        return make_multi_searcher_icase(std::vector<std::string_view>(std::begin(patterns), std::end(patterns)));
+    }
+}
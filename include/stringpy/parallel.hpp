@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides multi-threaded versions of the search and split functions for very large strings.
+ *
+ * @example parallel.cpp
+ * Demonstrates the use of the par::count(), par::find(), and par::split_lines() functions from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include "stringpy/split.hpp"
+#include "stringpy/splitresult.hpp"
+#include <string_view>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace strpy::par
+{
+    /**
+     * @brief A unit of work, called with the index of the task.
+     */
+    using Task = std::function<void(std::size_t)>;
+
+    /**
+     * @brief Runs the tasks <tt>0 .. task_count - 1</tt>, possibly concurrently, and returns when all have finished.
+     *
+     * Any callable with this signature can be used to run the parallel functions on an existing thread pool.
+     * The tasks should be started in ascending order of their indices, which allows \ref strpy::par::find
+     * to skip the chunks after the first occurrence.
+     */
+    using Executor = std::function<void(std::size_t task_count, const Task& task)>;
+
+    /**
+     * @brief Creates an executor that runs the tasks on newly created threads.
+     *
+     * The calling thread takes part in running the tasks. If a thread cannot be created,
+     * the tasks are run by the threads that were created successfully.
+     *
+     * @param thread_count The maximum number of threads, including the calling thread (optional).
+     * If it is \c 0, the number of hardware threads is used.
+     *
+     * @return The executor.
+     */
+    [[nodiscard]] STRINGPY_EXPORT Executor make_thread_executor(std::size_t thread_count = 0) noexcept;
+
+    /**
+     * @brief Counts the number of non-overlapping occurrences of a substring within a string using several threads.
+     *
+     * The string is split into chunks which are searched concurrently. Every chunk is extended by
+     * the size of the substring minus one, so that the occurrences that cross a chunk boundary are found.
+     * The per-chunk results are merged so that the result is always equal to <tt>strpy::count(str, sub)</tt>:
+     * an occurrence counted in one chunk may overlap the beginning of the next chunk, so every chunk is also
+     * counted from the end of each occurrence that starts before it and overlaps it. These scans soon reach
+     * an occurrence of the scan from the beginning of the chunk and end there, unless the substring overlaps
+     * itself in a periodic text, such as \c "aa" in \c "aaaa", where each of them goes on to the end of the chunk.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     * @param executor The executor that runs the chunks.
+     * @param chunk_count The number of chunks (optional). If it is \c 0, a few chunks per hardware thread are used
+     * and strings that are too short to be worth splitting are searched by the calling thread.
+     *
+     * @return The number of non-overlapping occurrences of the substring.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t count(std::string_view str, std::string_view sub,
+                                                    const Executor& executor, std::size_t chunk_count = 0) noexcept;
+
+    /**
+     * @brief Counts the number of non-overlapping occurrences of a substring within a string using several threads.
+     *
+     * This is an overloaded function that runs the chunks on newly created threads.
+     * Strings that are too short to be worth splitting are searched by the calling thread.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     * @param thread_count The maximum number of threads, including the calling thread (optional).
+     * If it is \c 0, the number of hardware threads is used.
+     *
+     * @return The number of non-overlapping occurrences of the substring.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t count(std::string_view str, std::string_view sub,
+                                                    std::size_t thread_count = 0) noexcept;
+
+    /**
+     * @brief Finds the first occurrence of a substring within a string using several threads.
+     *
+     * The string is split into chunks which are searched concurrently, every chunk is extended by
+     * the size of the substring minus one. The result is always equal to <tt>strpy::find(str, sub)</tt>.
+     * Once an occurrence is found, the chunks after it are not searched.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     * @param executor The executor that runs the chunks.
+     * @param chunk_count The number of chunks (optional). If it is \c 0, a few chunks per hardware thread are used
+     * and strings that are too short to be worth splitting are searched by the calling thread.
+     *
+     * @return The index of the first occurrence of the substring, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t find(std::string_view str, std::string_view sub,
+                                                   const Executor& executor, std::size_t chunk_count = 0) noexcept;
+
+    /**
+     * @brief Finds the first occurrence of a substring within a string using several threads.
+     *
+     * This is an overloaded function that runs the chunks on newly created threads.
+     * Strings that are too short to be worth splitting are searched by the calling thread.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     * @param thread_count The maximum number of threads, including the calling thread (optional).
+     * If it is \c 0, the number of hardware threads is used.
+     *
+     * @return The index of the first occurrence of the substring, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::size_t find(std::string_view str, std::string_view sub,
+                                                   std::size_t thread_count = 0) noexcept;
+
+    /**
+     * @brief Splits a string into lines using several threads.
+     *
+     * The string is split into chunks, and the boundary between two chunks is moved forward to the start
+     * of the next line, so that every line lies within one chunk. The chunks are split concurrently,
+     * each into its own \ref strpy::SplitResult. The lines of the shards, taken in order,
+     * are equal to the lines returned by <tt>strpy::split_lines(str, keep_ends)</tt>.
+     *
+     * @param str The string to split.
+     * @param keep_ends Whether to keep the line breaks in the resulting lines.
+     * @param executor The executor that runs the chunks.
+     * @param chunk_count The number of chunks (optional). If it is \c 0, a few chunks per hardware thread are used
+     * and strings that are too short to be worth splitting are split by the calling thread.
+     *
+     * @return The lines of every chunk, in the order of the chunks. A shard may be empty.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::vector<SplitResult> split_lines(std::string_view str, bool keep_ends,
+                                                                       const Executor& executor,
+                                                                       std::size_t chunk_count = 0) noexcept;
+
+    /**
+     * @brief Splits a string into lines using several threads.
+     *
+     * This is an overloaded function that runs the chunks on newly created threads.
+     * Strings that are too short to be worth splitting are split by the calling thread into a single shard.
+     *
+     * @param str The string to split.
+     * @param keep_ends Whether to keep the line breaks in the resulting lines (optional).
+     * @param thread_count The maximum number of threads, including the calling thread (optional).
+     * If it is \c 0, the number of hardware threads is used.
+     *
+     * @return The lines of every chunk, in the order of the chunks. A shard may be empty.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::vector<SplitResult> split_lines(std::string_view str, bool keep_ends = false,
+                                                                       std::size_t thread_count = 0) noexcept;
+
+    /**
+     * @brief Splits a string into records separated by a delimiter character using several threads.
+     *
+     * The string is split into chunks, and the boundary between two chunks is moved forward past the next
+     * delimiter, so that every record lies within one chunk. The chunks are split concurrently,
+     * each into its own \ref strpy::SplitResult. The records of the shards, taken in order,
+     * are equal to the substrings returned by <tt>strpy::split(str, delimiter, options)</tt>.
+     *
+     * @param str The string to split.
+     * @param delimiter The delimiter character.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     * @param executor The executor that runs the chunks.
+     * @param chunk_count The number of chunks (optional). If it is \c 0, a few chunks per hardware thread are used
+     * and strings that are too short to be worth splitting are split by the calling thread.
+     *
+     * @return The records of every chunk, in the order of the chunks. A shard may be empty.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::vector<SplitResult> split(std::string_view str, char delimiter,
+                                                                 StringSplitOptions options, const Executor& executor,
+                                                                 std::size_t chunk_count = 0) noexcept;
+
+    /**
+     * @brief Splits a string into records separated by a delimiter character using several threads.
+     *
+     * This is an overloaded function that runs the chunks on newly created threads.
+     * Strings that are too short to be worth splitting are split by the calling thread into a single shard.
+     *
+     * @param str The string to split.
+     * @param delimiter The delimiter character.
+     * @param options A bitwise combination of StringSplitOptions values that specifies
+     * options for splitting strings (optional).
+     * @param thread_count The maximum number of threads, including the calling thread (optional).
+     * If it is \c 0, the number of hardware threads is used.
+     *
+     * @return The records of every chunk, in the order of the chunks. A shard may be empty.
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::vector<SplitResult>
+      split(std::string_view str, char delimiter, StringSplitOptions options = StringSplitOptions::none,
+            std::size_t thread_count = 0) noexcept;
+}
@@ -38,6 +38,23 @@ namespace strpy
     [[nodiscard]] STRINGPY_EXPORT std::tuple<std::string, std::string, std::string>
       partition(std::string_view str, std::string_view sep) noexcept;
 
+    /**
+     * @brief Splits a string at the first occurrence of a separator character.
+     *
+     * The string is split at the first occurrence of a separator character and a tuple is returned
+     * containing the part before the separator, the separator itself, and the part after the separator.
+     * If the separator is not found, a tuple containing the original string and two empty strings is returned.
+     *
+     * @param str The string to split.
+     * @param sep The separator character to split at.
+     *
+     * @return A tuple containing the part before the separator, the separator itself, and the part after the separator.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_partition.asp
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::tuple<std::string, std::string, std::string> partition(std::string_view str,
+                                                                                            char sep) noexcept;
+
     /**
      * @brief Splits a string at the first occurrence of a separator, ignoring case.
      *
@@ -72,6 +89,23 @@ namespace strpy
     [[nodiscard]] STRINGPY_EXPORT std::tuple<std::string, std::string, std::string>
       rpartition(std::string_view str, std::string_view sep) noexcept;
 
+    /**
+     * @brief Splits a string at the last occurrence of a separator character.
+     *
+     * The string is split at the last occurrence of a separator character and a tuple is returned
+     * containing the part before the separator, the separator itself, and the part after the separator.
+     * If the separator is not found, a tuple containing two empty strings and the original string is returned.
+     *
+     * @param str The string to split.
+     * @param sep The separator character to split at.
+     *
+     * @return A tuple containing the part before the separator, the separator itself, and the part after the separator.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_rpartition.asp
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::tuple<std::string, std::string, std::string> rpartition(std::string_view str,
+                                                                                             char sep) noexcept;
+
     /**
      * @brief Splits a string at the last occurrence of a separator, ignoring case.
      *
@@ -88,4 +122,106 @@ namespace strpy
      */
     [[nodiscard]] STRINGPY_EXPORT std::tuple<std::string, std::string, std::string>
       rpartition_icase(std::string_view str, std::string_view sep) noexcept;
+
+    /**
+     * @brief Splits a string at the first occurrence of a separator, into an existing tuple.
+     *
+     * The parts are the same as the ones returned by \ref strpy::partition with the same arguments.
+     * They are assigned to the strings of \p out, which keep their buffers, so a tuple that is reused
+     * for every line of an input stops allocating once its strings are large enough.
+     *
+     * @param out The tuple that receives the part before the separator, the separator itself,
+     * and the part after the separator.
+     * @param str The string to split.
+     * @param sep The separator to split at.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_partition.asp
+     */
+    STRINGPY_EXPORT void partition_into(std::tuple<std::string, std::string, std::string>& out, std::string_view str,
+                                        std::string_view sep) noexcept;
+
+    /**
+     * @brief Splits a string at the first occurrence of a separator character, into an existing tuple.
+     *
+     * The parts are the same as the ones returned by \ref strpy::partition with the same arguments.
+     * They are assigned to the strings of \p out, which keep their buffers, so a tuple that is reused
+     * for every line of an input stops allocating once its strings are large enough.
+     *
+     * @param out The tuple that receives the part before the separator, the separator itself,
+     * and the part after the separator.
+     * @param str The string to split.
+     * @param sep The separator character to split at.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_partition.asp
+     */
+    STRINGPY_EXPORT void partition_into(std::tuple<std::string, std::string, std::string>& out, std::string_view str,
+                                        char sep) noexcept;
+
+    /**
+     * @brief Splits a string at the first occurrence of a separator, ignoring case, into an existing tuple.
+     *
+     * The parts are the same as the ones returned by \ref strpy::partition_icase with the same arguments.
+     * They are assigned to the strings of \p out, which keep their buffers, so a tuple that is reused
+     * for every line of an input stops allocating once its strings are large enough.
+     *
+     * @param out The tuple that receives the part before the separator, the separator itself,
+     * and the part after the separator.
+     * @param str The string to split.
+     * @param sep The separator to split at.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_partition.asp
+     */
+    STRINGPY_EXPORT void partition_into_icase(std::tuple<std::string, std::string, std::string>& out,
+                                              std::string_view str, std::string_view sep) noexcept;
+
+    /**
+     * @brief Splits a string at the last occurrence of a separator, into an existing tuple.
+     *
+     * The parts are the same as the ones returned by \ref strpy::rpartition with the same arguments.
+     * They are assigned to the strings of \p out, which keep their buffers, so a tuple that is reused
+     * for every line of an input stops allocating once its strings are large enough.
+     *
+     * @param out The tuple that receives the part before the separator, the separator itself,
+     * and the part after the separator.
+     * @param str The string to split.
+     * @param sep The separator to split at.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_rpartition.asp
+     */
+    STRINGPY_EXPORT void rpartition_into(std::tuple<std::string, std::string, std::string>& out, std::string_view str,
+                                         std::string_view sep) noexcept;
+
+    /**
+     * @brief Splits a string at the last occurrence of a separator character, into an existing tuple.
+     *
+     * The parts are the same as the ones returned by \ref strpy::rpartition with the same arguments.
+     * They are assigned to the strings of \p out, which keep their buffers, so a tuple that is reused
+     * for every line of an input stops allocating once its strings are large enough.
+     *
+     * @param out The tuple that receives the part before the separator, the separator itself,
+     * and the part after the separator.
+     * @param str The string to split.
+     * @param sep The separator character to split at.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_rpartition.asp
+     */
+    STRINGPY_EXPORT void rpartition_into(std::tuple<std::string, std::string, std::string>& out, std::string_view str,
+                                         char sep) noexcept;
+
+    /**
+     * @brief Splits a string at the last occurrence of a separator, ignoring case, into an existing tuple.
+     *
+     * The parts are the same as the ones returned by \ref strpy::rpartition_icase with the same arguments.
+     * They are assigned to the strings of \p out, which keep their buffers, so a tuple that is reused
+     * for every line of an input stops allocating once its strings are large enough.
+     *
+     * @param out The tuple that receives the part before the separator, the separator itself,
+     * and the part after the separator.
+     * @param str The string to split.
+     * @param sep The separator to split at.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_rpartition.asp
+     */
+    STRINGPY_EXPORT void rpartition_into_icase(std::tuple<std::string, std::string, std::string>& out,
+                                               std::string_view str, std::string_view sep) noexcept;
 }
@@ -8,7 +8,7 @@
  * @brief Provides functions for replacing substrings within a string.
  *
  * @example replace.cpp
- * Demonstrates the use of the replace() and replace_icase() functions from the strpy namespace.
+ * Demonstrates the use of the replace(), replace_icase() and replace_inplace() functions from the strpy namespace.
  */
 
 #pragma once
@@ -26,6 +26,8 @@ namespace strpy
      * All occurrences of a substring within the input string are replaced with another substring.
      * An optional argument \p count can be used to specify the maximum number of replacements to perform.
      * If count is equal to \c std::string::npos, all occurrences are replaced.
+     * The positions of the occurrences are collected in a single pass over the input string,
+     * then the result is built with a single allocation of its exact size.
      *
      * @param str The input string to perform the replacement on.
      * @param old_value The substring to search for within the input string.
@@ -40,6 +42,27 @@ namespace strpy
                                                       std::string_view new_value,
                                                       std::size_t count = std::string::npos) noexcept;
 
+    /**
+     * @brief Replaces all occurrences of a character within a string with a substring.
+     *
+     * All occurrences of a character within the input string are replaced with a substring.
+     * An optional argument \p count can be used to specify the maximum number of replacements to perform.
+     * If count is equal to \c std::string::npos, all occurrences are replaced.
+     * The result is built in a single pass with at most one allocation.
+     *
+     * @param str The input string to perform the replacement on.
+     * @param old_value The character to search for within the input string.
+     * @param new_value The substring to replace all occurrences of \p old_value with.
+     * @param count The maximum number of replacements to perform (optional).
+     *
+     * @return A new string with the specified replacements made.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_replace.asp
+     */
+    [[nodiscard]] STRINGPY_EXPORT std::string replace(std::string_view str, char old_value,
+                                                      std::string_view new_value,
+                                                      std::size_t count = std::string::npos) noexcept;
+
     /**
      * @brief Replaces all occurrences of a substring within a string with another substring, ignoring case.
      *
@@ -59,4 +82,46 @@ namespace strpy
     [[nodiscard]] STRINGPY_EXPORT std::string replace_icase(std::string_view str, std::string_view old_value,
                                                             std::string_view new_value,
                                                             std::size_t count = std::string::npos) noexcept;
+
+    /**
+     * @brief Replaces all occurrences of a substring within a string with another substring, modifying the string.
+     *
+     * The result is the same as the one of \ref strpy::replace, but it is written to the input string.
+     * When \p new_value is not longer than \p old_value, the string is rewritten in a single pass
+     * without allocating, reusing its capacity. Otherwise, the positions of the occurrences are collected first
+     * and the string is resized once and filled from the end.
+     * \p old_value and \p new_value may be views into \p str, then they are copied before the string is modified.
+     *
+     * @param str The string to perform the replacement on.
+     * @param old_value The substring to search for within the string.
+     * @param new_value The substring to replace all occurrences of \p old_value with.
+     * @param count The maximum number of replacements to perform (optional).
+     *
+     * @return The number of replacements made.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_replace.asp
+     */
+    STRINGPY_EXPORT std::size_t replace_inplace(std::string& str, std::string_view old_value,
+                                                std::string_view new_value,
+                                                std::size_t count = std::string::npos) noexcept;
+
+    /**
+     * @brief Replaces all occurrences of a substring within a string with another substring, ignoring case,
+     * modifying the string.
+     *
+     * The result is the same as the one of \ref strpy::replace_icase, but it is written to the input string
+     * the same way as \ref strpy::replace_inplace does.
+     *
+     * @param str The string to perform the replacement on.
+     * @param old_value The substring to search for within the string.
+     * @param new_value The substring to replace all occurrences of \p old_value with.
+     * @param count The maximum number of replacements to perform (optional).
+     *
+     * @return The number of replacements made.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_replace.asp
+     */
+    STRINGPY_EXPORT std::size_t replace_inplace_icase(std::string& str, std::string_view old_value,
+                                                      std::string_view new_value,
+                                                      std::size_t count = std::string::npos) noexcept;
 }
@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a precompiled substring searcher for needles that are searched for repeatedly.
+ *
+ * @example searcher.cpp
+ * Demonstrates the use of the make_searcher() and make_searcher_icase() functions from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace strpy
+{
+    namespace detail
+    {
+        /** @private */
+        struct SearcherData;
+    }
+
+    /**
+     * @brief A substring preprocessed once and searched for many times.
+     *
+     * Created by the \ref strpy::make_searcher and \ref strpy::make_searcher_icase functions.
+     * The needle is analyzed when the searcher is created: Boyer-Moore-Horspool shift tables are built
+     * for both search directions and the rarest byte of the needle is selected as a prefilter.
+     *
+     * The preprocessed data is immutable and shared between copies, so a searcher is cheap to copy
+     * and can be used from several threads at the same time.
+     *
+     * All member functions follow the semantics of the corresponding free functions
+     * (\ref strpy::find, \ref strpy::rfind, \ref strpy::count and \ref strpy::replace).
+     */
+    class STRINGPY_EXPORT Searcher
+    {
+    public:
+        /**
+         * @brief Constructs a searcher for an empty needle.
+         */
+        Searcher() noexcept;
+
+        /**
+         * @brief Finds the first occurrence of the needle within a string.
+         *
+         * @param str The string to search within.
+         * @param start The starting position for the search (optional).
+         * @param end The ending position for the search (optional).
+         *
+         * @return The index of the first occurrence of the needle, or \c std::string_view::npos if not found.
+         */
+        [[nodiscard]] std::size_t find(std::string_view str, std::size_t start = 0,
+                                       std::size_t end = std::string_view::npos) const noexcept;
+
+        /**
+         * @brief Finds the last occurrence of the needle within a string.
+         *
+         * @param str The string to search within.
+         * @param start The starting position for the search (optional).
+         * @param end The ending position for the search (optional).
+         *
+         * @return The index of the last occurrence of the needle, or \c std::string_view::npos if not found.
+         */
+        [[nodiscard]] std::size_t rfind(std::string_view str, std::size_t start = 0,
+                                        std::size_t end = std::string_view::npos) const noexcept;
+
+        /**
+         * @brief Counts the number of non-overlapping occurrences of the needle within a string.
+         *
+         * @param str The string to search within.
+         * @param start The starting position for the search (optional).
+         * @param end The ending position for the search (optional).
+         *
+         * @return The number of non-overlapping occurrences of the needle.
+         */
+        [[nodiscard]] std::size_t count(std::string_view str, std::size_t start = 0,
+                                        std::size_t end = std::string_view::npos) const noexcept;
+
+        /**
+         * @brief Finds the positions of all non-overlapping occurrences of the needle within a string.
+         *
+         * @param str The string to search within.
+         *
+         * @return A vector with the positions of the occurrences, in ascending order.
+         */
+        [[nodiscard]] std::vector<std::size_t> find_all(std::string_view str) const noexcept;
+
+        /**
+         * @brief Replaces occurrences of the needle within a string with another substring.
+         *
+         * @param str The input string to perform the replacement on.
+         * @param new_value The substring to replace the occurrences of the needle with.
+         * @param count The maximum number of replacements to perform (optional).
+         *
+         * @return A new string with the specified replacements made.
+         */
+        [[nodiscard]] std::string replace(std::string_view str, std::string_view new_value,
+                                          std::size_t count = std::string::npos) const noexcept;
+
+        /**
+         * @brief Returns the needle the searcher was created for.
+         *
+         * @return The needle.
+         */
+        [[nodiscard]] std::string_view needle() const noexcept;
+
+        /**
+         * @brief Checks whether the searcher ignores case.
+         *
+         * @return \c true if the searcher was created by \ref strpy::make_searcher_icase, \c false otherwise.
+         */
+        [[nodiscard]] bool icase() const noexcept;
+
+    private:
+        friend Searcher make_searcher(std::string_view needle) noexcept;
+        friend Searcher make_searcher_icase(std::string_view needle) noexcept;
+
+        explicit Searcher(std::shared_ptr<const detail::SearcherData> data) noexcept;
+
+        std::shared_ptr<const detail::SearcherData> data_;
+    };
+
+    /**
+     * @brief Creates a searcher for a needle.
+     *
+     * @param needle The substring to search for.
+     *
+     * @return A searcher for \p needle.
+     */
+    [[nodiscard]] STRINGPY_EXPORT Searcher make_searcher(std::string_view needle) noexcept;
+
+    /**
+     * @brief Creates a searcher for a needle, ignoring case.
+     *
+     * The case mapping of the current C locale is captured when the searcher is created.
+     *
+     * @param needle The substring to search for.
+     *
+     * @return A case-insensitive searcher for \p needle.
+     */
+    [[nodiscard]] STRINGPY_EXPORT Searcher make_searcher_icase(std::string_view needle) noexcept;
+}
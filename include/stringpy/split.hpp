@@ -13,7 +13,9 @@
 
 #pragma once
 
+#include "stringpy/charset.hpp"
 #include "stringpy/export.hpp"
+#include "stringpy/splitresult.hpp"
 #include <string_view>
 #include <type_traits>
 #include <cstddef>
@@ -42,13 +44,372 @@ namespace strpy
         trim_remove_empty = trim | remove_empty
     };
 
+    namespace detail
+    {
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string>& result, std::string_view str,
+                                        std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string_view>& result, std::string_view str,
+                                        std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(SplitResult& result, std::string_view str, std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string>& result, std::string_view str,
+                                        const CharSet& separators, std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string_view>& result, std::string_view str,
+                                        const CharSet& separators, std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(SplitResult& result, std::string_view str, const CharSet& separators,
+                                        std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string>& result, std::string_view str,
+                                        std::string_view delimiter, std::size_t max_split,
+                                        StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string_view>& result, std::string_view str,
+                                        std::string_view delimiter, std::size_t max_split,
+                                        StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(SplitResult& result, std::string_view str, std::string_view delimiter,
+                                        std::size_t max_split, StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string>& result, std::string_view str, char delimiter,
+                                        std::size_t max_split, StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(std::vector<std::string_view>& result, std::string_view str, char delimiter,
+                                        std::size_t max_split, StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_into(SplitResult& result, std::string_view str, char delimiter,
+                                        std::size_t max_split, StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(std::vector<std::string>& result, std::string_view str,
+                                         std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(std::vector<std::string_view>& result, std::string_view str,
+                                         std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(SplitResult& result, std::string_view str, std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(std::vector<std::string>& result, std::string_view str,
+                                         const CharSet& separators, std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(std::vector<std::string_view>& result, std::string_view str,
+                                         const CharSet& separators, std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(SplitResult& result, std::string_view str, const CharSet& separators,
+                                         std::size_t max_split) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(std::vector<std::string>& result, std::string_view str,
+                                         std::string_view delimiter, std::size_t max_split,
+                                         StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(std::vector<std::string_view>& result, std::string_view str,
+                                         std::string_view delimiter, std::size_t max_split,
+                                         StringSplitOptions options) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void rsplit_into(SplitResult& result, std::string_view str, std::string_view delimiter,
+                                         std::size_t max_split, StringSplitOptions options) noexcept;
+    }
+
+    /**
+     * @brief Splits a string into substrings using any space character as delimiter, into an existing container.
+     *
+     * The substrings are the same as the ones returned by \ref strpy::split with the same arguments.
+     * The container is cleared and refilled: the strings already in a \c std::vector<std::string> are assigned
+     * in place and keep their buffers, so a container that is reused for every line of an input
+     * stops allocating once it has grown large enough.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @sa https://www.w3schools.com/python/ref_string_split.asp
+     */
+    template <typename Out>
+    void split_into(Out& out, const std::string_view str, const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::split_into(out, str, max_split);
+    }
+
+    /**
+     * @brief Splits a string into substrings using any character from a set as delimiter, into an existing container.
+     *
+     * This is an overloaded function. The substrings are the same as the ones returned by \ref strpy::split
+     * with the same arguments, the container is refilled the same way.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param separators The set of delimiter characters.
+     * @param max_split The maximum number of splits to perform (optional).
+     */
+    template <typename Out>
+    void split_into(Out& out, const std::string_view str, const CharSet& separators,
+                    const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::split_into(out, str, separators, max_split);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a specified delimiter, into an existing container.
+     *
+     * This is an overloaded function. The substrings are the same as the ones returned by \ref strpy::split
+     * with the same arguments, the container is refilled the same way.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     * @param options A bitwise combination of StringSplitOptions values that specifies
+     * options for splitting strings (optional).
+     */
+    template <typename Out>
+    void split_into(Out& out, const std::string_view str, const std::string_view delimiter,
+                    const std::size_t max_split = std::string::npos,
+                    const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::split_into(out, str, delimiter, max_split, options);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a specified delimiter, into an existing container.
+     *
+     * This is an overloaded function that splits the whole string.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     */
+    template <typename Out>
+    void split_into(Out& out, const std::string_view str, const std::string_view delimiter,
+                    const StringSplitOptions options) noexcept
+    {
+        split_into(out, str, delimiter, std::string::npos, options);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a delimiter character, into an existing container.
+     *
+     * This is an overloaded function. The substrings are the same as the ones returned by \ref strpy::split
+     * with the same arguments, the container is refilled the same way.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param max_split The maximum number of splits to perform.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     */
+    template <typename Out>
+    void split_into(Out& out, const std::string_view str, const char delimiter, const std::size_t max_split,
+                    const StringSplitOptions options) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::split_into(out, str, delimiter, max_split, options);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a delimiter character, into an existing container.
+     *
+     * This is an overloaded function. It only accepts a \c char delimiter, so that
+     * an integer passed as the third argument still selects the maximum number of splits.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     * @tparam Char The type of the delimiter, must be \c char.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     */
+    template <typename Out, typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    void split_into(Out& out, const std::string_view str, const Char delimiter,
+                    const std::size_t max_split = std::string::npos) noexcept
+    {
+        split_into(out, str, delimiter, max_split, StringSplitOptions::none);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a delimiter character, into an existing container.
+     *
+     * This is an overloaded function. It only accepts a \c char delimiter.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     * @tparam Char The type of the delimiter, must be \c char.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     */
+    template <typename Out, typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    void split_into(Out& out, const std::string_view str, const Char delimiter,
+                    const StringSplitOptions options) noexcept
+    {
+        split_into(out, str, delimiter, std::string::npos, options);
+    }
+
+    /**
+     * @brief Splits a string into substrings using any space character as delimiter,
+     * starting from the end of the string, into an existing container.
+     *
+     * The substrings are the same as the ones returned by \ref strpy::rsplit with the same arguments,
+     * the container is refilled the same way as by \ref strpy::split_into.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @sa https://www.w3schools.com/python/ref_string_rsplit.asp
+     */
+    template <typename Out>
+    void rsplit_into(Out& out, const std::string_view str, const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::rsplit_into(out, str, max_split);
+    }
+
+    /**
+     * @brief Splits a string into substrings using any character from a set as delimiter,
+     * starting from the end of the string, into an existing container.
+     *
+     * This is an overloaded function. The substrings are the same as the ones returned by \ref strpy::rsplit
+     * with the same arguments, the container is refilled the same way as by \ref strpy::split_into.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param separators The set of delimiter characters.
+     * @param max_split The maximum number of splits to perform (optional).
+     */
+    template <typename Out>
+    void rsplit_into(Out& out, const std::string_view str, const CharSet& separators,
+                     const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::rsplit_into(out, str, separators, max_split);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a specified delimiter, starting from the end of the string,
+     * into an existing container.
+     *
+     * This is an overloaded function. The substrings are the same as the ones returned by \ref strpy::rsplit
+     * with the same arguments, the container is refilled the same way as by \ref strpy::split_into.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     * @param options A bitwise combination of StringSplitOptions values that specifies
+     * options for splitting strings (optional).
+     */
+    template <typename Out>
+    void rsplit_into(Out& out, const std::string_view str, const std::string_view delimiter,
+                     const std::size_t max_split = std::string::npos,
+                     const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::rsplit_into(out, str, delimiter, max_split, options);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a specified delimiter, starting from the end of the string,
+     * into an existing container.
+     *
+     * This is an overloaded function that splits the whole string.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     */
+    template <typename Out>
+    void rsplit_into(Out& out, const std::string_view str, const std::string_view delimiter,
+                     const StringSplitOptions options) noexcept
+    {
+        rsplit_into(out, str, delimiter, std::string::npos, options);
+    }
+
     /**
      * @brief Splits a string into substrings using any space character as delimiter.
      *
      * The input string is split into substrings using any space character as delimiter.
-     * The substrings are returned as a vector of strings.
+     * As in Python, runs of space characters are a single delimiter and a string of space characters yields
+     * no substrings. The substrings are returned as a vector of strings.
      * An optional argument \p max_split can be used to specify the maximum number of splits to perform.
      * If \p max_split is equal to \c std::string::npos, all possible splits are performed.
+     * Once \p max_split splits are performed, the rest of the string without its leading space characters
+     * is the last substring.
+     *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
      *
      * @param str The input string to split.
      * @param max_split The maximum number of splits to perform (optional).
@@ -57,8 +418,50 @@ namespace strpy
      *
      * @sa https://www.w3schools.com/python/ref_string_split.asp
      */
-    [[nodiscard]] STRINGPY_EXPORT std::vector<std::string> split(std::string_view str,
-                                                                 std::size_t max_split = std::string::npos) noexcept;
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> split(const std::string_view str,
+                                                    const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        split_into(result, str, max_split);
+
+        return result;
+    }
+
+    /**
+     * @brief Splits a string into substrings using any character from a set as delimiter.
+     *
+     * The input string is split into substrings using any character from the set as delimiter,
+     * the same way the whitespace version of \ref strpy::split treats space characters:
+     * consecutive delimiters are treated as a single one and no empty substrings are returned.
+     * After the last split, the rest of the string is returned without its leading delimiters.
+     * An optional argument \p max_split can be used to specify the maximum number of splits to perform.
+     * If \p max_split is equal to \c std::string::npos, all possible splits are performed.
+     *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     *
+     * @param str The input string to split.
+     * @param separators The set of delimiter characters.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @return A vector of strings containing the substrings.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_split.asp
+     */
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> split(const std::string_view str, const CharSet& separators,
+                                                    const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        split_into(result, str, separators, max_split);
+
+        return result;
+    }
 
     /**
      * @brief Splits a string into substrings using a specified delimiter.
@@ -69,6 +472,9 @@ namespace strpy
      * If \p max_split is equal to \c std::string::npos, all possible splits are performed.
      * The behavior of the split can be controlled using the \p options parameter.
      *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     *
      * @param str The input string to split.
      * @param delimiter The delimiter used to split the string.
      * @param max_split The maximum number of splits to perform (optional).
@@ -79,9 +485,19 @@ namespace strpy
      *
      * @sa https://www.w3schools.com/python/ref_string_split.asp
      */
-    [[nodiscard]] STRINGPY_EXPORT std::vector<std::string>
-      split(std::string_view str, std::string_view delimiter, std::size_t max_split = std::string::npos,
-            StringSplitOptions options = StringSplitOptions::none) noexcept;
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret>
+      split(const std::string_view str, const std::string_view delimiter,
+            const std::size_t max_split = std::string::npos,
+            const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        split_into(result, str, delimiter, max_split, options);
+
+        return result;
+    }
 
     /**
      * @brief Splits a string into substrings using a specified delimiter.
@@ -90,6 +506,9 @@ namespace strpy
      * The substrings are returned as a vector of strings.
      * The behavior of the split can be controlled using the \p options parameter.
      *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     *
      * @param str The input string to split.
      * @param delimiter The delimiter used to split the string.
      * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
@@ -98,10 +517,93 @@ namespace strpy
      *
      * @sa https://www.w3schools.com/python/ref_string_split.asp
      */
-    [[nodiscard]] inline std::vector<std::string> split(const std::string_view str, const std::string_view delimiter,
-                                                        const StringSplitOptions options) noexcept
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> split(const std::string_view str, const std::string_view delimiter,
+                                                    const StringSplitOptions options) noexcept
+    {
+        return split<Ret>(str, delimiter, std::string::npos, options);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a delimiter character.
+     *
+     * The input string is split into substrings using the specified delimiter character,
+     * the same way \ref strpy::split splits a string using a one-character string as delimiter.
+     * The delimiter is searched for with \c memchr instead of the generic substring search.
+     * If \p max_split is equal to \c std::string::npos, all possible splits are performed.
+     *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     *
+     * @param str The input string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param max_split The maximum number of splits to perform.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     *
+     * @return A vector of strings containing the substrings.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_split.asp
+     */
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> split(const std::string_view str, const char delimiter,
+                                                    const std::size_t max_split,
+                                                    const StringSplitOptions options) noexcept
     {
-        return split(str, delimiter, std::string::npos, options);
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        split_into(result, str, delimiter, max_split, options);
+
+        return result;
+    }
+
+    /**
+     * @brief Splits a string into substrings using a delimiter character.
+     *
+     * This is an overloaded function. It only accepts a \c char delimiter, so that
+     * an integer passed as the second argument still selects the maximum number of splits.
+     *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     * @tparam Char The type of the delimiter, must be \c char.
+     *
+     * @param str The input string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @return A vector of strings containing the substrings.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_split.asp
+     */
+    template <typename Ret = std::string, typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    [[nodiscard]] detail::split_result_t<Ret> split(const std::string_view str, const Char delimiter,
+                                                    const std::size_t max_split = std::string::npos) noexcept
+    {
+        return split<Ret>(str, delimiter, max_split, StringSplitOptions::none);
+    }
+
+    /**
+     * @brief Splits a string into substrings using a delimiter character.
+     *
+     * This is an overloaded function. It only accepts a \c char delimiter.
+     *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     * @tparam Char The type of the delimiter, must be \c char.
+     *
+     * @param str The input string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     *
+     * @return A vector of strings containing the substrings.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_split.asp
+     */
+    template <typename Ret = std::string, typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    [[nodiscard]] detail::split_result_t<Ret> split(const std::string_view str, const Char delimiter,
+                                                    const StringSplitOptions options) noexcept
+    {
+        return split<Ret>(str, delimiter, std::string::npos, options);
     }
 
     /**
@@ -109,20 +611,70 @@ namespace strpy
      * starting from the end of the string.
      *
      * The input string is split into substrings using any space character as delimiter.
-     * The substrings are returned as a vector of strings.
+     * As in Python, runs of space characters are a single delimiter and a string of space characters yields
+     * no substrings. The substrings are returned as a vector of strings.
      * An optional argument \p max_split can be used to specify the maximum number of splits to perform.
      * If \p max_split is equal to \c std::string::npos, all possible splits are performed.
      * The splitting starts from the end of the string and proceeds towards the beginning.
+     * Once \p max_split splits are performed, the rest of the string without its trailing space characters
+     * is the first substring.
+     *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     *
+     * @param str The input string to split.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @return A vector of strings containing the substrings in reverse order.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_rsplit.asp
+     */
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> rsplit(const std::string_view str,
+                                                     const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        rsplit_into(result, str, max_split);
+
+        return result;
+    }
+
+    /**
+     * @brief Splits a string into substrings using any character from a set as delimiter,
+     * starting from the end of the string.
+     *
+     * The input string is split into substrings using any character from the set as delimiter,
+     * the same way the whitespace version of \ref strpy::rsplit treats space characters:
+     * consecutive delimiters are treated as a single one and no empty substrings are returned.
+     * After the last split, the rest of the string is returned without its trailing delimiters.
+     * An optional argument \p max_split can be used to specify the maximum number of splits to perform.
+     * If \p max_split is equal to \c std::string::npos, all possible splits are performed.
+     * The splitting starts from the end of the string and proceeds towards the beginning.
+     *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
      *
      * @param str The input string to split.
+     * @param separators The set of delimiter characters.
      * @param max_split The maximum number of splits to perform (optional).
      *
      * @return A vector of strings containing the substrings in reverse order.
      *
      * @sa https://www.w3schools.com/python/ref_string_rsplit.asp
      */
-    [[nodiscard]] STRINGPY_EXPORT std::vector<std::string> rsplit(std::string_view str,
-                                                                  std::size_t max_split = std::string::npos) noexcept;
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> rsplit(const std::string_view str, const CharSet& separators,
+                                                     const std::size_t max_split = std::string::npos) noexcept
+    {
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        rsplit_into(result, str, separators, max_split);
+
+        return result;
+    }
 
     /**
      * @brief Splits a string into substrings using a specified delimiter, starting from the end of the string.
@@ -134,6 +686,9 @@ namespace strpy
      * The splitting starts from the end of the string and proceeds towards the beginning.
      * The behavior of the split can be controlled using the \p options parameter.
      *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     *
      * @param str The input string to split.
      * @param delimiter The delimiter used to split the string.
      * @param max_split The maximum number of splits to perform (optional).
@@ -144,9 +699,19 @@ namespace strpy
      *
      * @sa https://www.w3schools.com/python/ref_string_rsplit.asp
      */
-    [[nodiscard]] STRINGPY_EXPORT std::vector<std::string>
-      rsplit(std::string_view str, std::string_view delimiter, std::size_t max_split = std::string::npos,
-             StringSplitOptions options = StringSplitOptions::none) noexcept;
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret>
+      rsplit(const std::string_view str, const std::string_view delimiter,
+             const std::size_t max_split = std::string::npos,
+             const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        rsplit_into(result, str, delimiter, max_split, options);
+
+        return result;
+    }
 
     /**
      * @brief Splits a string into substrings using a specified delimiter, starting from the end of the string.
@@ -156,6 +721,9 @@ namespace strpy
      * The splitting starts from the end of the string and proceeds towards the beginning.
      * The behavior of the split can be controlled using the \p options parameter.
      *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the substrings are returned in a SplitResult instead.
+     *
      * @param str The input string to split.
      * @param delimiter The delimiter used to split the string.
      * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
@@ -164,11 +732,13 @@ namespace strpy
      *
      * @sa https://www.w3schools.com/python/ref_string_rsplit.asp
      */
-    [[nodiscard]] inline std::vector<std::string> rsplit(const std::string_view str, const std::string_view delimiter,
-                                                         const StringSplitOptions options) noexcept
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> rsplit(const std::string_view str, const std::string_view delimiter,
+                                                     const StringSplitOptions options) noexcept
     {
-        return rsplit(str, delimiter, std::string::npos, options);
+        return rsplit<Ret>(str, delimiter, std::string::npos, options);
     }
+
 }
 
 /**
@@ -14,18 +14,62 @@
 #pragma once
 
 #include "stringpy/export.hpp"
+#include "stringpy/splitresult.hpp"
 #include <string_view>
 #include <string>
 #include <vector>
 
 namespace strpy
 {
+    namespace detail
+    {
+        /** @private */
+        STRINGPY_EXPORT void split_lines_into(std::vector<std::string>& result, std::string_view str,
+                                              bool keep_ends) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_lines_into(std::vector<std::string_view>& result, std::string_view str,
+                                              bool keep_ends) noexcept;
+
+        /** @private */
+        STRINGPY_EXPORT void split_lines_into(SplitResult& result, std::string_view str, bool keep_ends) noexcept;
+    }
+
+    /**
+     * @brief Splits a string into lines, into an existing container.
+     *
+     * The lines are the same as the ones returned by \ref strpy::split_lines with the same arguments.
+     * The container is cleared and refilled: the strings already in a \c std::vector<std::string> are assigned
+     * in place and keep their buffers, so a container that is reused for every chunk of an input
+     * stops allocating once it has grown large enough.
+     *
+     * @tparam Out The type of the container: \c std::vector<std::string>, \c std::vector<std::string_view>
+     * or \ref strpy::SplitResult.
+     *
+     * @param out The container to fill.
+     * @param str The input string to split.
+     * @param keep_ends If \c true, line breaks are included in the resulting lines (optional).
+     *
+     * @sa https://www.w3schools.com/python/ref_string_splitlines.asp
+     */
+    template <typename Out>
+    void split_lines_into(Out& out, const std::string_view str, const bool keep_ends = false) noexcept
+    {
+        static_assert(detail::IS_SPLIT_OUTPUT<Out>,
+                      "Out must be std::vector<std::string>, std::vector<std::string_view> or strpy::SplitResult");
+
+        detail::split_lines_into(out, str, keep_ends);
+    }
+
     /**
      * @brief Splits a string into lines.
      *
      * The input string is split into lines and returned as a vector of strings.
      * The behavior of the split can be controlled using the \p keep_ends parameter.
      *
+     * @tparam Ret The type of the elements of the returned vector, either \c std::string or \c std::string_view
+     * pointing into \p str. If it is \ref strpy::SplitResult, the lines are returned in a SplitResult instead.
+     *
      * @param str The input string to split.
      * @param keep_ends If \c true, line breaks are included in the resulting lines (optional).
      *
@@ -33,6 +77,15 @@ namespace strpy
      *
      * @sa https://www.w3schools.com/python/ref_string_splitlines.asp
      */
-    [[nodiscard]] STRINGPY_EXPORT std::vector<std::string> split_lines(std::string_view str,
-                                                                       bool keep_ends = false) noexcept;
+    template <typename Ret = std::string>
+    [[nodiscard]] detail::split_result_t<Ret> split_lines(const std::string_view str,
+                                                          const bool keep_ends = false) noexcept
+    {
+        static_assert(detail::IS_SPLIT_TYPE<Ret>, "Ret must be std::string, std::string_view or strpy::SplitResult");
+
+        detail::split_result_t<Ret> result{};
+        split_lines_into(result, str, keep_ends);
+
+        return result;
+    }
 }
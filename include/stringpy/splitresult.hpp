@@ -0,0 +1,525 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a compact container for the substrings of a split string.
+ *
+ * @example splitresult.cpp
+ * Demonstrates the use of the SplitResult class from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <string_view>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace strpy
+{
+    /**
+     * @brief A read-only sequence of substrings stored in a single buffer.
+     *
+     * The substrings are copied one after another into one string, and the end of each substring is kept
+     * in an array of 32-bit offsets. Compared to a \c std::vector<std::string>, a substring costs 4 bytes
+     * instead of 32 plus a heap block for the long ones, and iterating over the substrings reads memory in order.
+     * The elements are \c std::string_view objects pointing into the buffer of the container,
+     * they are invalidated when the container is modified or destroyed.
+     *
+     * Once the total size of the substrings passes 4 GiB, the offsets are converted to \c std::size_t.
+     */
+    class STRINGPY_EXPORT SplitResult
+    {
+    public:
+        /** @brief The type of the elements. */
+        using value_type = std::string_view;
+
+        /** @brief The size type. */
+        using size_type = std::size_t;
+
+        /** @brief The type of the distance between two iterators. */
+        using difference_type = std::ptrdiff_t;
+
+        /** @brief The reference type, the elements are returned by value. */
+        using reference = std::string_view;
+
+        /** @brief The constant reference type, the elements are returned by value. */
+        using const_reference = std::string_view;
+
+        /**
+         * @brief A random access iterator over the substrings.
+         */
+        class const_iterator
+        {
+        public:
+            /** @brief The iterator category. */
+            using iterator_category = std::random_access_iterator_tag;
+
+            /** @brief The type of the values the iterator points to. */
+            using value_type = std::string_view;
+
+            /** @brief The type of the distance between two iterators. */
+            using difference_type = std::ptrdiff_t;
+
+            /** @brief The pointer type. */
+            using pointer = void;
+
+            /** @brief The reference type, the elements are returned by value. */
+            using reference = std::string_view;
+
+            /**
+             * @brief Constructs a singular iterator.
+             */
+            const_iterator() noexcept = default;
+
+            /**
+             * @brief Returns the current substring.
+             *
+             * @return A view of the substring within the container.
+             */
+            [[nodiscard]] reference operator*() const noexcept
+            {
+                return (*result_)[index_];
+            }
+
+            /**
+             * @brief Returns the substring at an offset from the current one.
+             *
+             * @param offset The offset from the current substring.
+             *
+             * @return A view of the substring within the container.
+             */
+            [[nodiscard]] reference operator[](const difference_type offset) const noexcept
+            {
+                return (*result_)[index_ + static_cast<size_type>(offset)];
+            }
+
+            /**
+             * @brief Advances the iterator to the next substring.
+             *
+             * @return A reference to this iterator.
+             */
+            const_iterator& operator++() noexcept
+            {
+                ++index_;
+                return *this;
+            }
+
+            /**
+             * @brief Advances the iterator to the next substring.
+             *
+             * @return A copy of the iterator before it was advanced.
+             */
+            const_iterator operator++(int) noexcept
+            {
+                auto result = *this;
+                ++index_;
+                return result;
+            }
+
+            /**
+             * @brief Moves the iterator to the previous substring.
+             *
+             * @return A reference to this iterator.
+             */
+            const_iterator& operator--() noexcept
+            {
+                --index_;
+                return *this;
+            }
+
+            /**
+             * @brief Moves the iterator to the previous substring.
+             *
+             * @return A copy of the iterator before it was moved.
+             */
+            const_iterator operator--(int) noexcept
+            {
+                auto result = *this;
+                --index_;
+                return result;
+            }
+
+            /**
+             * @brief Moves the iterator by a number of substrings.
+             *
+             * @param offset The number of substrings to move by.
+             *
+             * @return A reference to this iterator.
+             */
+            const_iterator& operator+=(const difference_type offset) noexcept
+            {
+                index_ += static_cast<size_type>(offset);
+                return *this;
+            }
+
+            /**
+             * @brief Moves the iterator back by a number of substrings.
+             *
+             * @param offset The number of substrings to move back by.
+             *
+             * @return A reference to this iterator.
+             */
+            const_iterator& operator-=(const difference_type offset) noexcept
+            {
+                index_ -= static_cast<size_type>(offset);
+                return *this;
+            }
+
+            /**
+             * @brief Returns an iterator moved by a number of substrings.
+             *
+             * @param it The iterator.
+             * @param offset The number of substrings to move by.
+             *
+             * @return The moved iterator.
+             */
+            [[nodiscard]] friend const_iterator operator+(const_iterator it, const difference_type offset) noexcept
+            {
+                return it += offset;
+            }
+
+            /**
+             * @brief Returns an iterator moved by a number of substrings.
+             *
+             * @param offset The number of substrings to move by.
+             * @param it The iterator.
+             *
+             * @return The moved iterator.
+             */
+            [[nodiscard]] friend const_iterator operator+(const difference_type offset, const_iterator it) noexcept
+            {
+                return it += offset;
+            }
+
+            /**
+             * @brief Returns an iterator moved back by a number of substrings.
+             *
+             * @param it The iterator.
+             * @param offset The number of substrings to move back by.
+             *
+             * @return The moved iterator.
+             */
+            [[nodiscard]] friend const_iterator operator-(const_iterator it, const difference_type offset) noexcept
+            {
+                return it -= offset;
+            }
+
+            /**
+             * @brief Returns the distance between two iterators.
+             *
+             * @param lhs The first iterator.
+             * @param rhs The second iterator.
+             *
+             * @return The number of substrings from \p rhs to \p lhs.
+             */
+            [[nodiscard]] friend difference_type operator-(const const_iterator& lhs,
+                                                           const const_iterator& rhs) noexcept
+            {
+                return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+            }
+
+            /**
+             * @brief Checks whether two iterators point to the same substring.
+             *
+             * @param lhs The first iterator.
+             * @param rhs The second iterator.
+             *
+             * @return \c true if the iterators are equal, \c false otherwise.
+             */
+            [[nodiscard]] friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            /**
+             * @brief Checks whether two iterators point to different substrings.
+             *
+             * @param lhs The first iterator.
+             * @param rhs The second iterator.
+             *
+             * @return \c true if the iterators are not equal, \c false otherwise.
+             */
+            [[nodiscard]] friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+            {
+                return lhs.index_ != rhs.index_;
+            }
+
+            /**
+             * @brief Checks whether an iterator points to an earlier substring than another one.
+             *
+             * @param lhs The first iterator.
+             * @param rhs The second iterator.
+             *
+             * @return \c true if \p lhs is before \p rhs, \c false otherwise.
+             */
+            [[nodiscard]] friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) noexcept
+            {
+                return lhs.index_ < rhs.index_;
+            }
+
+            /**
+             * @brief Checks whether an iterator points to a later substring than another one.
+             *
+             * @param lhs The first iterator.
+             * @param rhs The second iterator.
+             *
+             * @return \c true if \p lhs is after \p rhs, \c false otherwise.
+             */
+            [[nodiscard]] friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) noexcept
+            {
+                return lhs.index_ > rhs.index_;
+            }
+
+            /**
+             * @brief Checks whether an iterator does not point to a later substring than another one.
+             *
+             * @param lhs The first iterator.
+             * @param rhs The second iterator.
+             *
+             * @return \c true if \p lhs is not after \p rhs, \c false otherwise.
+             */
+            [[nodiscard]] friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+            {
+                return lhs.index_ <= rhs.index_;
+            }
+
+            /**
+             * @brief Checks whether an iterator does not point to an earlier substring than another one.
+             *
+             * @param lhs The first iterator.
+             * @param rhs The second iterator.
+             *
+             * @return \c true if \p lhs is not before \p rhs, \c false otherwise.
+             */
+            [[nodiscard]] friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+            {
+                return lhs.index_ >= rhs.index_;
+            }
+
+        private:
+            friend class SplitResult;
+
+            const_iterator(const SplitResult* const result, const size_type index) noexcept :
+                result_(result), index_(index)
+            {
+            }
+
+            const SplitResult* result_ = nullptr;
+            size_type index_ = 0;
+        };
+
+        /** @brief The iterator type, the elements cannot be modified. */
+        using iterator = const_iterator;
+
+        /**
+         * @brief Constructs an empty container.
+         */
+        SplitResult() noexcept = default;
+
+        /**
+         * @brief Returns the number of substrings.
+         *
+         * @return The number of substrings.
+         */
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return wide_ends_.empty() ? ends_.size() : wide_ends_.size();
+        }
+
+        /**
+         * @brief Checks whether the container has no substrings.
+         *
+         * @return \c true if there are no substrings, \c false otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return ends_.empty() && wide_ends_.empty();
+        }
+
+        /**
+         * @brief Returns a substring.
+         *
+         * @param index The index of the substring, must be less than \ref size.
+         *
+         * @return A view of the substring within the container.
+         */
+        [[nodiscard]] std::string_view operator[](const size_type index) const noexcept
+        {
+            const size_type start = (0 == index) ? 0 : end_of(index - 1);
+            return std::string_view{buffer_}.substr(start, end_of(index) - start);
+        }
+
+        /**
+         * @brief Returns the first substring, the container must not be empty.
+         *
+         * @return A view of the first substring.
+         */
+        [[nodiscard]] std::string_view front() const noexcept
+        {
+            return (*this)[0];
+        }
+
+        /**
+         * @brief Returns the last substring, the container must not be empty.
+         *
+         * @return A view of the last substring.
+         */
+        [[nodiscard]] std::string_view back() const noexcept
+        {
+            return (*this)[size() - 1];
+        }
+
+        /**
+         * @brief Returns an iterator to the first substring.
+         *
+         * @return An iterator to the first substring.
+         */
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return const_iterator{this, 0};
+        }
+
+        /**
+         * @brief Returns the past-the-end iterator.
+         *
+         * @return The past-the-end iterator.
+         */
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return const_iterator{this, size()};
+        }
+
+        /**
+         * @brief Returns the buffer with all substrings one after another.
+         *
+         * @return A view of the buffer.
+         */
+        [[nodiscard]] std::string_view buffer() const noexcept
+        {
+            return buffer_;
+        }
+
+        /**
+         * @brief Reserves storage for the given number of substrings and bytes.
+         *
+         * @param count The number of substrings.
+         * @param bytes The total size of the substrings.
+         */
+        void reserve(size_type count, size_type bytes) noexcept;
+
+        /**
+         * @brief Appends a copy of a substring.
+         *
+         * @param substring The substring to append.
+         */
+        void push_back(std::string_view substring) noexcept;
+
+        /**
+         * @brief Removes all substrings, the storage is kept for reuse.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Replaces the contents with copies of the substrings in a range.
+         *
+         * The range is traversed twice, first to allocate the exact storage and then to copy the substrings.
+         *
+         * @tparam ForwardIt The type of the iterators, the elements must be convertible to \c std::string_view.
+         *
+         * @param first The iterator to the first substring.
+         * @param last The past-the-end iterator.
+         */
+        template <typename ForwardIt>
+        void assign(const ForwardIt first, const ForwardIt last) noexcept
+        {
+            size_type count = 0;
+            size_type bytes = 0;
+
+            for (auto it = first; it != last; ++it) {
+                ++count;
+                bytes += std::string_view{*it}.size();
+            }
+
+            clear();
+            reserve(count, bytes);
+
+            for (auto it = first; it != last; ++it) {
+                push_back(*it);
+            }
+        }
+
+        /**
+         * @brief Checks whether two containers hold the same substrings.
+         *
+         * @param lhs The first container.
+         * @param rhs The second container.
+         *
+         * @return \c true if the containers are equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator==(const SplitResult& lhs, const SplitResult& rhs) noexcept
+        {
+            return (lhs.ends_ == rhs.ends_) && (lhs.wide_ends_ == rhs.wide_ends_) && (lhs.buffer_ == rhs.buffer_);
+        }
+
+        /**
+         * @brief Checks whether two containers hold different substrings.
+         *
+         * @param lhs The first container.
+         * @param rhs The second container.
+         *
+         * @return \c true if the containers are not equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator!=(const SplitResult& lhs, const SplitResult& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /** @brief Returns the end of a substring in the buffer. */
+        [[nodiscard]] size_type end_of(const size_type index) const noexcept
+        {
+            return wide_ends_.empty() ? ends_[index] : wide_ends_[index];
+        }
+
+        std::string buffer_{};
+        std::vector<std::uint32_t> ends_{};
+
+        /** @brief The ends of the substrings once the buffer is larger than 4 GiB, \c ends_ is empty then. */
+        std::vector<size_type> wide_ends_{};
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Checks whether a type can be used as the result type of a split.
+         * @private
+         */
+        template <typename T>
+        constexpr bool IS_SPLIT_TYPE = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+                                       std::is_same_v<T, SplitResult>;
+
+        /**
+         * @brief Checks whether a type can be filled by the split functions that reuse the caller's storage.
+         * @private
+         */
+        template <typename T>
+        constexpr bool IS_SPLIT_OUTPUT = std::is_same_v<T, std::vector<std::string>> ||
+                                         std::is_same_v<T, std::vector<std::string_view>> ||
+                                         std::is_same_v<T, SplitResult>;
+
+        /**
+         * @brief The container returned by a split, a vector of the elements or a SplitResult.
+         * @private
+         */
+        template <typename Ret>
+        using split_result_t = std::conditional_t<std::is_same_v<Ret, SplitResult>, SplitResult, std::vector<Ret>>;
+    }
+}
@@ -0,0 +1,708 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides lazy ranges over the substrings and lines of a string.
+ *
+ * @example splitview.cpp
+ * Demonstrates the use of the split_view(), rsplit_view(), and lines_view() functions from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/charset.hpp"
+#include "stringpy/export.hpp"
+#include "stringpy/split.hpp"
+#include <string_view>
+#include <type_traits>
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+namespace strpy
+{
+    class SplitRange;
+
+    /**
+     * @brief A forward iterator over the substrings of a split string.
+     *
+     * The next substring is searched for when the iterator is advanced, so iterating over the substrings
+     * never copies the input and never allocates. The substrings are views into the split string.
+     * The iterator refers to the split string and must not outlive it.
+     */
+    class STRINGPY_EXPORT SplitIterator
+    {
+    public:
+        /** @brief The iterator category. */
+        using iterator_category = std::forward_iterator_tag;
+
+        /** @brief The type of the values the iterator points to. */
+        using value_type = std::string_view;
+
+        /** @brief The type of the distance between two iterators. */
+        using difference_type = std::ptrdiff_t;
+
+        /** @brief The pointer type. */
+        using pointer = const std::string_view*;
+
+        /** @brief The reference type. */
+        using reference = const std::string_view&;
+
+        /**
+         * @brief Constructs a past-the-end iterator.
+         */
+        SplitIterator() noexcept = default;
+
+        /**
+         * @brief Returns the current substring.
+         *
+         * @return A view of the substring within the split string.
+         */
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            return token_;
+        }
+
+        /**
+         * @brief Returns a pointer to the current substring.
+         *
+         * @return A pointer to the view of the substring within the split string.
+         */
+        [[nodiscard]] pointer operator->() const noexcept
+        {
+            return &token_;
+        }
+
+        /**
+         * @brief Advances the iterator to the next substring.
+         *
+         * @return A reference to this iterator.
+         */
+        SplitIterator& operator++() noexcept;
+
+        /**
+         * @brief Advances the iterator to the next substring.
+         *
+         * @return A copy of the iterator before it was advanced.
+         */
+        SplitIterator operator++(int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        /**
+         * @brief Checks whether two iterators point to the same substring.
+         *
+         * @param lhs The first iterator.
+         * @param rhs The second iterator.
+         *
+         * @return \c true if the iterators are equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator==(const SplitIterator& lhs, const SplitIterator& rhs) noexcept
+        {
+            return (lhs.token_.data() == rhs.token_.data()) && (lhs.next_ == rhs.next_);
+        }
+
+        /**
+         * @brief Checks whether two iterators point to different substrings.
+         *
+         * @param lhs The first iterator.
+         * @param rhs The second iterator.
+         *
+         * @return \c true if the iterators are not equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator!=(const SplitIterator& lhs, const SplitIterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class SplitRange;
+
+        explicit SplitIterator(const SplitRange& range) noexcept;
+
+        /** @brief Finds the next substring from the start of the string. */
+        void advance() noexcept;
+
+        /** @brief Finds the next substring from the end of the string. */
+        void advance_reverse() noexcept;
+
+        /** @brief Finds the next word separated by runs of separators from the start of the string. */
+        template <typename Scanner>
+        void advance_words(Scanner scanner) noexcept;
+
+        /** @brief Finds the next word separated by runs of separators from the end of the string. */
+        template <typename Scanner>
+        void advance_words_reverse(Scanner scanner) noexcept;
+
+        /** @brief Returns the position of the next delimiter at or after the given position. */
+        [[nodiscard]] std::size_t find(std::size_t pos) const noexcept;
+
+        /** @brief Returns the position of the last delimiter that ends at or before the given position. */
+        [[nodiscard]] std::size_t rfind(std::size_t end) const noexcept;
+
+        /** @brief Applies the options to a substring, returns \c false if the substring is skipped. */
+        [[nodiscard]] bool accept(std::string_view substring) noexcept;
+
+        std::string_view str_{};
+        std::string_view delimiter_{};
+        CharSet separators_{};
+        std::string_view token_{};
+        std::size_t next_ = std::string_view::npos;
+        std::size_t splits_left_ = 0;
+        StringSplitOptions options_ = StringSplitOptions::none;
+        char delimiter_byte_ = '\0';
+        bool byte_ = false;
+        bool any_of_ = false;
+        bool space_ = false;
+        bool reverse_ = false;
+    };
+
+    /**
+     * @brief A lazy forward range over the substrings of a split string.
+     *
+     * Created by the \ref strpy::split_view and \ref strpy::rsplit_view functions.
+     * The substrings are found one at a time while the range is iterated.
+     * The range refers to the split string and must not outlive it.
+     */
+    class STRINGPY_EXPORT SplitRange
+    {
+    public:
+        /** @brief The iterator type. */
+        using iterator = SplitIterator;
+
+        /** @brief The constant iterator type. */
+        using const_iterator = SplitIterator;
+
+        /**
+         * @brief Constructs a range over the substrings separated by a delimiter.
+         *
+         * @param str The string to split.
+         * @param delimiter The delimiter, an empty delimiter yields the whole string.
+         * @param max_split The maximum number of splits to perform.
+         * @param options A bitwise combination of StringSplitOptions values.
+         * @param reverse Whether the string is split from the end.
+         */
+        SplitRange(const std::string_view str, const std::string_view delimiter, const std::size_t max_split,
+                   const StringSplitOptions options, const bool reverse) noexcept :
+            str_(str), delimiter_(delimiter), max_split_(max_split), options_(options), reverse_(reverse)
+        {
+        }
+
+        /**
+         * @brief Constructs a range over the substrings separated by a delimiter character.
+         *
+         * The delimiter is searched for with \c memchr, which is faster than a one-character string
+         * or a \ref strpy::CharSet with one character.
+         *
+         * @param str The string to split.
+         * @param delimiter The delimiter character.
+         * @param max_split The maximum number of splits to perform.
+         * @param options A bitwise combination of StringSplitOptions values.
+         * @param reverse Whether the string is split from the end.
+         */
+        SplitRange(const std::string_view str, const char delimiter, const std::size_t max_split,
+                   const StringSplitOptions options, const bool reverse) noexcept :
+            str_(str), max_split_(max_split), options_(options), delimiter_byte_(delimiter), byte_(true),
+            reverse_(reverse)
+        {
+        }
+
+        /**
+         * @brief Constructs a range over the words separated by runs of space characters.
+         *
+         * The words are the substrings of the whitespace version of \ref strpy::split.
+         *
+         * @param str The string to split.
+         * @param max_split The maximum number of splits to perform.
+         * @param reverse Whether the string is split from the end.
+         */
+        SplitRange(const std::string_view str, const std::size_t max_split, const bool reverse) noexcept :
+            str_(str), max_split_(max_split), options_(StringSplitOptions::remove_empty), space_(true),
+            reverse_(reverse)
+        {
+        }
+
+        /**
+         * @brief Constructs a range over the words separated by runs of characters from a set.
+         *
+         * The words are the substrings of the \ref strpy::CharSet version of \ref strpy::split.
+         *
+         * @param str The string to split.
+         * @param separators The set of delimiter characters.
+         * @param max_split The maximum number of splits to perform.
+         * @param reverse Whether the string is split from the end.
+         */
+        SplitRange(const std::string_view str, const CharSet& separators, const std::size_t max_split,
+                   const bool reverse) noexcept :
+            str_(str), separators_(separators), max_split_(max_split), options_(StringSplitOptions::remove_empty),
+            any_of_(true), reverse_(reverse)
+        {
+        }
+
+        /**
+         * @brief Returns an iterator to the first substring.
+         *
+         * @return An iterator to the first substring, or \ref end if there are no substrings.
+         */
+        [[nodiscard]] SplitIterator begin() const noexcept
+        {
+            return SplitIterator{*this};
+        }
+
+        /**
+         * @brief Returns the past-the-end iterator.
+         *
+         * @return The past-the-end iterator.
+         */
+        [[nodiscard]] SplitIterator end() const noexcept
+        {
+            return SplitIterator{};
+        }
+
+        /**
+         * @brief Checks whether there are no substrings.
+         *
+         * @return \c true if the split yields no substrings, \c false otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return begin() == end();
+        }
+
+    private:
+        friend class SplitIterator;
+
+        std::string_view str_;
+        std::string_view delimiter_{};
+        CharSet separators_{};
+        std::size_t max_split_;
+        StringSplitOptions options_;
+        char delimiter_byte_ = '\0';
+        bool byte_ = false;
+        bool any_of_ = false;
+        bool space_ = false;
+        bool reverse_;
+    };
+
+    /**
+     * @brief A forward iterator over the lines of a string.
+     *
+     * The next line break is searched for when the iterator is advanced, so iterating over the lines
+     * never copies the input and never allocates. The lines are views into the split string.
+     * The iterator refers to the split string and must not outlive it.
+     */
+    class STRINGPY_EXPORT LineIterator
+    {
+    public:
+        /** @brief The iterator category. */
+        using iterator_category = std::forward_iterator_tag;
+
+        /** @brief The type of the values the iterator points to. */
+        using value_type = std::string_view;
+
+        /** @brief The type of the distance between two iterators. */
+        using difference_type = std::ptrdiff_t;
+
+        /** @brief The pointer type. */
+        using pointer = const std::string_view*;
+
+        /** @brief The reference type. */
+        using reference = const std::string_view&;
+
+        /**
+         * @brief Constructs a past-the-end iterator.
+         */
+        LineIterator() noexcept = default;
+
+        /**
+         * @brief Returns the current line.
+         *
+         * @return A view of the line within the split string.
+         */
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            return line_;
+        }
+
+        /**
+         * @brief Returns a pointer to the current line.
+         *
+         * @return A pointer to the view of the line within the split string.
+         */
+        [[nodiscard]] pointer operator->() const noexcept
+        {
+            return &line_;
+        }
+
+        /**
+         * @brief Advances the iterator to the next line.
+         *
+         * @return A reference to this iterator.
+         */
+        LineIterator& operator++() noexcept;
+
+        /**
+         * @brief Advances the iterator to the next line.
+         *
+         * @return A copy of the iterator before it was advanced.
+         */
+        LineIterator operator++(int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        /**
+         * @brief Checks whether two iterators point to the same line.
+         *
+         * @param lhs The first iterator.
+         * @param rhs The second iterator.
+         *
+         * @return \c true if the iterators are equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator==(const LineIterator& lhs, const LineIterator& rhs) noexcept
+        {
+            return lhs.line_.data() == rhs.line_.data();
+        }
+
+        /**
+         * @brief Checks whether two iterators point to different lines.
+         *
+         * @param lhs The first iterator.
+         * @param rhs The second iterator.
+         *
+         * @return \c true if the iterators are not equal, \c false otherwise.
+         */
+        [[nodiscard]] friend bool operator!=(const LineIterator& lhs, const LineIterator& rhs) noexcept
+        {
+            return lhs.line_.data() != rhs.line_.data();
+        }
+
+    private:
+        friend class LinesRange;
+
+        LineIterator(std::string_view str, bool keep_ends) noexcept;
+
+        std::string_view str_{};
+        std::string_view line_{};
+        std::size_t next_ = 0;
+        bool keep_ends_ = false;
+    };
+
+    /**
+     * @brief A lazy forward range over the lines of a string.
+     *
+     * Created by the \ref strpy::lines_view function.
+     * The lines are found one at a time while the range is iterated.
+     * The range refers to the split string and must not outlive it.
+     */
+    class STRINGPY_EXPORT LinesRange
+    {
+    public:
+        /** @brief The iterator type. */
+        using iterator = LineIterator;
+
+        /** @brief The constant iterator type. */
+        using const_iterator = LineIterator;
+
+        /**
+         * @brief Constructs a range over the lines of a string.
+         *
+         * @param str The string to split.
+         * @param keep_ends Whether the line breaks are included in the lines.
+         */
+        LinesRange(const std::string_view str, const bool keep_ends) noexcept : str_(str), keep_ends_(keep_ends) {}
+
+        /**
+         * @brief Returns an iterator to the first line.
+         *
+         * @return An iterator to the first line, or \ref end if there are no lines.
+         */
+        [[nodiscard]] LineIterator begin() const noexcept
+        {
+            return LineIterator{str_, keep_ends_};
+        }
+
+        /**
+         * @brief Returns the past-the-end iterator.
+         *
+         * @return The past-the-end iterator.
+         */
+        [[nodiscard]] LineIterator end() const noexcept
+        {
+            return LineIterator{};
+        }
+
+        /**
+         * @brief Checks whether there are no lines.
+         *
+         * @return \c true if the string is empty, \c false otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return str_.empty();
+        }
+
+    private:
+        std::string_view str_;
+        bool keep_ends_;
+    };
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by any space character.
+     *
+     * The range yields the same substrings as the whitespace version of \ref strpy::split.
+     *
+     * @param str The string to split.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @return A forward range of views of the substrings.
+     */
+    [[nodiscard]] inline SplitRange split_view(const std::string_view str,
+                                               const std::size_t max_split = std::string::npos) noexcept
+    {
+        return SplitRange{str, max_split, false};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by any character from a set.
+     *
+     * The range yields the same substrings as the \ref strpy::CharSet version of \ref strpy::split.
+     *
+     * @param str The string to split.
+     * @param separators The set of delimiter characters.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @return A forward range of views of the substrings.
+     */
+    [[nodiscard]] inline SplitRange split_view(const std::string_view str, const CharSet& separators,
+                                               const std::size_t max_split = std::string::npos) noexcept
+    {
+        return SplitRange{str, separators, max_split, false};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter.
+     *
+     * The range yields the same substrings as \ref strpy::split with the same arguments.
+     *
+     * @param str The string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     * @param options A bitwise combination of StringSplitOptions values that specifies
+     * options for splitting strings (optional).
+     *
+     * @return A forward range of views of the substrings.
+     */
+    [[nodiscard]] inline SplitRange split_view(const std::string_view str, const std::string_view delimiter,
+                                               const std::size_t max_split = std::string::npos,
+                                               const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        return SplitRange{str, delimiter, max_split, options, false};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter.
+     *
+     * This is an overloaded function that splits the whole string.
+     *
+     * @param str The string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     *
+     * @return A forward range of views of the substrings.
+     */
+    [[nodiscard]] inline SplitRange split_view(const std::string_view str, const std::string_view delimiter,
+                                               const StringSplitOptions options) noexcept
+    {
+        return SplitRange{str, delimiter, std::string::npos, options, false};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter character.
+     *
+     * The range yields the same substrings as \ref strpy::split with the same arguments.
+     * It only accepts a \c char delimiter, so that an integer passed as the second argument
+     * still selects the maximum number of splits.
+     *
+     * @tparam Char The type of the delimiter, must be \c char.
+     * @param str The string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     * @param options A bitwise combination of StringSplitOptions values that specifies
+     * options for splitting strings (optional).
+     *
+     * @return A forward range of views of the substrings.
+     */
+    template <typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    [[nodiscard]] SplitRange split_view(const std::string_view str, const Char delimiter,
+                                        const std::size_t max_split = std::string::npos,
+                                        const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        return SplitRange{str, static_cast<char>(delimiter), max_split, options, false};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter character.
+     *
+     * This is an overloaded function that splits the whole string. It only accepts a \c char delimiter.
+     *
+     * @tparam Char The type of the delimiter, must be \c char.
+     * @param str The string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     *
+     * @return A forward range of views of the substrings.
+     */
+    template <typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    [[nodiscard]] SplitRange split_view(const std::string_view str, const Char delimiter,
+                                        const StringSplitOptions options) noexcept
+    {
+        return SplitRange{str, static_cast<char>(delimiter), std::string::npos, options, false};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by any space character,
+     * starting from the end of the string.
+     *
+     * The range yields the substrings of the whitespace version of \ref strpy::rsplit
+     * in reverse order, the last substring of the string comes first.
+     *
+     * @param str The string to split.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @return A forward range of views of the substrings, from the end of the string.
+     */
+    [[nodiscard]] inline SplitRange rsplit_view(const std::string_view str,
+                                                const std::size_t max_split = std::string::npos) noexcept
+    {
+        return SplitRange{str, max_split, true};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by any character from a set,
+     * starting from the end of the string.
+     *
+     * The range yields the substrings of the \ref strpy::CharSet version of \ref strpy::rsplit
+     * in reverse order, the last substring of the string comes first.
+     *
+     * @param str The string to split.
+     * @param separators The set of delimiter characters.
+     * @param max_split The maximum number of splits to perform (optional).
+     *
+     * @return A forward range of views of the substrings, from the end of the string.
+     */
+    [[nodiscard]] inline SplitRange rsplit_view(const std::string_view str, const CharSet& separators,
+                                                const std::size_t max_split = std::string::npos) noexcept
+    {
+        return SplitRange{str, separators, max_split, true};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter,
+     * starting from the end of the string.
+     *
+     * The range yields the substrings of \ref strpy::rsplit with the same arguments
+     * in reverse order, the last substring of the string comes first.
+     *
+     * @param str The string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     * @param options A bitwise combination of StringSplitOptions values that specifies
+     * options for splitting strings (optional).
+     *
+     * @return A forward range of views of the substrings, from the end of the string.
+     */
+    [[nodiscard]] inline SplitRange rsplit_view(const std::string_view str, const std::string_view delimiter,
+                                                const std::size_t max_split = std::string::npos,
+                                                const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        return SplitRange{str, delimiter, max_split, options, true};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter,
+     * starting from the end of the string.
+     *
+     * This is an overloaded function that splits the whole string.
+     *
+     * @param str The string to split.
+     * @param delimiter The delimiter used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     *
+     * @return A forward range of views of the substrings, from the end of the string.
+     */
+    [[nodiscard]] inline SplitRange rsplit_view(const std::string_view str, const std::string_view delimiter,
+                                                const StringSplitOptions options) noexcept
+    {
+        return SplitRange{str, delimiter, std::string::npos, options, true};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter character,
+     * starting from the end of the string.
+     *
+     * The range yields the substrings of \ref strpy::rsplit with the same arguments, the delimiter
+     * being a one-character string, in reverse order. It only accepts a \c char delimiter,
+     * so that an integer passed as the second argument still selects the maximum number of splits.
+     *
+     * @tparam Char The type of the delimiter, must be \c char.
+     * @param str The string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param max_split The maximum number of splits to perform (optional).
+     * @param options A bitwise combination of StringSplitOptions values that specifies
+     * options for splitting strings (optional).
+     *
+     * @return A forward range of views of the substrings, from the end of the string.
+     */
+    template <typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    [[nodiscard]] SplitRange rsplit_view(const std::string_view str, const Char delimiter,
+                                         const std::size_t max_split = std::string::npos,
+                                         const StringSplitOptions options = StringSplitOptions::none) noexcept
+    {
+        return SplitRange{str, static_cast<char>(delimiter), max_split, options, true};
+    }
+
+    /**
+     * @brief Returns a lazy range over the substrings of a string split by a delimiter character,
+     * starting from the end of the string.
+     *
+     * This is an overloaded function that splits the whole string. It only accepts a \c char delimiter.
+     *
+     * @tparam Char The type of the delimiter, must be \c char.
+     * @param str The string to split.
+     * @param delimiter The delimiter character used to split the string.
+     * @param options A bitwise combination of StringSplitOptions values that specifies options for splitting strings.
+     *
+     * @return A forward range of views of the substrings, from the end of the string.
+     */
+    template <typename Char, typename = std::enable_if_t<std::is_same_v<Char, char>>>
+    [[nodiscard]] SplitRange rsplit_view(const std::string_view str, const Char delimiter,
+                                         const StringSplitOptions options) noexcept
+    {
+        return SplitRange{str, static_cast<char>(delimiter), std::string::npos, options, true};
+    }
+
+    /**
+     * @brief Returns a lazy range over the lines of a string.
+     *
+     * The range yields the same lines as \ref strpy::split_lines with the same arguments.
+     * A line break is either \c "\r", \c "\n" or \c "\r\n".
+     *
+     * @param str The string to split.
+     * @param keep_ends If \c true, line breaks are included in the resulting lines (optional).
+     *
+     * @return A forward range of views of the lines.
+     */
+    [[nodiscard]] inline LinesRange lines_view(const std::string_view str, const bool keep_ends = false) noexcept
+    {
+        return LinesRange{str, keep_ends};
+    }
+}
@@ -15,23 +15,37 @@
 
 #include "stringpy/capitalize.hpp"
 #include "stringpy/center.hpp"
+#include "stringpy/charset.hpp"
 #include "stringpy/const.hpp"
 #include "stringpy/count.hpp"
+#include "stringpy/cpu.hpp"
+#include "stringpy/csv.hpp"
 #include "stringpy/ctype.hpp"
 #include "stringpy/endswith.hpp"
 #include "stringpy/equal.hpp"
 #include "stringpy/expandtabs.hpp"
 #include "stringpy/find.hpp"
+#include "stringpy/findall.hpp"
 #include "stringpy/format.hpp"
+#include "stringpy/formattemplate.hpp"
 #include "stringpy/join.hpp"
 #include "stringpy/just.hpp"
+#include "stringpy/lineindex.hpp"
+#include "stringpy/linereader.hpp"
+#include "stringpy/mappedfile.hpp"
+#include "stringpy/multisearcher.hpp"
+#include "stringpy/parallel.hpp"
 #include "stringpy/partition.hpp"
 #include "stringpy/replace.hpp"
+#include "stringpy/searcher.hpp"
 #include "stringpy/split.hpp"
 #include "stringpy/splitlines.hpp"
+#include "stringpy/splitresult.hpp"
+#include "stringpy/splitview.hpp"
 #include "stringpy/startswith.hpp"
 #include "stringpy/strip.hpp"
 #include "stringpy/stype.hpp"
 #include "stringpy/swapcase.hpp"
 #include "stringpy/title.hpp"
+#include "stringpy/tochars.hpp"
 #include "stringpy/translate.hpp"
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include "stringpy/charset.hpp"
 #include "stringpy/const.hpp"
 #include <string_view>
 #include <string>
@@ -24,19 +25,18 @@ namespace strpy
      *
      * Returns a new string with leading characters removed from the input string.
      * The characters to be removed are specified in the \p chars parameter.
-     * If \p chars is not provided, the function removes leading whitespace characters by default.
      *
      * @tparam Ret The type of the returned value. Must be either \c std::string or \c std::string_view.
      *
      * @param str The string to remove leading characters from.
-     * @param chars The characters to remove (optional).
+     * @param chars The characters to remove.
      *
      * @return A new string with the leading characters removed.
      *
      * @sa https://www.w3schools.com/python/ref_string_lstrip.asp
      */
     template <typename Ret = std::string>
-    [[nodiscard]] Ret lstrip(const std::string_view str, const std::string_view chars = SPACE_CHARS) noexcept
+    [[nodiscard]] Ret lstrip(const std::string_view str, const std::string_view chars) noexcept
     {
         static_assert(std::is_same_v<Ret, std::string> || std::is_same_v<Ret, std::string_view>,
                       "Return type must be either std::string or std::string_view");
@@ -55,6 +55,42 @@ namespace strpy
         }
     }
 
+    /**
+     * @brief Removes leading characters from a string.
+     *
+     * Returns a new string with leading characters removed from the input string.
+     * The characters to be removed are specified by the \p chars set.
+     * If \p chars is not provided, the function removes leading whitespace characters by default.
+     *
+     * @tparam Ret The type of the returned value. Must be either \c std::string or \c std::string_view.
+     *
+     * @param str The string to remove leading characters from.
+     * @param chars The set of characters to remove (optional).
+     *
+     * @return A new string with the leading characters removed.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_lstrip.asp
+     */
+    template <typename Ret = std::string>
+    [[nodiscard]] Ret lstrip(const std::string_view str, const CharSet& chars = SPACE_SET) noexcept
+    {
+        static_assert(std::is_same_v<Ret, std::string> || std::is_same_v<Ret, std::string_view>,
+                      "Return type must be either std::string or std::string_view");
+
+        std::size_t pos = 0;
+
+        while ((pos < str.size()) && chars.contains(str[pos])) {
+            ++pos;
+        }
+
+        if constexpr (std::is_same_v<Ret, std::string>) {
+            return std::string{str.substr(pos)};
+        }
+        else {
+            return str.substr(pos);
+        }
+    }
+
     /**
      * @brief Removes leading occurrences of a character from a string.
      *
@@ -80,19 +116,18 @@ namespace strpy
      *
      * Returns a new string with trailing characters removed from the input string.
      * The characters to be removed are specified in the \p chars parameter.
-     * If \p chars is not provided, the function removes trailing whitespace characters by default.
      *
      * @tparam Ret The type of the returned value. Must be either \c std::string or \c std::string_view.
      *
      * @param str The string to remove trailing characters from.
-     * @param chars The characters to remove (optional).
+     * @param chars The characters to remove.
      *
      * @return A new string with the trailing characters removed.
      *
      * @sa https://www.w3schools.com/python/ref_string_rstrip.asp
      */
     template <typename Ret = std::string>
-    [[nodiscard]] Ret rstrip(const std::string_view str, const std::string_view chars = SPACE_CHARS) noexcept
+    [[nodiscard]] Ret rstrip(const std::string_view str, const std::string_view chars) noexcept
     {
         static_assert(std::is_same_v<Ret, std::string> || std::is_same_v<Ret, std::string_view>,
                       "Return type must be either std::string or std::string_view");
@@ -111,6 +146,42 @@ namespace strpy
         }
     }
 
+    /**
+     * @brief Removes trailing characters from a string.
+     *
+     * Returns a new string with trailing characters removed from the input string.
+     * The characters to be removed are specified by the \p chars set.
+     * If \p chars is not provided, the function removes trailing whitespace characters by default.
+     *
+     * @tparam Ret The type of the returned value. Must be either \c std::string or \c std::string_view.
+     *
+     * @param str The string to remove trailing characters from.
+     * @param chars The set of characters to remove (optional).
+     *
+     * @return A new string with the trailing characters removed.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_rstrip.asp
+     */
+    template <typename Ret = std::string>
+    [[nodiscard]] Ret rstrip(const std::string_view str, const CharSet& chars = SPACE_SET) noexcept
+    {
+        static_assert(std::is_same_v<Ret, std::string> || std::is_same_v<Ret, std::string_view>,
+                      "Return type must be either std::string or std::string_view");
+
+        auto size = str.size();
+
+        while ((size != 0) && chars.contains(str[size - 1])) {
+            --size;
+        }
+
+        if constexpr (std::is_same_v<Ret, std::string>) {
+            return std::string{str.substr(0, size)};
+        }
+        else {
+            return str.substr(0, size);
+        }
+    }
+
     /**
      * @brief Removes trailing occurrences of a character from a string.
      *
@@ -156,19 +227,40 @@ namespace strpy
      *
      * Returns a new string with leading and trailing characters removed from the input string.
      * The characters to be removed are specified in the \p chars parameter.
+     *
+     * @tparam Ret The type of the returned value. Must be either \c std::string or \c std::string_view.
+     *
+     * @param str The string to remove leading and trailing characters from.
+     * @param chars The characters to remove.
+     *
+     * @return A new string with the leading and trailing characters removed.
+     *
+     * @sa https://www.w3schools.com/python/ref_string_strip.asp
+     */
+    template <typename Ret = std::string>
+    [[nodiscard]] Ret strip(const std::string_view str, const std::string_view chars) noexcept
+    {
+        return rstrip<Ret>(lstrip<std::string_view>(str, chars), chars);
+    }
+
+    /**
+     * @brief Removes leading and trailing characters from a string.
+     *
+     * Returns a new string with leading and trailing characters removed from the input string.
+     * The characters to be removed are specified by the \p chars set.
      * If \p chars is not provided, the function removes leading and trailing whitespace characters by default.
      *
      * @tparam Ret The type of the returned value. Must be either \c std::string or \c std::string_view.
      *
      * @param str The string to remove leading and trailing characters from.
-     * @param chars The characters to remove (optional).
+     * @param chars The set of characters to remove (optional).
      *
      * @return A new string with the leading and trailing characters removed.
      *
      * @sa https://www.w3schools.com/python/ref_string_strip.asp
      */
     template <typename Ret = std::string>
-    [[nodiscard]] Ret strip(const std::string_view str, const std::string_view chars = SPACE_CHARS) noexcept
+    [[nodiscard]] Ret strip(const std::string_view str, const CharSet& chars = SPACE_SET) noexcept
     {
         return rstrip<Ret>(lstrip<std::string_view>(str, chars), chars);
     }
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Provides a function for writing the characters of a number.
+ *
+ * @example tochars.cpp
+ * Demonstrates the use of the to_chars() function from the strpy namespace.
+ */
+
+#pragma once
+
+#include "stringpy/export.hpp"
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace strpy
+{
+    /** @brief The maximum number of characters written by \ref strpy::to_chars. */
+    inline constexpr std::size_t TO_CHARS_MAX_SIZE = 64;
+}
+
+namespace strpy::detail
+{
+    /**
+     * @brief A constant that checks if a type is written as a number by \ref strpy::to_chars.
+     *
+     * The arithmetic types other than \c bool and the character types of a string are numbers.
+     *
+     * @tparam T The type to check.
+     * @private
+     */
+    template <typename T>
+    inline constexpr bool IS_NUMBER =
+      std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+      !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> &&
+      (std::is_floating_point_v<T> || (sizeof(T) <= sizeof(std::uint64_t)));
+
+    /** @private */
+    [[nodiscard]] STRINGPY_EXPORT char* write_signed(char* first, std::int64_t value) noexcept;
+
+    /** @private */
+    [[nodiscard]] STRINGPY_EXPORT char* write_unsigned(char* first, std::uint64_t value) noexcept;
+
+    /** @private */
+    [[nodiscard]] STRINGPY_EXPORT char* write_float(char* first, float value) noexcept;
+
+    /** @private */
+    [[nodiscard]] STRINGPY_EXPORT char* write_float(char* first, double value) noexcept;
+
+    /** @private */
+    [[nodiscard]] STRINGPY_EXPORT char* write_float(char* first, long double value) noexcept;
+}
+
+namespace strpy
+{
+    /**
+     * @brief Writes the characters of a number.
+     *
+     * Integers are written in decimal, two digits at a time from a table of digit pairs.
+     *
+     * Floating-point numbers are written with the fewest significant digits that read back
+     * as the same value, as Python's \c repr does, but without a trailing <tt>".0"</tt>:
+     * <tt>100.0</tt> is written as \c "100", <tt>0.1</tt> as \c "0.1" and <tt>1e20</tt> as \c "1e+20".
+     * The fixed notation is used for the decimal exponents from -4 to 15, the scientific notation otherwise.
+     * Infinities and NaN are written as \c "inf", \c "-inf" and \c "nan".
+     *
+     * The output does not depend on the locale and does not allocate memory.
+     *
+     * @tparam T The type of the number, an arithmetic type other than \c bool and the character types.
+     *
+     * @param first The start of the buffer to write to, at least \ref TO_CHARS_MAX_SIZE characters long.
+     * @param value The number to write.
+     *
+     * @return The pointer past the last written character.
+     */
+    template <typename T, std::enable_if_t<detail::IS_NUMBER<T>, int> = 0>
+    [[nodiscard]] char* to_chars(char* const first, const T value) noexcept
+    {
+        if constexpr (std::is_floating_point_v<T>) {
+            return detail::write_float(first, value);
+        }
+        else if constexpr (std::is_signed_v<T>) {
+            return detail::write_signed(first, static_cast<std::int64_t>(value));
+        }
+        else {
+            return detail::write_unsigned(first, static_cast<std::uint64_t>(value));
+        }
+    }
+}
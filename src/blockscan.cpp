@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "blockscan.hpp"
+#include "stringpy/cpu.hpp"
+
+namespace
+{
+    using CharType = std::string_view::value_type;
+
+    /** @brief Classifies the bytes one at a time */
+    template <std::size_t Count>
+    std::uint32_t equal_mask_scalar(const CharType* const data, const std::size_t size,
+                                    const std::array<CharType, Count>& bytes) noexcept
+    {
+        std::uint32_t mask = 0;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            for (const auto byte : bytes) {
+                if (byte == data[i]) {
+                    mask |= std::uint32_t{1} << i;
+                }
+            }
+        }
+
+        return mask;
+    }
+
+#ifdef STRINGPY_X86
+    /** @brief Returns the movemask of the bytes of 16 bytes that are equal to any of the given bytes */
+    template <std::size_t Count>
+    STRINGPY_TARGET_SSE42 std::uint32_t equal_bits_sse42(const __m128i block,
+                                                         const std::array<CharType, Count>& bytes) noexcept
+    {
+        auto equal = _mm_setzero_si128();
+
+        for (const auto byte : bytes) {
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi8(block, _mm_set1_epi8(byte)));
+        }
+
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+    }
+
+    /** @brief Classifies 32 bytes as two halves of 16 bytes */
+    template <std::size_t Count>
+    STRINGPY_TARGET_SSE42 STRINGPY_FLATTEN std::uint32_t
+      equal_mask_sse42(const CharType* const data, const std::array<CharType, Count>& bytes) noexcept
+    {
+        constexpr unsigned half_size = 16;
+        const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); // NOLINT
+        const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + half_size)); // NOLINT
+
+        return equal_bits_sse42(low, bytes) | (equal_bits_sse42(high, bytes) << half_size);
+    }
+
+    /** @brief Classifies 32 bytes at once */
+    template <std::size_t Count>
+    STRINGPY_TARGET_AVX2 std::uint32_t equal_mask_avx2(const CharType* const data,
+                                                       const std::array<CharType, Count>& bytes) noexcept
+    {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); // NOLINT
+        auto equal = _mm256_setzero_si256();
+
+        for (const auto byte : bytes) {
+            equal = _mm256_or_si256(equal, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(byte)));
+        }
+
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+    }
+#endif
+}
+
+namespace strpy::detail
+{
+    template <std::size_t Count>
+    std::uint32_t equal_mask(const CharType* const data, const std::size_t size,
+                             const std::array<CharType, Count>& bytes) noexcept
+    {
+        // A partial block can only be the last one of a string, it is not worth copying it into a full one
+        if (size < BLOCK_SIZE) {
+            return equal_mask_scalar(data, size, bytes);
+        }
+
+        switch (simd_level()) {
+#ifdef STRINGPY_X86
+            case SimdLevel::avx2:
+                return equal_mask_avx2(data, bytes);
+            case SimdLevel::sse42:
+                return equal_mask_sse42(data, bytes);
+#endif
+            default:
+                return equal_mask_scalar(data, size, bytes);
+        }
+    }
+
+    template std::uint32_t equal_mask(const CharType* data, std::size_t size,
+                                      const std::array<CharType, 1>& bytes) noexcept;
+
+    template std::uint32_t equal_mask(const CharType* data, std::size_t size,
+                                      const std::array<CharType, 2>& bytes) noexcept;
+
+    template std::uint32_t equal_mask(const CharType* data, std::size_t size,
+                                      const std::array<CharType, 6>& bytes) noexcept;
+}
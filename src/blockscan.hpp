@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal block classifier and block scanner shared by the line, CSV and whitespace scanners.
+ */
+
+#pragma once
+
+#include "simd.hpp"
+#include <string_view>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace strpy::detail
+{
+    /** @brief The number of bytes classified by a single call of \ref equal_mask. */
+    constexpr std::size_t BLOCK_SIZE = 32;
+
+    /**
+     * @brief Classifies a block of bytes into a bitmask of the bytes equal to any of a few given bytes.
+     *
+     * A full block is compared with vector comparisons depending on \ref strpy::simd_level,
+     * a shorter one byte by byte. Instantiated for 1, 2 and 6 bytes.
+     *
+     * @tparam Count The number of bytes to compare with.
+     *
+     * @param data The bytes to classify.
+     * @param size The number of bytes, at most \ref BLOCK_SIZE.
+     * @param bytes The bytes to compare with.
+     *
+     * @return A mask with bit i set if the byte data[i] is equal to one of \p bytes.
+     */
+    template <std::size_t Count>
+    [[nodiscard]] std::uint32_t equal_mask(const std::string_view::value_type* data, std::size_t size,
+                                           const std::array<std::string_view::value_type, Count>& bytes) noexcept;
+
+    /** @private */
+    extern template std::uint32_t equal_mask(const std::string_view::value_type* data, std::size_t size,
+                                             const std::array<std::string_view::value_type, 1>& bytes) noexcept;
+
+    /** @private */
+    extern template std::uint32_t equal_mask(const std::string_view::value_type* data, std::size_t size,
+                                             const std::array<std::string_view::value_type, 2>& bytes) noexcept;
+
+    /** @private */
+    extern template std::uint32_t equal_mask(const std::string_view::value_type* data, std::size_t size,
+                                             const std::array<std::string_view::value_type, 6>& bytes) noexcept;
+
+    /**
+     * @brief Finds, one after another, the bytes of a string that are selected by a classifier.
+     *
+     * The string is classified block by block as the bytes are requested, and the bytes within a block
+     * are found with bit scans of its mask. Only the last block of the string may be shorter than
+     * \ref BLOCK_SIZE. The scanner refers to the string and must not outlive it.
+     *
+     * @tparam Classifier A function object that returns the mask of the selected bytes of a block
+     * from the pointer to the block and its size, such as a call of \ref equal_mask.
+     */
+    template <typename Classifier>
+    class BlockScanner
+    {
+    public:
+        /**
+         * @brief Constructs a scanner over a string.
+         *
+         * @param str The string to scan.
+         * @param classifier The classifier of the blocks.
+         */
+        BlockScanner(const std::string_view str, const Classifier& classifier) noexcept :
+            str_(str), classifier_(classifier)
+        {
+        }
+
+        /**
+         * @brief Finds the next selected byte.
+         *
+         * @return The index of the byte, or \c std::string_view::npos if there are no more selected bytes.
+         */
+        [[nodiscard]] std::size_t next() noexcept
+        {
+            while (0 == mask_) {
+                if (block_ >= str_.size()) {
+                    return std::string_view::npos;
+                }
+
+                const auto size = (str_.size() - block_ < BLOCK_SIZE) ? (str_.size() - block_) : BLOCK_SIZE;
+
+                mask_ = classifier_(str_.data() + block_, size);
+                base_ = block_;
+                block_ += size;
+            }
+
+            const auto pos = base_ + lowest_bit(mask_);
+            mask_ &= mask_ - 1;
+
+            return pos;
+        }
+
+        /**
+         * @brief Returns the classifier, with the state it kept from the classified blocks.
+         *
+         * @return The classifier of the blocks.
+         */
+        [[nodiscard]] const Classifier& classifier() const noexcept
+        {
+            return classifier_;
+        }
+
+    private:
+        std::string_view str_;
+        Classifier classifier_;
+        std::size_t block_ = 0;
+        std::size_t base_ = 0;
+        std::uint32_t mask_ = 0;
+    };
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bytemap.hpp"
+#include "simd.hpp"
+#include "stringpy/cpu.hpp"
+
+namespace
+{
+    using CharType = std::string_view::value_type;
+    using strpy::detail::ByteMap;
+
+    /** @brief Returns the value added to a byte by the table, modulo 256 */
+    std::uint8_t shift_of(const ByteMap::Table& table, const std::size_t byte) noexcept
+    {
+        return static_cast<std::uint8_t>(static_cast<unsigned char>(table[byte]) - byte);
+    }
+
+    void map_table(const ByteMap& map, const std::string_view str, CharType* result) noexcept
+    {
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            result[i] = map.table[static_cast<unsigned char>(str[i])];
+        }
+    }
+
+#ifdef STRINGPY_X86
+    /**
+     * @brief A shifted range broadcast to 16 bytes.
+     *
+     * A byte belongs to the range if its distance from the first byte, modulo 256, does not exceed the span.
+     * The unused ranges are all zero and add nothing.
+     */
+    struct RangeSse42
+    {
+        STRINGPY_TARGET_SSE42 explicit RangeSse42(const strpy::detail::ByteRange& range) noexcept :
+            first(_mm_set1_epi8(static_cast<CharType>(range.first))),
+            span(_mm_set1_epi8(static_cast<CharType>(range.span))),
+            shift(_mm_set1_epi8(static_cast<CharType>(range.shift)))
+        {
+        }
+
+        /** @brief Add the shift to the bytes of the mapped block whose original bytes belong to the range */
+        [[nodiscard]] STRINGPY_TARGET_SSE42 __m128i apply(const __m128i bytes, const __m128i mapped) const noexcept
+        {
+            const auto offset = _mm_sub_epi8(bytes, first);
+            const auto inside = _mm_cmpeq_epi8(_mm_min_epu8(offset, span), offset);
+
+            return _mm_add_epi8(mapped, _mm_and_si128(inside, shift));
+        }
+
+        __m128i first;
+        __m128i span;
+        __m128i shift;
+    };
+
+    /** @brief A shifted range broadcast to 32 bytes */
+    struct RangeAvx2
+    {
+        STRINGPY_TARGET_AVX2 explicit RangeAvx2(const strpy::detail::ByteRange& range) noexcept :
+            first(_mm256_set1_epi8(static_cast<CharType>(range.first))),
+            span(_mm256_set1_epi8(static_cast<CharType>(range.span))),
+            shift(_mm256_set1_epi8(static_cast<CharType>(range.shift)))
+        {
+        }
+
+        /** @brief Add the shift to the bytes of the mapped block whose original bytes belong to the range */
+        [[nodiscard]] STRINGPY_TARGET_AVX2 __m256i apply(const __m256i bytes, const __m256i mapped) const noexcept
+        {
+            const auto offset = _mm256_sub_epi8(bytes, first);
+            const auto inside = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, span), offset);
+
+            return _mm256_add_epi8(mapped, _mm256_and_si256(inside, shift));
+        }
+
+        __m256i first;
+        __m256i span;
+        __m256i shift;
+    };
+
+    /** @brief Apply the shifted ranges 16 bytes at a time, the tail is mapped one byte at a time */
+    STRINGPY_TARGET_SSE42 STRINGPY_FLATTEN void map_ranges_sse42(const ByteMap& map, const std::string_view str,
+                                                                 CharType* result) noexcept
+    {
+        constexpr std::size_t block_size = 16;
+        const RangeSse42 low{map.ranges[0]};
+        const RangeSse42 high{map.ranges[1]};
+        std::size_t pos = 0;
+
+        for (; (pos + block_size) <= str.size(); pos += block_size) {
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + pos)); // NOLINT
+            const auto mapped = high.apply(bytes, low.apply(bytes, bytes));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(result + pos), mapped); // NOLINT(*-reinterpret-cast)
+        }
+
+        map_table(map, str.substr(pos), result + pos);
+    }
+
+    /** @brief Apply the shifted ranges 32 bytes at a time, the tail is mapped one byte at a time */
+    STRINGPY_TARGET_AVX2 STRINGPY_FLATTEN void map_ranges_avx2(const ByteMap& map, const std::string_view str,
+                                                               CharType* result) noexcept
+    {
+        constexpr std::size_t block_size = 32;
+        const RangeAvx2 low{map.ranges[0]};
+        const RangeAvx2 high{map.ranges[1]};
+        std::size_t pos = 0;
+
+        for (; (pos + block_size) <= str.size(); pos += block_size) {
+            const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str.data() + pos)); // NOLINT
+            const auto mapped = high.apply(bytes, low.apply(bytes, bytes));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + pos), mapped); // NOLINT(*-reinterpret-cast)
+        }
+
+        map_table(map, str.substr(pos), result + pos);
+    }
+#endif
+}
+
+namespace strpy::detail
+{
+    ByteMap make_byte_map(const ByteMap::Table& table) noexcept
+    {
+        ByteMap map{table, {}, 0};
+
+        for (std::size_t byte = 0; byte < table.size();) {
+            const auto shift = shift_of(table, byte);
+            auto end = byte + 1;
+
+            while ((end < table.size()) && (shift_of(table, end) == shift)) {
+                ++end;
+            }
+
+            if (shift != 0) {
+                if (map.range_count < ByteMap::MAX_RANGES) {
+                    map.ranges[map.range_count] = {static_cast<std::uint8_t>(byte),
+                                                   static_cast<std::uint8_t>(end - 1 - byte), shift};
+                }
+
+                ++map.range_count;
+            }
+
+            byte = end;
+        }
+
+        return map;
+    }
+
+    void map_bytes(const ByteMap& map, const std::string_view str, CharType* result) noexcept
+    {
+        if (map.range_count <= ByteMap::MAX_RANGES) {
+            switch (simd_level()) {
+#ifdef STRINGPY_X86
+                case SimdLevel::avx2:
+                    map_ranges_avx2(map, str, result);
+                    return;
+                case SimdLevel::sse42:
+                    map_ranges_sse42(map, str, result);
+                    return;
+#endif
+                default:
+                    break;
+            }
+        }
+
+        map_table(map, str, result);
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal byte-to-byte mapping engine for the case conversion and translation functions.
+ */
+
+#pragma once
+
+#include <string_view>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace strpy::detail
+{
+    /** @brief Strings shorter than this are mapped one character at a time without building a table. */
+    constexpr std::size_t BYTE_MAP_MIN_SIZE = 256;
+
+    /** @brief A range of bytes that are all shifted by the same amount. */
+    struct ByteRange
+    {
+        /** @brief The first byte of the range. */
+        std::uint8_t first;
+
+        /** @brief The number of bytes in the range minus one. */
+        std::uint8_t span;
+
+        /** @brief The value added to the bytes of the range, modulo 256. */
+        std::uint8_t shift;
+    };
+
+    /** @brief A mapping of every byte value to another byte value. */
+    struct ByteMap
+    {
+        /** @brief Number of ranges the vectorized kernels can apply. */
+        static constexpr std::size_t MAX_RANGES = 2;
+
+        /** @brief Type of the table, indexed by the byte value. */
+        using Table = std::array<std::string_view::value_type, 256>;
+
+        /** @brief The mapped value of every byte. */
+        Table table;
+
+        /** @brief The shifted ranges, all other bytes are mapped to themselves. */
+        std::array<ByteRange, MAX_RANGES> ranges;
+
+        /** @brief Number of shifted ranges, greater than \c MAX_RANGES if the table is not made of ranges. */
+        std::size_t range_count;
+    };
+
+    /**
+     * @brief Creates a mapping from a table.
+     *
+     * A table that maps every byte to itself except for at most two ranges shifted by a constant,
+     * such as the ASCII case conversions, is applied 16 or 32 bytes at a time depending on
+     * \ref strpy::simd_level. Any other table is applied one byte at a time.
+     *
+     * @param table The mapped value of every byte.
+     *
+     * @return The mapping.
+     */
+    [[nodiscard]] ByteMap make_byte_map(const ByteMap::Table& table) noexcept;
+
+    /**
+     * @brief Creates a mapping by calling a function for every byte value.
+     *
+     * @param function The function that maps a character.
+     *
+     * @return The mapping.
+     */
+    template <typename Function>
+    [[nodiscard]] ByteMap make_byte_map(Function function) noexcept
+    {
+        ByteMap::Table table{};
+
+        for (std::size_t byte = 0; byte < table.size(); ++byte) {
+            table[byte] = function(static_cast<std::string_view::value_type>(byte));
+        }
+
+        return make_byte_map(table);
+    }
+
+    /**
+     * @brief Maps every byte of a string.
+     *
+     * @param map The mapping.
+     * @param str The string to map.
+     * @param result The destination of <tt>str.size()</tt> bytes, may be equal to <tt>str.data()</tt>.
+     */
+    void map_bytes(const ByteMap& map, std::string_view str, std::string_view::value_type* result) noexcept;
+}
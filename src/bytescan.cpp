@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bytescan.hpp"
+#include "simd.hpp"
+#include "stringpy/cpu.hpp"
+#include <algorithm>
+
+namespace
+{
+    using CharType = std::string_view::value_type;
+
+    std::size_t count_scalar(const std::string_view str, const CharType ch) noexcept
+    {
+        return static_cast<std::size_t>(std::count(str.cbegin(), str.cend(), ch));
+    }
+
+#ifdef STRINGPY_X86
+    STRINGPY_TARGET_SSE42 std::size_t count_sse42(const std::string_view str, const CharType ch) noexcept
+    {
+        constexpr std::size_t block_size = 16;
+        const auto needle = _mm_set1_epi8(ch);
+        std::size_t result = 0;
+        std::size_t pos = 0;
+
+        for (; (pos + block_size) <= str.size(); pos += block_size) {
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + pos)); // NOLINT
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle)));
+            result += strpy::detail::popcount(mask);
+        }
+
+        return result + count_scalar(str.substr(pos), ch);
+    }
+
+    STRINGPY_TARGET_AVX2 std::size_t count_avx2(const std::string_view str, const CharType ch) noexcept
+    {
+        constexpr std::size_t block_size = 32;
+        const auto needle = _mm256_set1_epi8(ch);
+        std::size_t result = 0;
+        std::size_t pos = 0;
+
+        for (; (pos + block_size) <= str.size(); pos += block_size) {
+            const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str.data() + pos)); // NOLINT
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, needle)));
+            result += strpy::detail::popcount(mask);
+        }
+
+        return result + count_scalar(str.substr(pos), ch);
+    }
+#endif
+}
+
+namespace strpy::detail
+{
+    std::size_t count_byte(const std::string_view str, const CharType ch) noexcept
+    {
+        switch (simd_level()) {
+#ifdef STRINGPY_X86
+            case SimdLevel::avx2:
+                return count_avx2(str, ch);
+            case SimdLevel::sse42:
+                return count_sse42(str, ch);
+#endif
+            default:
+                return count_scalar(str, ch);
+        }
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal single-byte search engine for the functions that accept a character needle or delimiter.
+ */
+
+#pragma once
+
+#include <string_view>
+#include <cstddef>
+
+namespace strpy::detail
+{
+    /**
+     * @brief Finds the first occurrence of a byte within a string, starting at a given position.
+     *
+     * The search is done by \c std::char_traits::find, which is a \c memchr call
+     * vectorized by the C library.
+     *
+     * @param str The string to search within.
+     * @param ch The byte to search for.
+     * @param pos The position to start the search at.
+     *
+     * @return The index of the byte, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] inline std::size_t find_byte(const std::string_view str, const std::string_view::value_type ch,
+                                               const std::size_t pos = 0) noexcept
+    {
+        if (pos >= str.size()) {
+            return std::string_view::npos;
+        }
+
+        const auto* const found = std::string_view::traits_type::find(str.data() + pos, str.size() - pos, ch);
+        return (nullptr == found) ? std::string_view::npos : static_cast<std::size_t>(found - str.data());
+    }
+
+    /**
+     * @brief Counts the occurrences of a byte within a string.
+     *
+     * The bytes are compared 16 or 32 at a time depending on \ref strpy::simd_level,
+     * the matches of a block are counted with a movemask and a popcount.
+     *
+     * @param str The string to search within.
+     * @param ch The byte to count.
+     *
+     * @return The number of occurrences of the byte.
+     */
+    [[nodiscard]] std::size_t count_byte(std::string_view str, std::string_view::value_type ch) noexcept;
+}
@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/charset.hpp"
+#include "stringpy/ctype.hpp"
+#include <limits>
+
+namespace strpy
+{
+    CharSet make_charset_icase(const std::string_view chars) noexcept
+    {
+        constexpr auto max_byte = std::numeric_limits<unsigned char>::max();
+        const CharSet exact{chars};
+        CharSet upper{};
+        CharSet result{};
+
+        for (const auto ch : chars) {
+            upper.insert(to_upper_char(ch));
+        }
+
+        // Same rule as equal_char_icase: equal bytes or equal upper case variants
+        for (unsigned byte = 0; byte <= max_byte; ++byte) {
+            if (const auto ch = static_cast<char>(byte); exact.contains(ch) || upper.contains(to_upper_char(ch))) {
+                result.insert(ch);
+            }
+        }
+
+        return result;
+    }
+}
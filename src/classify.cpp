@@ -0,0 +1,233 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "classify.hpp"
+#include "simd.hpp"
+#include "stringpy/cpu.hpp"
+#include <array>
+#include <cstdint>
+
+namespace
+{
+    using CharType = std::string_view::value_type;
+    using strpy::CharSet;
+
+    /** @brief Number of bits in a byte */
+    [[maybe_unused]] constexpr unsigned BYTE_BITS = 8;
+
+    /** @brief Find the first character at or after pos whose membership is equal to the given one */
+    std::size_t scan_scalar(const std::string_view str, const CharSet& set, const bool member,
+                            std::size_t pos) noexcept
+    {
+        for (; pos < str.size(); ++pos) {
+            if (set.contains(str[pos]) == member) {
+                return pos;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    /** @brief Find the last character before end whose membership is equal to the given one */
+    std::size_t rscan_scalar(const std::string_view str, const CharSet& set, const bool member,
+                             std::size_t end) noexcept
+    {
+        while (end != 0) {
+            if (set.contains(str[--end]) == member) {
+                return end;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+#ifdef STRINGPY_X86
+    /** @brief Classifies 16 bytes at a time using SSSE3 byte shuffles */
+    struct ClassifierSse42
+    {
+        static constexpr std::size_t BLOCK_SIZE = 16;
+
+        __m128i low_rows;
+        __m128i high_rows;
+        __m128i bits;
+        __m128i nibble_mask;
+        __m128i last_low_nibble;
+
+        STRINGPY_TARGET_SSE42 explicit ClassifierSse42(const CharSet& set) noexcept :
+            low_rows(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.low_rows().data()))),
+            high_rows(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.high_rows().data()))),
+            bits(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128)),
+            nibble_mask(_mm_set1_epi8(0x0F)), last_low_nibble(_mm_set1_epi8(BYTE_BITS - 1))
+        {
+        }
+
+        /** @brief Returns a mask with bit i set if the byte data[i] belongs to the set */
+        [[nodiscard]] STRINGPY_TARGET_SSE42 std::uint32_t members(const CharType* data) const noexcept
+        {
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            const auto low = _mm_and_si128(bytes, nibble_mask);
+            const auto high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+            const auto upper_half = _mm_cmpgt_epi8(high, last_low_nibble);
+            const auto rows = _mm_or_si128(_mm_and_si128(upper_half, _mm_shuffle_epi8(high_rows, low)),
+                                           _mm_andnot_si128(upper_half, _mm_shuffle_epi8(low_rows, low)));
+            const auto bit = _mm_shuffle_epi8(bits, high);
+            const auto hits = _mm_cmpeq_epi8(_mm_and_si128(rows, bit), bit);
+
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(hits));
+        }
+    };
+
+    /** @brief Classifies 32 bytes at a time using AVX2 byte shuffles */
+    struct ClassifierAvx2
+    {
+        static constexpr std::size_t BLOCK_SIZE = 32;
+
+        __m256i low_rows;
+        __m256i high_rows;
+        __m256i bits;
+        __m256i nibble_mask;
+        __m256i last_low_nibble;
+
+        STRINGPY_TARGET_AVX2 explicit ClassifierAvx2(const CharSet& set) noexcept :
+            low_rows(_mm256_broadcastsi128_si256(
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.low_rows().data())))),
+            high_rows(_mm256_broadcastsi128_si256(
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.high_rows().data())))),
+            bits(_mm256_broadcastsi128_si256(
+              _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128))),
+            nibble_mask(_mm256_set1_epi8(0x0F)), last_low_nibble(_mm256_set1_epi8(BYTE_BITS - 1))
+        {
+        }
+
+        /** @brief Returns a mask with bit i set if the byte data[i] belongs to the set */
+        [[nodiscard]] STRINGPY_TARGET_AVX2 std::uint32_t members(const CharType* data) const noexcept
+        {
+            const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            const auto low = _mm256_and_si256(bytes, nibble_mask);
+            const auto high = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble_mask);
+            const auto upper_half = _mm256_cmpgt_epi8(high, last_low_nibble);
+            const auto rows = _mm256_blendv_epi8(_mm256_shuffle_epi8(low_rows, low),
+                                                 _mm256_shuffle_epi8(high_rows, low), upper_half);
+            const auto bit = _mm256_shuffle_epi8(bits, high);
+            const auto hits = _mm256_cmpeq_epi8(_mm256_and_si256(rows, bit), bit);
+
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(hits));
+        }
+    };
+#endif
+
+    /** @brief Returns the mask that selects all bytes of a block */
+    template <std::size_t BlockSize>
+    constexpr std::uint32_t full_mask() noexcept
+    {
+        if constexpr (BlockSize >= 32) {
+            return ~std::uint32_t{0};
+        }
+        else {
+            return (std::uint32_t{1} << BlockSize) - 1;
+        }
+    }
+
+    /** @brief Scan the string block by block from the beginning, the tail is scanned one byte at a time */
+    template <typename Classifier>
+    [[maybe_unused]] std::size_t scan_blocks(const std::string_view str, const CharSet& set,
+                                             const bool member) noexcept
+    {
+        constexpr auto block_size = Classifier::BLOCK_SIZE;
+        std::size_t pos = 0;
+
+        if (str.size() >= block_size) {
+            const Classifier classifier{set};
+            const auto flip = member ? 0 : full_mask<block_size>();
+
+            for (; (pos + block_size) <= str.size(); pos += block_size) {
+                if (const auto mask = classifier.members(str.data() + pos) ^ flip; mask != 0) {
+                    return pos + strpy::detail::lowest_bit(mask);
+                }
+            }
+        }
+
+        return scan_scalar(str, set, member, pos);
+    }
+
+    /** @brief Scan the string block by block from the end, the head is scanned one byte at a time */
+    template <typename Classifier>
+    [[maybe_unused]] std::size_t rscan_blocks(const std::string_view str, const CharSet& set,
+                                              const bool member) noexcept
+    {
+        constexpr auto block_size = Classifier::BLOCK_SIZE;
+        auto end = str.size();
+
+        if (end >= block_size) {
+            const Classifier classifier{set};
+            const auto flip = member ? 0 : full_mask<block_size>();
+
+            for (; end >= block_size; end -= block_size) {
+                if (const auto mask = classifier.members(str.data() + (end - block_size)) ^ flip; mask != 0) {
+                    return (end - block_size) + strpy::detail::highest_bit(mask);
+                }
+            }
+        }
+
+        return rscan_scalar(str, set, member, end);
+    }
+
+#ifdef STRINGPY_X86
+    STRINGPY_TARGET_SSE42 STRINGPY_FLATTEN std::size_t scan_sse42(const std::string_view str, const CharSet& set,
+                                                                  const bool member) noexcept
+    {
+        return scan_blocks<ClassifierSse42>(str, set, member);
+    }
+
+    STRINGPY_TARGET_SSE42 STRINGPY_FLATTEN std::size_t rscan_sse42(const std::string_view str, const CharSet& set,
+                                                                   const bool member) noexcept
+    {
+        return rscan_blocks<ClassifierSse42>(str, set, member);
+    }
+
+    STRINGPY_TARGET_AVX2 STRINGPY_FLATTEN std::size_t scan_avx2(const std::string_view str, const CharSet& set,
+                                                                const bool member) noexcept
+    {
+        return scan_blocks<ClassifierAvx2>(str, set, member);
+    }
+
+    STRINGPY_TARGET_AVX2 STRINGPY_FLATTEN std::size_t rscan_avx2(const std::string_view str, const CharSet& set,
+                                                                 const bool member) noexcept
+    {
+        return rscan_blocks<ClassifierAvx2>(str, set, member);
+    }
+#endif
+}
+
+namespace strpy::detail
+{
+    std::size_t scan_set(const std::string_view str, const CharSet& set, const bool member) noexcept
+    {
+        switch (simd_level()) {
+#ifdef STRINGPY_X86
+            case SimdLevel::avx2:
+                return scan_avx2(str, set, member);
+            case SimdLevel::sse42:
+                return scan_sse42(str, set, member);
+#endif
+            default:
+                return scan_scalar(str, set, member, 0);
+        }
+    }
+
+    std::size_t rscan_set(const std::string_view str, const CharSet& set, const bool member) noexcept
+    {
+        switch (simd_level()) {
+#ifdef STRINGPY_X86
+            case SimdLevel::avx2:
+                return rscan_avx2(str, set, member);
+            case SimdLevel::sse42:
+                return rscan_sse42(str, set, member);
+#endif
+            default:
+                return rscan_scalar(str, set, member, str.size());
+        }
+    }
+}
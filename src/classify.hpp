@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal character classification engine for strpy::CharSet.
+ */
+
+#pragma once
+
+#include "stringpy/charset.hpp"
+#include <string_view>
+#include <cstddef>
+
+namespace strpy::detail
+{
+    /**
+     * @brief Finds the first character of a string whose membership in a set is equal to the given one.
+     *
+     * The membership of 16 or 32 bytes at a time is computed with a nibble lookup, depending on \ref strpy::simd_level:
+     * the low nibble of a byte selects a row of the bitmap and the high nibble selects a bit of the row.
+     *
+     * @param str The string to search within.
+     * @param set The set of characters.
+     * @param member \c true to find a character of the set, \c false to find a character not in the set.
+     *
+     * @return The index of the found character, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] std::size_t scan_set(std::string_view str, const CharSet& set, bool member) noexcept;
+
+    /**
+     * @brief Finds the last character of a string whose membership in a set is equal to the given one.
+     *
+     * @param str The string to search within.
+     * @param set The set of characters.
+     * @param member \c true to find a character of the set, \c false to find a character not in the set.
+     *
+     * @return The index of the found character, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] std::size_t rscan_set(std::string_view str, const CharSet& set, bool member) noexcept;
+}
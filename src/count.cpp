@@ -4,6 +4,7 @@
  */
 
 #include "stringpy/count.hpp"
+#include "bytescan.hpp"
 #include "stringpy/find.hpp"
 #include <algorithm>
 
@@ -44,6 +45,16 @@ namespace strpy
         return count_impl(str, sub, start, end, find);
     }
 
+    std::size_t count(const std::string_view str, const char ch, const std::size_t start, std::size_t end) noexcept
+    {
+        if ((start > end) || (start >= str.size())) {
+            return 0;
+        }
+
+        end = std::min(end, str.size());
+        return detail::count_byte(str.substr(start, end - start), ch);
+    }
+
     std::size_t count_icase(const std::string_view str, const std::string_view sub, const std::size_t start,
                             const std::size_t end) noexcept
     {
@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/cpu.hpp"
+#include "simd.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(STRINGPY_X86) && !defined(_MSC_VER)
+  #include <cpuid.h>
+#endif
+
+namespace
+{
+    using strpy::SimdLevel;
+
+    /** @brief Names of the levels, indexed by their values */
+    constexpr std::array<std::string_view, 3> LEVEL_NAMES{"scalar", "sse42", "avx2"};
+
+    /** @brief Name of the environment variable that lowers the initial level */
+    constexpr auto LEVEL_VARIABLE = "STRINGPY_SIMD_LEVEL";
+
+#ifdef STRINGPY_X86
+    /** @brief Registers returned by the cpuid instruction */
+    struct CpuidRegisters
+    {
+        std::uint32_t eax = 0;
+        std::uint32_t ebx = 0;
+        std::uint32_t ecx = 0;
+        std::uint32_t edx = 0;
+    };
+
+    /** @brief Feature bits of cpuid leaf 1, register ECX */
+    constexpr std::uint32_t SSSE3_BIT = 1U << 9U;
+    constexpr std::uint32_t SSE41_BIT = 1U << 19U;
+    constexpr std::uint32_t SSE42_BIT = 1U << 20U;
+    constexpr std::uint32_t POPCNT_BIT = 1U << 23U;
+    constexpr std::uint32_t OSXSAVE_BIT = 1U << 27U;
+    constexpr std::uint32_t AVX_BIT = 1U << 28U;
+
+    /** @brief Feature bit of cpuid leaf 7, register EBX */
+    constexpr std::uint32_t AVX2_BIT = 1U << 5U;
+
+    /** @brief The XMM and YMM state bits of XCR0, both must be enabled by the operating system */
+    constexpr std::uint64_t YMM_STATE = 0x6U;
+
+    CpuidRegisters cpuid(const std::uint32_t leaf) noexcept
+    {
+        CpuidRegisters result{};
+
+  #ifdef _MSC_VER
+        std::array<int, 4> registers{};
+        __cpuid(registers.data(), 0);
+
+        if (static_cast<std::uint32_t>(registers[0]) < leaf) {
+            return result;
+        }
+
+        __cpuidex(registers.data(), static_cast<int>(leaf), 0);
+        result = {static_cast<std::uint32_t>(registers[0]), static_cast<std::uint32_t>(registers[1]),
+                  static_cast<std::uint32_t>(registers[2]), static_cast<std::uint32_t>(registers[3])};
+  #else
+        if (__get_cpuid_max(0, nullptr) < leaf) {
+            return result;
+        }
+
+        __cpuid_count(leaf, 0, result.eax, result.ebx, result.ecx, result.edx);
+  #endif
+
+        return result;
+    }
+
+    /** @brief Returns the extended control register XCR0, OSXSAVE must be checked first */
+    std::uint64_t read_xcr0() noexcept
+    {
+  #ifdef _MSC_VER
+        return _xgetbv(0);
+  #else
+        std::uint32_t eax = 0;
+        std::uint32_t edx = 0;
+        __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+        return (std::uint64_t{edx} << 32U) | eax;
+  #endif
+    }
+
+    SimdLevel detect_level() noexcept
+    {
+        const auto features = cpuid(1).ecx;
+        constexpr auto sse42_features = SSSE3_BIT | SSE41_BIT | SSE42_BIT | POPCNT_BIT;
+
+        if ((features & sse42_features) != sse42_features) {
+            return SimdLevel::scalar;
+        }
+
+        if (((features & (OSXSAVE_BIT | AVX_BIT)) != (OSXSAVE_BIT | AVX_BIT)) ||
+            ((read_xcr0() & YMM_STATE) != YMM_STATE) || ((cpuid(7).ebx & AVX2_BIT) == 0)) {
+            return SimdLevel::sse42;
+        }
+
+        return SimdLevel::avx2;
+    }
+#else
+    SimdLevel detect_level() noexcept
+    {
+        return SimdLevel::scalar;
+    }
+#endif
+
+    SimdLevel clamp_level(const SimdLevel level) noexcept
+    {
+        return (level < strpy::supported_simd_level()) ? level : strpy::supported_simd_level();
+    }
+
+    /** @brief The level requested by the environment variable, or the supported one */
+    SimdLevel initial_level() noexcept
+    {
+        const auto* const value = std::getenv(LEVEL_VARIABLE); // NOLINT(concurrency-mt-unsafe)
+
+        if (nullptr == value) {
+            return strpy::supported_simd_level();
+        }
+
+        for (std::size_t i = 0; i < LEVEL_NAMES.size(); ++i) {
+            if (LEVEL_NAMES[i] == value) {
+                return clamp_level(static_cast<SimdLevel>(i));
+            }
+        }
+
+        return strpy::supported_simd_level();
+    }
+
+    std::atomic<SimdLevel>& active_level() noexcept
+    {
+        static std::atomic<SimdLevel> level{initial_level()};
+        return level;
+    }
+}
+
+namespace strpy
+{
+    SimdLevel supported_simd_level() noexcept
+    {
+        static const auto level = detect_level();
+        return level;
+    }
+
+    SimdLevel simd_level() noexcept
+    {
+        return active_level().load(std::memory_order_relaxed);
+    }
+
+    SimdLevel set_simd_level(const SimdLevel level) noexcept
+    {
+        const auto clamped = clamp_level(level);
+        active_level().store(clamped, std::memory_order_relaxed);
+
+        return clamped;
+    }
+
+    std::string_view simd_level_name(const SimdLevel level) noexcept
+    {
+        const auto index = static_cast<std::size_t>(level);
+        return (index < LEVEL_NAMES.size()) ? LEVEL_NAMES[index] : std::string_view{};
+    }
+}
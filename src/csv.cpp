@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/csv.hpp"
+#include "bytescan.hpp"
+#include "csvscan.hpp"
+#include "stringpy/const.hpp"
+#include <functional>
+
+namespace
+{
+    /** @brief Removes the carriage return of a CR LF line break from the end of the last field of a record */
+    [[nodiscard]] std::string_view remove_carriage_return(const std::string_view field) noexcept
+    {
+        return ((!field.empty()) && (strpy::CARRIAGE_RETURN == field.back())) ? field.substr(0, field.size() - 1)
+                                                                               : field;
+    }
+
+    /** @brief Points a field that lies in one buffer to the same place in a copy of the buffer */
+    void rebase_field(std::string_view& field, const std::vector<char>& from, const std::vector<char>& to) noexcept
+    {
+        const std::less<const char*> less{};
+        const auto* const begin = from.data();
+
+        if ((!field.empty()) && (!less(field.data(), begin)) && less(field.data(), begin + from.size())) {
+            field = {to.data() + (field.data() - begin), field.size()};
+        }
+    }
+}
+
+namespace strpy
+{
+    CsvRecord::CsvRecord(const CsvRecord& other) noexcept :
+        fields_(other.fields_), buffer_(other.buffer_), source_(other.source_)
+    {
+        rebase(other);
+    }
+
+    CsvRecord& CsvRecord::operator=(const CsvRecord& other) noexcept
+    {
+        if (this != &other) {
+            fields_ = other.fields_;
+            buffer_ = other.buffer_;
+            source_ = other.source_;
+            rebase(other);
+        }
+
+        return *this;
+    }
+
+    void CsvRecord::rebase(const CsvRecord& other) noexcept
+    {
+        for (auto& field : fields_) {
+            rebase_field(field, other.buffer_, buffer_);
+            rebase_field(field, other.source_, source_);
+        }
+    }
+
+    void CsvRecord::unquote(const size_type record_size, const char quote) noexcept
+    {
+        // An empty line is a record without fields
+        if ((1 == fields_.size()) && fields_.front().empty()) {
+            fields_.clear();
+            return;
+        }
+
+        // An unescaped field is never longer than its quoted form, so the buffer is never reallocated
+        // while the fields of a record are unescaped and the views into it stay valid
+        buffer_.clear();
+        buffer_.reserve(record_size);
+
+        for (auto& field : fields_) {
+            if (std::string_view::npos == detail::find_byte(field, quote)) {
+                continue;
+            }
+
+            // A field enclosed in quotes without escaped quotes is a view of its contents
+            if ((field.size() > 1) && (quote == field.front()) && (quote == field.back()) &&
+                (std::string_view::npos == detail::find_byte(field.substr(1, field.size() - 2), quote))) {
+                field = field.substr(1, field.size() - 2);
+                continue;
+            }
+
+            const auto start = buffer_.size();
+            auto quoted = false;
+
+            for (std::size_t i = 0; i < field.size(); ++i) {
+                if (quote != field[i]) {
+                    buffer_.push_back(field[i]);
+                }
+                else if (quoted && ((i + 1) < field.size()) && (quote == field[i + 1])) {
+                    buffer_.push_back(quote);
+                    ++i;
+                }
+                else {
+                    quoted = !quoted;
+                }
+            }
+
+            field = {buffer_.data() + start, buffer_.size() - start};
+        }
+    }
+
+    bool CsvReader::next(CsvRecord& record) noexcept
+    {
+        if (!carry_.empty()) {
+            return next_carried(record);
+        }
+
+        if (pos_ >= chunk_.size()) {
+            return false;
+        }
+
+        // The fields of a record that lies within the chunk are views into the chunk
+        record.source_.clear();
+
+        const auto rest = chunk_.substr(pos_);
+
+        if (const auto end = read_fields(rest, false, record); std::string_view::npos != end) {
+            record.unquote(end, quote_);
+            pos_ += end + 1;
+            return true;
+        }
+
+        pos_ = chunk_.size();
+
+        if (last_) {
+            record.unquote(rest.size(), quote_);
+            return true;
+        }
+
+        // The record continues in the next chunk
+        carry_.assign(rest.cbegin(), rest.cend());
+        record.fields_.clear();
+
+        return false;
+    }
+
+    bool CsvReader::next_carried(CsvRecord& record) noexcept
+    {
+        const auto rest = chunk_.substr(pos_);
+        const auto end = read_fields(rest, carry_quoted_, record);
+
+        if ((std::string_view::npos == end) && (!last_)) {
+            carry_.insert(carry_.cend(), rest.cbegin(), rest.cend());
+            pos_ = chunk_.size();
+            record.fields_.clear();
+            return false;
+        }
+
+        const auto tail = rest.substr(0, end);
+        carry_.insert(carry_.cend(), tail.cbegin(), tail.cend());
+        pos_ = (std::string_view::npos == end) ? chunk_.size() : (pos_ + end + 1);
+
+        // The record takes over the copied input, so its fields stay valid while the reader goes on,
+        // and the storage of its previous copy is reused for the next carried record
+        record.source_.swap(carry_);
+        carry_.clear();
+
+        const std::string_view source{record.source_.data(), record.source_.size()};
+        read_fields(source, false, record);
+        record.unquote(source.size(), quote_);
+
+        return true;
+    }
+
+    std::size_t CsvReader::read_fields(const std::string_view data, const bool quoted, CsvRecord& record) noexcept
+    {
+        detail::CsvScanner scanner{data, delimiter_, quote_, quoted};
+        std::size_t start = 0;
+
+        record.fields_.clear();
+
+        for (auto separator = scanner.next(); std::string_view::npos != separator; separator = scanner.next()) {
+            if (LINE_FEED == data[separator]) {
+                record.fields_.push_back(remove_carriage_return(data.substr(start, separator - start)));
+                return separator;
+            }
+
+            record.fields_.push_back(data.substr(start, separator - start));
+            start = separator + 1;
+        }
+
+        record.fields_.push_back(remove_carriage_return(data.substr(start)));
+        carry_quoted_ = scanner.quoted();
+
+        return std::string_view::npos;
+    }
+
+    CsvRecord split_csv(const std::string_view record, const char delimiter, const char quote) noexcept
+    {
+        CsvRecord result{};
+        CsvReader reader{record, delimiter, quote};
+
+        // An empty string has no records, the result is left without fields
+        static_cast<void>(reader.next(result));
+
+        return result;
+    }
+}
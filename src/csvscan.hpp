@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal scanner of the field and record boundaries of delimiter-separated values.
+ */
+
+#pragma once
+
+#include "blockscan.hpp"
+#include "stringpy/const.hpp"
+#include <string_view>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace strpy::detail
+{
+    /**
+     * @brief Returns a mask with bit i set to the parity of the bits 0 to i of another mask.
+     *
+     * Applied to the mask of quote characters, it selects the bytes from an opening quote
+     * up to, but not including, the closing one.
+     *
+     * @param mask The mask to inspect.
+     *
+     * @return The prefix XOR of the mask.
+     */
+    [[nodiscard]] constexpr std::uint32_t prefix_xor(std::uint32_t mask) noexcept
+    {
+        for (unsigned shift = 1; shift < BLOCK_SIZE; shift *= 2) {
+            mask ^= mask << shift;
+        }
+
+        return mask;
+    }
+
+    /**
+     * @brief Classifies a block of delimiter-separated values into a bitmask of the delimiters and
+     * the line feeds that are outside of quotes.
+     *
+     * The quoted state at the end of a block is carried over to the next one.
+     */
+    class CsvClassifier
+    {
+    public:
+        /**
+         * @brief Constructs a classifier.
+         *
+         * @param delimiter The field delimiter.
+         * @param quote The quote character.
+         * @param quoted Whether the first block starts within quotes.
+         */
+        CsvClassifier(const std::string_view::value_type delimiter, const std::string_view::value_type quote,
+                      const bool quoted) noexcept :
+            separators_{delimiter, LINE_FEED}, quote_{quote}, quoted_(quoted)
+        {
+        }
+
+        /**
+         * @brief Classifies the next block.
+         *
+         * @param data The bytes to classify.
+         * @param size The number of bytes, at most \ref BLOCK_SIZE.
+         *
+         * @return A mask with bit i set if the byte data[i] is a separator outside of quotes.
+         */
+        [[nodiscard]] std::uint32_t operator()(const std::string_view::value_type* const data,
+                                               const std::size_t size) noexcept
+        {
+            const auto quoted = prefix_xor(equal_mask(data, size, quote_)) ^ (quoted_ ? ~std::uint32_t{0} : 0);
+
+            // The bits past the end of a short block repeat the state of its last byte
+            quoted_ = (quoted >> (BLOCK_SIZE - 1)) != 0;
+
+            return equal_mask(data, size, separators_) & ~quoted;
+        }
+
+        /**
+         * @brief Checks whether the end of the classified blocks is within quotes.
+         *
+         * @return \c true if the last classified byte is within quotes, \c false otherwise.
+         */
+        [[nodiscard]] bool quoted() const noexcept
+        {
+            return quoted_;
+        }
+
+    private:
+        std::array<std::string_view::value_type, 2> separators_;
+        std::array<std::string_view::value_type, 1> quote_;
+        bool quoted_;
+    };
+
+    /**
+     * @brief Finds, one after another, the delimiters and the line feeds that are outside of quotes.
+     *
+     * The string is classified block by block by a \ref CsvClassifier as the boundaries are requested.
+     * The scanner refers to the string and must not outlive it.
+     */
+    class CsvScanner
+    {
+    public:
+        /**
+         * @brief Constructs a scanner over a string.
+         *
+         * @param str The string to scan.
+         * @param delimiter The field delimiter.
+         * @param quote The quote character.
+         * @param quoted Whether the string starts within quotes (optional).
+         */
+        CsvScanner(const std::string_view str, const std::string_view::value_type delimiter,
+                   const std::string_view::value_type quote, const bool quoted = false) noexcept :
+            separators_(str, CsvClassifier{delimiter, quote, quoted})
+        {
+        }
+
+        /**
+         * @brief Finds the next delimiter or line feed that is outside of quotes.
+         *
+         * @return The index of the separator, or \c std::string_view::npos if there are no more separators.
+         */
+        [[nodiscard]] std::size_t next() noexcept
+        {
+            return separators_.next();
+        }
+
+        /**
+         * @brief Checks whether the end of the classified part of the string is within quotes.
+         *
+         * @return \c true if the last classified byte is within quotes, \c false otherwise.
+         */
+        [[nodiscard]] bool quoted() const noexcept
+        {
+            return separators_.classifier().quoted();
+        }
+
+    private:
+        BlockScanner<CsvClassifier> separators_;
+    };
+}
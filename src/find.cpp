@@ -4,10 +4,9 @@
  */
 
 #include "stringpy/find.hpp"
-#include "stringpy/equal.hpp"
+#include "classify.hpp"
+#include "search.hpp"
 #include <algorithm>
-#include <iterator>
-#include <string>
 
 namespace
 {
@@ -21,37 +20,57 @@ namespace
         return str.rfind(sub);
     }
 
-    std::size_t find_forward_icase(const std::string_view str, const std::string_view sub) noexcept
+    /** @brief Type alias for a function pointer to find_* */
+    using FindFunc = decltype(&find_forward);
+
+    std::size_t find_impl(std::string_view str, const std::string_view sub, const std::size_t start, std::size_t end,
+                          const FindFunc find) noexcept
     {
-        if (sub.empty()) {
-            return 0;
+        if ((start != 0) && ((start > end) || (start >= str.size()))) {
+            return std::string_view::npos;
         }
 
-        const auto& it = std::search(str.cbegin(), str.cend(), sub.cbegin(), sub.cend(),
-                                     strpy::equal_char_icase<std::string_view::value_type>);
+        if ((start != 0) || (end != std::string_view::npos)) {
+            end = std::min(end, str.size());
+            str = str.substr(start, end - start);
+        }
+
+        if (str.size() < sub.size()) {
+            return std::string_view::npos;
+        }
 
-        return it == str.cend() ? std::string_view::npos : static_cast<std::size_t>(it - str.cbegin());
+        if (const auto result = find(str, sub); result != std::string_view::npos) {
+            return start + result;
+        }
+
+        return std::string_view::npos;
     }
 
-    std::size_t find_reverse_icase(const std::string_view str, const std::string_view sub) noexcept
+    /** @brief Find the first character within [start, end) whose membership in the set is equal to the given one */
+    std::size_t find_of_impl(std::string_view str, const strpy::CharSet& chars, const std::size_t start,
+                             const std::size_t end, const bool member) noexcept
     {
-        if (sub.empty()) {
-            return str.size();
+        if ((start > end) || (start >= str.size())) {
+            return std::string_view::npos;
         }
 
-        const auto& it = std::search(str.crbegin(), str.crend(), sub.crbegin(), sub.crend(),
-                                     strpy::equal_char_icase<std::string_view::value_type>);
+        if (end < str.size()) {
+            str.remove_suffix(str.size() - end);
+        }
 
-        return it == str.crend() ? std::string_view::npos : (static_cast<std::size_t>(str.crend() - it) - sub.size());
-    }
+        if (const auto result = strpy::detail::scan_set(str.substr(start), chars, member);
+            result != std::string_view::npos) {
+            return start + result;
+        }
 
-    /** @brief Type alias for a function pointer to find_* */
-    using FindFunc = decltype(&find_forward);
+        return std::string_view::npos;
+    }
 
-    std::size_t find_impl(std::string_view str, const std::string_view sub, const std::size_t start, std::size_t end,
-                          const FindFunc find) noexcept
+    /** @brief Find the last character within [start, end) whose membership in the set is equal to the given one */
+    std::size_t find_last_of_impl(std::string_view str, const strpy::CharSet& chars, const std::size_t start,
+                                  std::size_t end, const bool member) noexcept
     {
-        if ((start != 0) && ((start > end) || (start >= str.size()))) {
+        if ((start > end) || (start >= str.size())) {
             return std::string_view::npos;
         }
 
@@ -60,11 +79,7 @@ namespace
             str = str.substr(start, end - start);
         }
 
-        if (str.size() < sub.size()) {
-            return std::string_view::npos;
-        }
-
-        if (const auto result = find(str, sub); result != std::string_view::npos) {
+        if (const auto result = strpy::detail::rscan_set(str, chars, member); result != std::string_view::npos) {
             return start + result;
         }
 
@@ -83,7 +98,7 @@ namespace strpy
     std::size_t find_icase(const std::string_view str, const std::string_view sub, const std::size_t start,
                            const std::size_t end) noexcept
     {
-        return find_impl(str, sub, start, end, find_forward_icase);
+        return find_impl(str, sub, start, end, detail::search_icase);
     }
 
     std::size_t rfind(const std::string_view str, const std::string_view sub, const std::size_t start,
@@ -95,7 +110,7 @@ namespace strpy
     std::size_t rfind_icase(const std::string_view str, const std::string_view sub, const std::size_t start,
                             const std::size_t end) noexcept
     {
-        return find_impl(str, sub, start, end, find_reverse_icase);
+        return find_impl(str, sub, start, end, detail::rsearch_icase);
     }
 
     std::size_t find_first_of(std::string_view str, const std::string_view chars, const std::size_t start,
@@ -112,22 +127,16 @@ namespace strpy
         return str.find_first_of(chars, start);
     }
 
-    std::size_t find_first_of_icase(std::string_view str, const std::string_view chars, const std::size_t start,
-                                    const std::size_t end) noexcept
+    std::size_t find_first_of(const std::string_view str, const CharSet& chars, const std::size_t start,
+                              const std::size_t end) noexcept
     {
-        if ((start > end) || (start >= str.size()) || chars.empty()) {
-            return std::string_view::npos;
-        }
-
-        if (end < str.size()) {
-            str.remove_suffix(str.size() - end);
-        }
-
-        const auto& it =
-          std::find_first_of(str.cbegin() + static_cast<std::string_view::difference_type>(start), str.cend(),
-                             chars.cbegin(), chars.cend(), equal_char_icase<std::string_view::value_type>);
+        return find_of_impl(str, chars, start, end, true);
+    }
 
-        return it == str.cend() ? std::string::npos : static_cast<std::size_t>(it - str.cbegin());
+    std::size_t find_first_of_icase(const std::string_view str, const std::string_view chars,
+                                    const std::size_t start, const std::size_t end) noexcept
+    {
+        return find_of_impl(str, make_charset_icase(chars), start, end, true);
     }
 
     std::size_t find_first_not_of(std::string_view str, const std::string_view chars, const std::size_t start,
@@ -144,11 +153,15 @@ namespace strpy
         return str.find_first_not_of(chars, start);
     }
 
-    std::size_t find_first_not_of_icase(std::string_view str, const std::string_view chars, const std::size_t start,
-                                        const std::size_t end) noexcept
+    std::size_t find_first_not_of(const std::string_view str, const CharSet& chars, const std::size_t start,
+                                  const std::size_t end) noexcept
     {
-        using DiffType = std::string_view::difference_type;
+        return find_of_impl(str, chars, start, end, false);
+    }
 
+    std::size_t find_first_not_of_icase(const std::string_view str, const std::string_view chars,
+                                        const std::size_t start, const std::size_t end) noexcept
+    {
         if ((start > end) || (start >= str.size())) {
             return std::string_view::npos;
         }
@@ -157,18 +170,7 @@ namespace strpy
             return 0;
         }
 
-        if (end < str.size()) {
-            str.remove_suffix(str.size() - end);
-        }
-
-        const auto& it =
-          std::find_if(str.cbegin() + static_cast<DiffType>(start), str.cend(), [&chars](const auto ch1) {
-              return std::none_of(chars.cbegin(), chars.cend(), [ch1](const auto ch2) {
-                  return equal_char_icase(ch1, ch2);
-              });
-          });
-
-        return it == str.cend() ? std::string::npos : static_cast<std::size_t>(it - str.cbegin());
+        return find_of_impl(str, make_charset_icase(chars), start, end, false);
     }
 
     std::size_t find_last_of(std::string_view str, const std::string_view chars, const std::size_t start,
@@ -190,22 +192,16 @@ namespace strpy
         return std::string_view::npos;
     }
 
-    std::size_t find_last_of_icase(std::string_view str, const std::string_view chars, const std::size_t start,
-                                   std::size_t end) noexcept
+    std::size_t find_last_of(const std::string_view str, const CharSet& chars, const std::size_t start,
+                             const std::size_t end) noexcept
     {
-        if ((start > end) || (start >= str.size())) {
-            return std::string_view::npos;
-        }
-
-        if ((start != 0) || (end != std::string_view::npos)) {
-            end = std::min(end, str.size());
-            str = str.substr(start, end - start);
-        }
-
-        const auto& it = std::find_first_of(str.crbegin(), str.crend(), chars.cbegin(), chars.cend(),
-                                            equal_char_icase<std::string_view::value_type>);
+        return find_last_of_impl(str, chars, start, end, true);
+    }
 
-        return it == str.crend() ? std::string::npos : (start + (static_cast<std::size_t>(str.crend() - it) - 1));
+    std::size_t find_last_of_icase(const std::string_view str, const std::string_view chars, const std::size_t start,
+                                   const std::size_t end) noexcept
+    {
+        return find_last_of_impl(str, make_charset_icase(chars), start, end, true);
     }
 
     std::size_t find_last_not_of(std::string_view str, const std::string_view chars, const std::size_t start,
@@ -227,24 +223,15 @@ namespace strpy
         return std::string_view::npos;
     }
 
-    std::size_t find_last_not_of_icase(std::string_view str, const std::string_view chars, const std::size_t start,
-                                       std::size_t end) noexcept
+    std::size_t find_last_not_of(const std::string_view str, const CharSet& chars, const std::size_t start,
+                                 const std::size_t end) noexcept
     {
-        if ((start > end) || (start >= str.size())) {
-            return std::string_view::npos;
-        }
-
-        if ((start != 0) || (end != std::string_view::npos)) {
-            end = std::min(end, str.size());
-            str = str.substr(start, end - start);
-        }
-
-        const auto& it = std::find_if(str.crbegin(), str.crend(), [&chars](const auto ch1) {
-            return std::none_of(chars.cbegin(), chars.cend(), [ch1](const auto ch2) {
-                return equal_char_icase(ch1, ch2);
-            });
-        });
+        return find_last_of_impl(str, chars, start, end, false);
+    }
 
-        return it == str.crend() ? std::string::npos : (start + (static_cast<std::size_t>(str.crend() - it) - 1));
+    std::size_t find_last_not_of_icase(const std::string_view str, const std::string_view chars,
+                                       const std::size_t start, const std::size_t end) noexcept
+    {
+        return find_last_of_impl(str, make_charset_icase(chars), start, end, false);
     }
 }
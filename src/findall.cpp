@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/findall.hpp"
+#include "search.hpp"
+
+namespace strpy
+{
+    FindAllIterator::FindAllIterator(const std::string_view str, const std::string_view sub, const bool icase,
+                                     const bool overlapping) noexcept :
+        str_(str), sub_(sub), icase_(icase), overlapping_(overlapping)
+    {
+        // Follow strpy::count, which finds nothing in an empty string
+        if (!str_.empty()) {
+            pos_ = search(0);
+        }
+    }
+
+    FindAllIterator& FindAllIterator::operator++() noexcept
+    {
+        const auto step = (overlapping_ || sub_.empty()) ? 1 : sub_.size();
+        pos_ = search(pos_ + step);
+
+        return *this;
+    }
+
+    std::size_t FindAllIterator::search(const std::size_t pos) const noexcept
+    {
+        if ((pos > str_.size()) || (sub_.size() > (str_.size() - pos))) {
+            return std::string_view::npos;
+        }
+
+        if (!icase_) {
+            return str_.find(sub_, pos);
+        }
+
+        const auto result = detail::search_icase(str_.substr(pos), sub_);
+        return (std::string_view::npos == result) ? result : pos + result;
+    }
+}
@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/formattemplate.hpp"
+
+namespace
+{
+    /** @brief The maximum number of digits of a positional index, so that it does not overflow */
+    constexpr std::size_t MAX_INDEX_DIGITS = 9;
+
+    /** @brief Checks whether a character is a decimal digit */
+    constexpr bool is_digit(const char ch) noexcept
+    {
+        return (ch >= '0') && (ch <= '9');
+    }
+
+    /** @brief Checks whether a character can be a part of the name of a placeholder */
+    constexpr bool is_name_char(const char ch) noexcept
+    {
+        return is_digit(ch) || ((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || ('_' == ch);
+    }
+
+    /**
+     * @brief Reads the text between the braces of a placeholder
+     *
+     * The index of an empty field is the next automatic one, the index of a named field is npos.
+     * Returns false if the text is neither empty, an index nor a name.
+     */
+    bool parse_field(const std::string_view field, std::size_t& next_index, std::size_t& index) noexcept
+    {
+        if (field.empty()) {
+            index = next_index++;
+            return true;
+        }
+
+        if (is_digit(field.front())) {
+            if (field.size() > MAX_INDEX_DIGITS) {
+                return false;
+            }
+
+            index = 0;
+
+            for (const auto ch : field) {
+                if (!is_digit(ch)) {
+                    return false;
+                }
+
+                index = (index * 10) + static_cast<std::size_t>(ch - '0');
+            }
+
+            return true;
+        }
+
+        for (const auto ch : field) {
+            if (!is_name_char(ch)) {
+                return false;
+            }
+        }
+
+        index = std::string_view::npos;
+        return true;
+    }
+
+    /** @brief Finds the positional argument with an index, or the named argument with a name */
+    const strpy::detail::TemplateArg* find_arg(const strpy::detail::TemplateArg* const args, const std::size_t count,
+                                               std::size_t index, const std::string_view name) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (std::string_view::npos == index) {
+                if (args[i].named && (args[i].name == name)) {
+                    return args + i;
+                }
+            }
+            else if (!args[i].named && (0 == index--)) {
+                return args + i;
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+namespace strpy
+{
+    FormatTemplate::FormatTemplate(const std::string_view text) noexcept : text_(text)
+    {
+        std::size_t literal_begin = 0;
+        std::size_t next_index = 0;
+        std::size_t pos = 0;
+
+        while (pos < text.size()) {
+            const auto brace = text.find_first_of("{}", pos);
+
+            if (std::string_view::npos == brace) {
+                literals_.append(text.substr(pos));
+                break;
+            }
+
+            literals_.append(text.substr(pos, brace - pos));
+            pos = brace + 1;
+
+            // A doubled brace is an escaped one
+            if ((pos < text.size()) && (text[pos] == text[brace])) {
+                literals_.push_back(text[brace]);
+                ++pos;
+                continue;
+            }
+
+            if ('{' == text[brace]) {
+                const auto close = text.find('}', pos);
+                std::size_t index = 0;
+
+                if ((std::string_view::npos != close) &&
+                    parse_field(text.substr(pos, close - pos), next_index, index)) {
+                    segments_.push_back({literal_begin, literals_.size() - literal_begin, brace, close + 1 - brace,
+                                         index});
+                    literal_begin = literals_.size();
+                    pos = close + 1;
+                    continue;
+                }
+            }
+
+            // A brace that does not make a placeholder is kept
+            literals_.push_back(text[brace]);
+        }
+
+        segments_.push_back({literal_begin, literals_.size() - literal_begin, text.size(), 0, std::string_view::npos});
+    }
+
+    void FormatTemplate::render_args(std::string& out, const detail::TemplateArg* const args,
+                                     const std::size_t count) const
+    {
+        for (const auto& segment : segments_) {
+            out.append(literals_, segment.literal_begin, segment.literal_size);
+
+            if (0 == segment.placeholder_size) {
+                continue;
+            }
+
+            const auto* const arg =
+              find_arg(args, count, segment.index, segment.positional() ? std::string_view{} : name(segment));
+
+            if (nullptr != arg) {
+                arg->append(out, arg->value);
+            }
+            else {
+                out.append(text_, segment.placeholder_begin, segment.placeholder_size);
+            }
+        }
+    }
+
+    std::shared_ptr<const FormatTemplate> FormatTemplateCache::get(const std::string_view text)
+    {
+        {
+            const std::lock_guard lock{mutex_};
+
+            if (const auto it = index_.find(text); it != index_.end()) {
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return *it->second;
+            }
+        }
+
+        // The text is parsed without the lock, so that the other threads are not blocked
+        auto parsed = std::make_shared<const FormatTemplate>(text);
+        const std::lock_guard lock{mutex_};
+
+        // Another thread may have added the same text in the meantime
+        if (const auto it = index_.find(text); it != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return *it->second;
+        }
+
+        if (0 == capacity_) {
+            return parsed;
+        }
+
+        // The keys are views of the texts of the templates, which do not move while they are in the cache
+        entries_.push_front(parsed);
+        index_.emplace(parsed->text(), entries_.begin());
+
+        if (entries_.size() > capacity_) {
+            index_.erase(entries_.back()->text());
+            entries_.pop_back();
+        }
+
+        return parsed;
+    }
+
+    std::size_t FormatTemplateCache::size() const
+    {
+        const std::lock_guard lock{mutex_};
+        return entries_.size();
+    }
+
+    void FormatTemplateCache::clear()
+    {
+        const std::lock_guard lock{mutex_};
+        index_.clear();
+        entries_.clear();
+    }
+}
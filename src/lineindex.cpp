@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/lineindex.hpp"
+#include "linescan.hpp"
+#include "stringpy/const.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    /** @brief The largest offset of a line from the start of its block */
+    constexpr std::size_t MAX_OFFSET = std::numeric_limits<std::uint32_t>::max();
+}
+
+namespace strpy
+{
+    void LineIndex::append(const std::string_view text) noexcept
+    {
+        const auto indexed_size = text_.size();
+        text_ = text;
+
+        if (text.size() <= indexed_size) {
+            return;
+        }
+
+        auto pos = indexed_size;
+
+        if (0 == count_) {
+            push_start(0);
+        }
+        // A CR at the end of the indexed text and an LF at the start of the new bytes are a single CR LF
+        else if ((start(count_ - 1) == indexed_size) && (CARRIAGE_RETURN == text[indexed_size - 1]) &&
+                 (LINE_FEED == text[indexed_size])) {
+            set_last_start(++pos);
+        }
+
+        const auto rest = text.substr(pos);
+        detail::LineScanner scanner{rest};
+
+        for (auto end = scanner.next(); std::string_view::npos != end; end = scanner.next()) {
+            push_start(pos + detail::skip_line_break(rest, end));
+        }
+    }
+
+    std::string_view LineIndex::line(const std::size_t index, const bool keep_ends) const noexcept
+    {
+        const auto begin = start(index);
+
+        // The last line does not end with a line break
+        if ((index + 1) == count_) {
+            return text_.substr(begin);
+        }
+
+        const auto next = start(index + 1);
+
+        if (keep_ends) {
+            return text_.substr(begin, next - begin);
+        }
+
+        auto end = next - 1;
+
+        if ((LINE_FEED == text_[end]) && (end > begin) && (CARRIAGE_RETURN == text_[end - 1])) {
+            --end;
+        }
+
+        return text_.substr(begin, end - begin);
+    }
+
+    std::size_t LineIndex::line_of(const std::size_t offset) const noexcept
+    {
+        if (offset >= text_.size()) {
+            return std::string_view::npos;
+        }
+
+        if (wide_) {
+            const auto end = starts_.cbegin() + static_cast<std::ptrdiff_t>(count_);
+            return static_cast<std::size_t>(std::upper_bound(starts_.cbegin(), end, offset) - starts_.cbegin()) - 1;
+        }
+
+        // The first block starts at 0, so the block that contains the offset is always found
+        const auto block =
+          static_cast<std::size_t>(std::upper_bound(bases_.cbegin(), bases_.cend(), offset) - bases_.cbegin()) - 1;
+        const auto first = offsets_.cbegin() + static_cast<std::ptrdiff_t>(block * BLOCK_LINES);
+        const auto last = offsets_.cbegin() + static_cast<std::ptrdiff_t>(std::min(count_, (block + 1) * BLOCK_LINES));
+        const auto line = std::upper_bound(first, last, offset - bases_[block]) - offsets_.cbegin();
+
+        return static_cast<std::size_t>(line) - 1;
+    }
+
+    void LineIndex::push_start(const std::size_t pos) noexcept
+    {
+        if (!wide_) {
+            if (0 == (count_ % BLOCK_LINES)) {
+                bases_.push_back(pos);
+            }
+
+            if (const auto offset = pos - bases_.back(); offset <= MAX_OFFSET) {
+                offsets_.push_back(static_cast<std::uint32_t>(offset));
+                ++count_;
+                return;
+            }
+
+            widen();
+        }
+
+        starts_.push_back(pos);
+        ++count_;
+    }
+
+    void LineIndex::set_last_start(const std::size_t pos) noexcept
+    {
+        if (!wide_) {
+            // The last line is the first one of its block, so it is the base of the block
+            if (0 == ((count_ - 1) % BLOCK_LINES)) {
+                bases_.back() = pos;
+                return;
+            }
+
+            if (const auto offset = pos - bases_.back(); offset <= MAX_OFFSET) {
+                offsets_.back() = static_cast<std::uint32_t>(offset);
+                return;
+            }
+
+            widen();
+        }
+
+        starts_.back() = pos;
+    }
+
+    void LineIndex::widen() noexcept
+    {
+        starts_.reserve(count_ + 1);
+
+        for (std::size_t i = 0; i < count_; ++i) {
+            starts_.push_back(start(i));
+        }
+
+        wide_ = true;
+        bases_ = {};
+        offsets_ = {};
+    }
+}
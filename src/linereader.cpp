@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/linereader.hpp"
+#include "linescan.hpp"
+#include "stringpy/const.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+  #include <io.h>
+  #include <climits>
+#else
+  #include <unistd.h>
+#endif
+
+namespace
+{
+    /** @brief The smallest buffer that holds a CR LF line break */
+    constexpr std::size_t MIN_BUFFER_SIZE = 2;
+}
+
+namespace strpy
+{
+    LineReader::LineReader(const int fd, const bool keep_ends, const std::size_t buffer_size) noexcept :
+        fd_(fd), buffer_(std::max(MIN_BUFFER_SIZE, buffer_size)), keep_ends_(keep_ends)
+    {
+    }
+
+    LineReader::LineReader(std::istream& stream, const bool keep_ends, const std::size_t buffer_size) noexcept :
+        stream_(&stream), buffer_(std::max(MIN_BUFFER_SIZE, buffer_size)), keep_ends_(keep_ends)
+    {
+    }
+
+    bool LineReader::next(std::string_view& line) noexcept
+    {
+        for (;;) {
+            const std::string_view data{buffer_.data(), end_};
+            const auto end = detail::find_line_break(data, scan_);
+
+            if (std::string_view::npos == end) {
+                scan_ = end_;
+            }
+            // A CR at the end of the read input may be the first half of a CR LF
+            else if ((CARRIAGE_RETURN == data[end]) && ((end + 1) == end_) && (!eof_)) {
+                scan_ = end;
+            }
+            else {
+                const auto next = detail::skip_line_break(data, end);
+
+                line = data.substr(begin_, (keep_ends_ ? next : end) - begin_);
+                begin_ = scan_ = next;
+                partial_ = false;
+
+                return true;
+            }
+
+            if (eof_) {
+                if (begin_ == end_) {
+                    return false;
+                }
+
+                line = data.substr(begin_);
+                begin_ = scan_ = end_;
+                partial_ = false;
+
+                return true;
+            }
+
+            // The buffer holds a single incomplete line, which is returned in parts
+            if ((0 == begin_) && (end_ == buffer_.size())) {
+                const auto size = (CARRIAGE_RETURN == data.back()) ? (end_ - 1) : end_;
+
+                line = data.substr(0, size);
+                begin_ = scan_ = size;
+                partial_ = true;
+
+                return true;
+            }
+
+            refill();
+        }
+    }
+
+    std::size_t LineReader::read(char* const data, const std::size_t size) noexcept
+    {
+        if (nullptr != stream_) {
+            stream_->read(data, static_cast<std::streamsize>(size));
+
+            if (stream_->bad()) {
+                error_ = std::make_error_code(std::errc::io_error);
+            }
+
+            return static_cast<std::size_t>(stream_->gcount());
+        }
+
+        for (;;) {
+#ifdef _WIN32
+            const auto result = ::_read(fd_, data, static_cast<unsigned>(std::min<std::size_t>(size, INT_MAX)));
+#else
+            const auto result = ::read(fd_, data, size);
+#endif
+
+            if (result >= 0) {
+                return static_cast<std::size_t>(result);
+            }
+
+            if (EINTR != errno) {
+                error_ = {errno, std::generic_category()};
+                return 0;
+            }
+        }
+    }
+
+    void LineReader::refill() noexcept
+    {
+        if (begin_ != 0) {
+            std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+            end_ -= begin_;
+            scan_ -= begin_;
+            begin_ = 0;
+        }
+
+        const auto size = read(buffer_.data() + end_, buffer_.size() - end_);
+
+        // A stream ends at the first short read, a file descriptor at the first empty read
+        if ((0 == size) || ((nullptr != stream_) && (size < (buffer_.size() - end_))) || error_) {
+            eof_ = true;
+        }
+
+        end_ += size;
+    }
+}
@@ -0,0 +1,21 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "linescan.hpp"
+
+namespace strpy::detail
+{
+    std::size_t find_line_break(const std::string_view str, const std::size_t pos) noexcept
+    {
+        if (pos >= str.size()) {
+            return std::string_view::npos;
+        }
+
+        BlockScanner breaks{str.substr(pos), LineBreakClassifier{}};
+        const auto found = breaks.next();
+
+        return (std::string_view::npos == found) ? std::string_view::npos : (pos + found);
+    }
+}
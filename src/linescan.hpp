@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal scanner of the line breaks for the functions that split a string into lines.
+ */
+
+#pragma once
+
+#include "blockscan.hpp"
+#include "stringpy/const.hpp"
+#include <string_view>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace strpy::detail
+{
+    /** @brief The bytes that start a line break. */
+    constexpr std::array<std::string_view::value_type, 2> LINE_BREAK_BYTES = {LINE_FEED, CARRIAGE_RETURN};
+
+    /**
+     * @brief Classifies a block of bytes into a bitmask of carriage returns and line feeds.
+     */
+    struct LineBreakClassifier
+    {
+        /**
+         * @brief Classifies a block of bytes.
+         *
+         * @param data The bytes to classify.
+         * @param size The number of bytes, at most \ref BLOCK_SIZE.
+         *
+         * @return A mask with bit i set if the byte data[i] is a carriage return or a line feed.
+         */
+        [[nodiscard]] std::uint32_t operator()(const std::string_view::value_type* const data,
+                                               const std::size_t size) const noexcept
+        {
+            return equal_mask(data, size, LINE_BREAK_BYTES);
+        }
+    };
+
+    /**
+     * @brief Finds the first carriage return or line feed at or after a position.
+     *
+     * @param str The string to search within.
+     * @param pos The position to start the search at.
+     *
+     * @return The index of the found byte, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] std::size_t find_line_break(std::string_view str, std::size_t pos) noexcept;
+
+    /**
+     * @brief Returns the position after a line break.
+     *
+     * @param str The string that contains the line break.
+     * @param pos The position of the carriage return or the line feed that starts the line break.
+     *
+     * @return The position after the line feed of a CR LF, or after the byte at \p pos otherwise.
+     */
+    [[nodiscard]] constexpr std::size_t skip_line_break(const std::string_view str, const std::size_t pos) noexcept
+    {
+        const auto crlf = (CARRIAGE_RETURN == str[pos]) && ((pos + 1) < str.size()) && (LINE_FEED == str[pos + 1]);
+        return pos + (crlf ? 2 : 1);
+    }
+
+    /**
+     * @brief Finds, one after another, the line breaks of a string.
+     *
+     * The carriage returns and the line feeds are found by a \ref BlockScanner, and the line feed
+     * of a CR LF is skipped. The scanner refers to the string and must not outlive it.
+     */
+    class LineScanner
+    {
+    public:
+        /**
+         * @brief Constructs a scanner over a string.
+         *
+         * @param str The string to scan.
+         */
+        explicit LineScanner(const std::string_view str) noexcept : str_(str), breaks_(str, LineBreakClassifier{}) {}
+
+        /**
+         * @brief Finds the next line break.
+         *
+         * @return The index of the carriage return or the line feed that starts the next line break,
+         * or \c std::string_view::npos if there are no more line breaks.
+         */
+        [[nodiscard]] std::size_t next() noexcept
+        {
+            for (auto pos = breaks_.next(); pos != std::string_view::npos; pos = breaks_.next()) {
+                // The line feed of a CR LF, possibly the first byte of the next block
+                if (pos >= skip_) {
+                    skip_ = skip_line_break(str_, pos);
+                    return pos;
+                }
+            }
+
+            return std::string_view::npos;
+        }
+
+    private:
+        std::string_view str_;
+        BlockScanner<LineBreakClassifier> breaks_;
+        std::size_t skip_ = 0;
+    };
+}
@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/mappedfile.hpp"
+#include <cerrno>
+#include <utility>
+
+#ifdef _WIN32
+  #include <cstdio>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+    /** @brief The size of the first read of a file whose size is unknown */
+    constexpr std::size_t INITIAL_READ_SIZE = std::size_t{1} << 16U;
+
+    /** @brief Returns the error of the last failed system call */
+    [[nodiscard]] std::error_code last_error() noexcept
+    {
+        return {errno, std::generic_category()};
+    }
+
+#ifndef _WIN32
+    /** @brief Checks whether an option is set */
+    [[nodiscard]] bool has_option(const strpy::MappedFileOptions options,
+                                  const strpy::MappedFileOptions option) noexcept
+    {
+        return (options & option) != strpy::MappedFileOptions::none;
+    }
+
+    /** @brief Closes a file descriptor when it goes out of scope */
+    class FileDescriptor
+    {
+    public:
+        explicit FileDescriptor(const int fd) noexcept : fd_(fd) {}
+
+        FileDescriptor(const FileDescriptor&) = delete;
+        FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+        ~FileDescriptor() noexcept
+        {
+            if (fd_ >= 0) {
+                ::close(fd_);
+            }
+        }
+
+        [[nodiscard]] int get() const noexcept
+        {
+            return fd_;
+        }
+
+    private:
+        int fd_;
+    };
+
+    /** @brief Reads a file from its current position to the end, the size is a hint for the first read */
+    [[nodiscard]] std::error_code read_all(const int fd, std::size_t size, std::vector<char>& buffer) noexcept
+    {
+        // One byte more than the expected size detects the end of the file without another resize
+        buffer.resize(((size != 0) ? size : INITIAL_READ_SIZE) + 1);
+        size = 0;
+
+        for (;;) {
+            if (size == buffer.size()) {
+                buffer.resize(buffer.size() * 2);
+            }
+
+            const auto result = ::read(fd, buffer.data() + size, buffer.size() - size);
+
+            if (result > 0) {
+                size += static_cast<std::size_t>(result);
+            }
+            else if (0 == result) {
+                break;
+            }
+            else if (EINTR != errno) {
+                return last_error();
+            }
+        }
+
+        buffer.resize(size);
+        return {};
+    }
+
+    /** @brief Gives the kernel the access pattern of a mapping */
+    void advise(void* const mapping, const std::size_t size, const strpy::MappedFileOptions options) noexcept
+    {
+        // The advice only affects performance, so its errors are ignored
+        if (has_option(options, strpy::MappedFileOptions::sequential)) {
+            static_cast<void>(::madvise(mapping, size, MADV_SEQUENTIAL));
+        }
+  #ifdef MADV_HUGEPAGE
+        if (has_option(options, strpy::MappedFileOptions::huge_pages)) {
+            static_cast<void>(::madvise(mapping, size, MADV_HUGEPAGE));
+        }
+  #endif
+    }
+#else
+    /** @brief Closes a file when it goes out of scope */
+    class File
+    {
+    public:
+        explicit File(std::FILE* const file) noexcept : file_(file) {}
+
+        File(const File&) = delete;
+        File& operator=(const File&) = delete;
+
+        ~File() noexcept
+        {
+            if (nullptr != file_) {
+                static_cast<void>(std::fclose(file_));
+            }
+        }
+
+        [[nodiscard]] std::FILE* get() const noexcept
+        {
+            return file_;
+        }
+
+    private:
+        std::FILE* file_;
+    };
+
+    /** @brief Reads a file from its current position to the end */
+    [[nodiscard]] std::error_code read_all(std::FILE* const file, std::vector<char>& buffer) noexcept
+    {
+        std::size_t size = 0;
+        buffer.resize(INITIAL_READ_SIZE);
+
+        for (;;) {
+            size += std::fread(buffer.data() + size, 1, buffer.size() - size, file);
+
+            if (size < buffer.size()) {
+                break;
+            }
+
+            buffer.resize(buffer.size() * 2);
+        }
+
+        if (0 != std::ferror(file)) {
+            return std::make_error_code(std::errc::io_error);
+        }
+
+        buffer.resize(size);
+        return {};
+    }
+#endif
+}
+
+namespace strpy
+{
+    MappedFile::MappedFile(MappedFile&& other) noexcept :
+        mapping_(std::exchange(other.mapping_, nullptr)), buffer_(std::move(other.buffer_)),
+        contents_(std::exchange(other.contents_, {}))
+    {
+    }
+
+    MappedFile::~MappedFile() noexcept
+    {
+        reset();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            mapping_ = std::exchange(other.mapping_, nullptr);
+            buffer_ = std::move(other.buffer_);
+            contents_ = std::exchange(other.contents_, {});
+        }
+
+        return *this;
+    }
+
+    void MappedFile::reset() noexcept
+    {
+#ifndef _WIN32
+        if (nullptr != mapping_) {
+            static_cast<void>(::munmap(mapping_, contents_.size()));
+        }
+#endif
+        mapping_ = nullptr;
+        buffer_ = {};
+        contents_ = {};
+    }
+
+    MappedFile make_mapped_file(const std::string& path, std::error_code& error,
+                                const MappedFileOptions options) noexcept
+    {
+        MappedFile result{};
+        error.clear();
+
+#ifndef _WIN32
+        const FileDescriptor file{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+        struct stat status{};
+
+        if ((file.get() < 0) || (::fstat(file.get(), &status) != 0)) {
+            error = last_error();
+            return result;
+        }
+
+        const auto size = static_cast<std::size_t>(status.st_size);
+
+        // Files that report no size, such as pipes and the files of /proc, may still have contents
+        if (S_ISREG(status.st_mode) && (size != 0) && (!has_option(options, MappedFileOptions::no_map))) {
+            if (auto* const mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file.get(), 0);
+                MAP_FAILED != mapping) {
+                advise(mapping, size, options);
+                result.mapping_ = mapping;
+                result.contents_ = {static_cast<const char*>(mapping), size};
+                return result;
+            }
+        }
+
+        error = read_all(file.get(), S_ISREG(status.st_mode) ? size : 0, result.buffer_);
+#else
+        // Files are not mapped on this system, so the options do not apply
+        static_cast<void>(options);
+        const File file{std::fopen(path.c_str(), "rb")};
+
+        if (nullptr == file.get()) {
+            error = last_error();
+            return result;
+        }
+
+        error = read_all(file.get(), result.buffer_);
+#endif
+
+        if (error) {
+            result.buffer_ = {};
+        }
+        else {
+            result.contents_ = {result.buffer_.data(), result.buffer_.size()};
+        }
+
+        return result;
+    }
+}
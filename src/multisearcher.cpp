@@ -0,0 +1,466 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/multisearcher.hpp"
+#include "stringpy/ctype.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+namespace
+{
+    /** @brief Number of distinct byte values */
+    constexpr std::size_t BYTE_VALUES = std::numeric_limits<unsigned char>::max() + 1;
+
+    /** @brief Number of strpy::MatchKind values, each of them has its own leftmost automaton */
+    constexpr std::size_t MATCH_KINDS = 2;
+
+    /** @brief Type of an automaton state index */
+    using State = std::uint32_t;
+
+    /** @brief Marks the absence of a state or a pattern */
+    constexpr State NONE = std::numeric_limits<State>::max();
+
+    /** @brief The state where a leftmost search stops, because no later match can win over the found one */
+    constexpr State DEAD = NONE;
+
+    /** @brief The initial state of the automaton */
+    constexpr State ROOT = 0;
+
+    /** @brief Convert a character to an index into the byte tables */
+    unsigned char to_byte(const char ch) noexcept
+    {
+        return static_cast<unsigned char>(ch);
+    }
+}
+
+namespace strpy::detail
+{
+    /** @brief Full DFA over the byte classes of the patterns */
+    struct Automaton
+    {
+        /** @brief Transitions, <tt>class_count</tt> entries per state */
+        std::vector<State> transitions{};
+
+        /** @brief Failure link of every state, DEAD after a match in a leftmost automaton */
+        std::vector<State> fail{};
+
+        /** @brief The first pattern ending at a state, or NONE */
+        std::vector<State> terminal{};
+
+        /** @brief The next pattern ending at the same state as a pattern, or NONE */
+        std::vector<State> duplicate{};
+
+        /** @brief The nearest state on the failure chain (including the state itself) where a pattern ends */
+        std::vector<State> output{};
+
+        /** @brief The pattern reported by a leftmost search in a state, or NONE */
+        std::vector<State> best{};
+    };
+
+    /** @brief Immutable compiled automaton shared between copies of a strpy::MultiSearcher */
+    struct MultiSearcherData
+    {
+        /** @brief The patterns as they were given */
+        std::vector<std::string> patterns{};
+
+        /** @brief Maps every input byte (folded for a case-insensitive searcher) to its byte class */
+        std::array<std::uint16_t, BYTE_VALUES> byte_class{};
+
+        /** @brief Number of byte classes, class 0 groups the bytes that do not occur in the patterns */
+        std::size_t class_count = 1;
+
+        /** @brief The automaton reporting every occurrence of every pattern */
+        Automaton overlapping{};
+
+        /** @brief The automata of the leftmost searches by strpy::MatchKind, built on first use */
+        mutable std::array<Automaton, MATCH_KINDS> leftmost{};
+
+        /** @brief Guards the construction of the leftmost automata */
+        mutable std::array<std::once_flag, MATCH_KINDS> leftmost_built{};
+
+        /** @brief Whether the case is ignored */
+        bool icase = false;
+
+        [[nodiscard]] State step(const Automaton& automaton, const State state, const char ch) const noexcept
+        {
+            return automaton.transitions[(state * class_count) + byte_class[to_byte(ch)]];
+        }
+    };
+}
+
+namespace
+{
+    using strpy::detail::Automaton;
+    using strpy::detail::MultiSearcherData;
+
+    /** @brief Assign byte classes to the bytes of the patterns */
+    void build_byte_classes(MultiSearcherData& data, const std::array<unsigned char, BYTE_VALUES>& fold)
+    {
+        std::array<std::uint16_t, BYTE_VALUES> folded_class{};
+
+        for (const auto& pattern : data.patterns) {
+            for (const auto ch : pattern) {
+                if (auto& cls = folded_class[fold[to_byte(ch)]]; cls == 0) {
+                    cls = static_cast<std::uint16_t>(data.class_count++);
+                }
+            }
+        }
+
+        for (std::size_t ch = 0; ch < BYTE_VALUES; ++ch) {
+            data.byte_class[ch] = folded_class[fold[ch]];
+        }
+    }
+
+    /**
+     * @brief Build the trie of the patterns, missing transitions are set to NONE
+     *
+     * With leftmost_first, a pattern that has a previous pattern as a prefix is left out,
+     * because the previous pattern always wins over it.
+     */
+    void build_trie(const MultiSearcherData& data, Automaton& automaton, const bool leftmost_first)
+    {
+        const auto classes = data.class_count;
+        automaton.transitions.assign(classes, NONE);
+        automaton.terminal.assign(1, NONE);
+        automaton.duplicate.assign(data.patterns.size(), NONE);
+
+        for (std::size_t index = 0; index < data.patterns.size(); ++index) {
+            const auto& pattern = data.patterns[index];
+            State state = ROOT;
+
+            for (const auto ch : pattern) {
+                if (leftmost_first && (automaton.terminal[state] != NONE)) {
+                    state = NONE;
+                    break;
+                }
+
+                const auto slot = (state * classes) + data.byte_class[to_byte(ch)];
+
+                if (NONE == automaton.transitions[slot]) {
+                    automaton.transitions[slot] = static_cast<State>(automaton.terminal.size());
+                    automaton.transitions.resize(automaton.transitions.size() + classes, NONE);
+                    automaton.terminal.push_back(NONE);
+                }
+
+                state = automaton.transitions[slot];
+            }
+
+            // Empty patterns never end at a state
+            if ((ROOT == state) || (NONE == state)) {
+                continue;
+            }
+
+            // Keep the patterns ending at the same state ordered by index
+            auto* link = &automaton.terminal[state];
+
+            while (*link != NONE) {
+                link = &automaton.duplicate[*link];
+            }
+
+            *link = static_cast<State>(index);
+        }
+    }
+
+    /** @brief Compute failure and output links and turn the trie into a full DFA */
+    void build_links(const MultiSearcherData& data, Automaton& automaton)
+    {
+        const auto classes = data.class_count;
+        const auto state_count = automaton.terminal.size();
+        auto& transitions = automaton.transitions;
+        automaton.fail.assign(state_count, ROOT);
+        automaton.output.assign(state_count, NONE);
+
+        std::vector<State> queue{};
+        queue.reserve(state_count);
+
+        for (std::size_t cls = 0; cls < classes; ++cls) {
+            if (auto& next = transitions[cls]; NONE == next) {
+                next = ROOT;
+            }
+            else {
+                queue.push_back(next);
+            }
+        }
+
+        for (std::size_t head = 0; head < queue.size(); ++head) {
+            const auto state = queue[head];
+            const auto fail = automaton.fail[state];
+            automaton.output[state] = (automaton.terminal[state] != NONE) ? state : automaton.output[fail];
+
+            for (std::size_t cls = 0; cls < classes; ++cls) {
+                auto& next = transitions[(state * classes) + cls];
+                const auto fallback = transitions[(fail * classes) + cls];
+
+                if (NONE == next) {
+                    next = fallback;
+                }
+                else {
+                    automaton.fail[next] = fallback;
+                    queue.push_back(next);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Compute failure links and the reported patterns of a leftmost search and turn the trie into a full DFA
+     *
+     * A state where a pattern ends fails to DEAD and so does every state after it: once a match is found,
+     * only a longer match starting at the same position is followed, and the search stops in DEAD
+     * as soon as no such match is possible. A state without a pattern of its own reports
+     * the pattern of its failure state, which is the leftmost match ending there.
+     */
+    void build_leftmost_links(const MultiSearcherData& data, Automaton& automaton)
+    {
+        const auto classes = data.class_count;
+        const auto state_count = automaton.terminal.size();
+        auto& transitions = automaton.transitions;
+        automaton.fail.assign(state_count, ROOT);
+        automaton.best.assign(state_count, NONE);
+
+        std::vector<State> queue{};
+        queue.reserve(state_count);
+
+        for (std::size_t cls = 0; cls < classes; ++cls) {
+            if (auto& next = transitions[cls]; NONE == next) {
+                next = ROOT;
+            }
+            else {
+                automaton.fail[next] = (automaton.terminal[next] != NONE) ? DEAD : ROOT;
+                queue.push_back(next);
+            }
+        }
+
+        for (std::size_t head = 0; head < queue.size(); ++head) {
+            const auto state = queue[head];
+            const auto fail = automaton.fail[state];
+
+            if (automaton.terminal[state] != NONE) {
+                automaton.best[state] = automaton.terminal[state];
+            }
+            else if (fail != DEAD) {
+                automaton.best[state] = automaton.best[fail];
+            }
+
+            // The row of the failure state is complete, it is closer to the root
+            for (std::size_t cls = 0; cls < classes; ++cls) {
+                auto& next = transitions[(state * classes) + cls];
+                const auto fallback = (DEAD == fail) ? DEAD : transitions[(fail * classes) + cls];
+
+                if (NONE == next) {
+                    next = fallback;
+                }
+                else {
+                    automaton.fail[next] = (automaton.terminal[next] != NONE) ? DEAD : fallback;
+                    queue.push_back(next);
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<const MultiSearcherData> make_data(const std::vector<std::string_view>& patterns,
+                                                       const bool icase)
+    {
+        auto data = std::make_shared<MultiSearcherData>();
+        data->patterns.assign(patterns.cbegin(), patterns.cend());
+        data->icase = icase;
+
+        std::array<unsigned char, BYTE_VALUES> fold{};
+
+        for (std::size_t ch = 0; ch < BYTE_VALUES; ++ch) {
+            const auto byte = static_cast<unsigned char>(ch);
+            fold[ch] = icase ? strpy::to_upper_char<unsigned char>(byte) : byte;
+        }
+
+        build_byte_classes(*data, fold);
+        build_trie(*data, data->overlapping, false);
+        build_links(*data, data->overlapping);
+
+        return data;
+    }
+
+    /** @brief The automaton of a searcher without patterns */
+    const MultiSearcherData& empty_data() noexcept
+    {
+        static const auto data = make_data({}, false);
+        return *data;
+    }
+
+    /** @brief Returns the automaton of the leftmost searches with a match kind, building it on first use */
+    const Automaton& leftmost_automaton(const MultiSearcherData& data, const strpy::MatchKind kind)
+    {
+        const auto longest = strpy::MatchKind::leftmost_longest == kind;
+        const std::size_t index = longest ? 1 : 0;
+
+        std::call_once(data.leftmost_built[index], [&data, index, longest] {
+            build_trie(data, data.leftmost[index], !longest);
+            build_leftmost_links(data, data.leftmost[index]);
+        });
+
+        return data.leftmost[index];
+    }
+
+    /** @brief Call func(pattern, start) for every pattern ending at position end - 1 in the given state */
+    template <typename Func>
+    void for_each_output(const MultiSearcherData& data, const State state, const std::size_t end, Func&& func)
+    {
+        const auto& automaton = data.overlapping;
+
+        for (auto out = automaton.output[state]; out != NONE; out = automaton.output[automaton.fail[out]]) {
+            for (auto pattern = automaton.terminal[out]; pattern != NONE; pattern = automaton.duplicate[pattern]) {
+                func(pattern, end - data.patterns[pattern].size());
+            }
+        }
+    }
+
+    /** @brief Find the leftmost match starting at or after pos */
+    strpy::Match find_leftmost(const MultiSearcherData& data, const Automaton& automaton, const std::string_view str,
+                               const std::size_t pos) noexcept
+    {
+        strpy::Match best{};
+        State state = ROOT;
+
+        for (auto i = pos; i < str.size(); ++i) {
+            state = data.step(automaton, state, str[i]);
+
+            if (DEAD == state) {
+                break;
+            }
+
+            // A later match in the same scan starts at the same position and is better
+            if (const auto pattern = automaton.best[state]; pattern != NONE) {
+                const auto length = data.patterns[pattern].size();
+                best = {(i + 1) - length, length, pattern};
+            }
+        }
+
+        return best;
+    }
+}
+
+namespace strpy
+{
+    MultiSearcher::MultiSearcher() noexcept = default;
+
+    MultiSearcher::MultiSearcher(std::shared_ptr<const detail::MultiSearcherData> data) noexcept :
+        data_(std::move(data))
+    {
+    }
+
+    Match MultiSearcher::find_any(const std::string_view str, const std::size_t start,
+                                  const MatchKind kind) const noexcept
+    {
+        if (start >= str.size()) {
+            return {};
+        }
+
+        const auto& data = data_ ? *data_ : empty_data();
+        return find_leftmost(data, leftmost_automaton(data, kind), str, start);
+    }
+
+    std::vector<std::size_t> MultiSearcher::count_each(const std::string_view str) const noexcept
+    {
+        const auto& data = data_ ? *data_ : empty_data();
+        const auto pattern_count = data.patterns.size();
+        std::vector<std::size_t> result(pattern_count, 0);
+        std::vector<std::size_t> next_start(pattern_count, 0);
+        State state = ROOT;
+
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            state = data.step(data.overlapping, state, str[i]);
+
+            for_each_output(data, state, i + 1, [&](const std::size_t pattern, const std::size_t start) {
+                if (start >= next_start[pattern]) {
+                    next_start[pattern] = i + 1;
+                    ++result[pattern];
+                }
+            });
+        }
+
+        for (std::size_t pattern = 0; pattern < pattern_count; ++pattern) {
+            if (data.patterns[pattern].empty() && !str.empty()) {
+                result[pattern] = str.size() + 1;
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<Match> MultiSearcher::find_all_matches(const std::string_view str) const noexcept
+    {
+        const auto& data = data_ ? *data_ : empty_data();
+        std::vector<Match> result{};
+        State state = ROOT;
+
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            state = data.step(data.overlapping, state, str[i]);
+
+            for_each_output(data, state, i + 1, [&](const std::size_t pattern, const std::size_t start) {
+                result.push_back({start, data.patterns[pattern].size(), pattern});
+            });
+        }
+
+        std::sort(result.begin(), result.end(), [](const Match& lhs, const Match& rhs) {
+            return (lhs.position != rhs.position) ? (lhs.position < rhs.position) : (lhs.pattern < rhs.pattern);
+        });
+
+        return result;
+    }
+
+    std::string MultiSearcher::replace_many(const std::string_view str,
+                                            const std::vector<std::string_view>& replacements,
+                                            const MatchKind kind) const noexcept
+    {
+        const auto& data = data_ ? *data_ : empty_data();
+        const auto& automaton = leftmost_automaton(data, kind);
+        std::string result{};
+        result.reserve(str.size());
+        std::size_t pos = 0;
+
+        for (auto match = find_leftmost(data, automaton, str, pos); match.position != std::string_view::npos;
+             match = find_leftmost(data, automaton, str, pos)) {
+            result.append(str.substr(pos, match.position - pos));
+
+            if (match.pattern < replacements.size()) {
+                result.append(replacements[match.pattern]);
+            }
+
+            pos = match.position + match.length;
+        }
+
+        result.append(str.substr(pos));
+        return result;
+    }
+
+    std::size_t MultiSearcher::size() const noexcept
+    {
+        return data_ ? data_->patterns.size() : 0;
+    }
+
+    std::string_view MultiSearcher::pattern(const std::size_t index) const noexcept
+    {
+        return (data_ && (index < data_->patterns.size())) ? std::string_view{data_->patterns[index]}
+                                                           : std::string_view{};
+    }
+
+    bool MultiSearcher::icase() const noexcept
+    {
+        return data_ && data_->icase;
+    }
+
+    MultiSearcher make_multi_searcher(const std::vector<std::string_view>& patterns) noexcept
+    {
+        return MultiSearcher{make_data(patterns, false)};
+    }
+
+    MultiSearcher make_multi_searcher_icase(const std::vector<std::string_view>& patterns) noexcept
+    {
+        return MultiSearcher{make_data(patterns, true)};
+    }
+}
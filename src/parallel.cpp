@@ -0,0 +1,466 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/parallel.hpp"
+#include "bytescan.hpp"
+#include "linescan.hpp"
+#include "splitoutput.hpp"
+#include "stringpy/count.hpp"
+#include "stringpy/find.hpp"
+#include "stringpy/splitlines.hpp"
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /** @brief The smallest chunk that is worth a task when the number of chunks is chosen automatically */
+    constexpr std::size_t MIN_CHUNK_SIZE = std::size_t{1} << 18U;
+
+    /** @brief Number of chunks per thread when the number of chunks is chosen automatically */
+    constexpr std::size_t CHUNKS_PER_THREAD = 4;
+
+    /** @brief Returns the number of threads to use for the given requested number */
+    std::size_t resolve_thread_count(const std::size_t thread_count) noexcept
+    {
+        if (thread_count != 0) {
+            return thread_count;
+        }
+
+        return std::max(std::size_t{1}, std::size_t{std::thread::hardware_concurrency()});
+    }
+
+    /** @brief Returns the number of chunks to split a string into, 1 means that splitting is not worth it */
+    std::size_t resolve_chunk_count(const std::size_t str_size, const std::size_t sub_size,
+                                    const std::size_t max_chunks, const std::size_t min_chunk_size) noexcept
+    {
+        if (0 == sub_size) {
+            return 1;
+        }
+
+        return std::max(std::size_t{1}, std::min(max_chunks, str_size / std::max(min_chunk_size, sub_size)));
+    }
+
+    /** @brief Returns the number of chunks for the executor overloads */
+    std::size_t resolve_chunk_count(const std::size_t str_size, const std::size_t sub_size,
+                                    const std::size_t chunk_count) noexcept
+    {
+        if (chunk_count != 0) {
+            return resolve_chunk_count(str_size, sub_size, chunk_count, 1);
+        }
+
+        return resolve_chunk_count(str_size, sub_size, CHUNKS_PER_THREAD * resolve_thread_count(0), MIN_CHUNK_SIZE);
+    }
+
+    /** @brief A part of the string searched by one task */
+    struct Chunk
+    {
+        /** @brief The position of the first byte of the chunk */
+        std::size_t begin;
+
+        /** @brief The position after the last byte of the chunk */
+        std::size_t end;
+    };
+
+    Chunk make_chunk(const std::size_t str_size, const std::size_t chunk_count, const std::size_t index) noexcept
+    {
+        return {(str_size / chunk_count) * index + ((str_size % chunk_count) * index) / chunk_count,
+                (str_size / chunk_count) * (index + 1) + ((str_size % chunk_count) * (index + 1)) / chunk_count};
+    }
+
+    /** @brief Returns the start of the first line that starts at or after a position */
+    std::size_t next_line_start(const std::string_view str, const std::size_t pos) noexcept
+    {
+        if (0 == pos) {
+            return 0;
+        }
+
+        // A line break that ends right at the position is found from the byte before it
+        const auto end = strpy::detail::find_line_break(str, pos - 1);
+        return (std::string_view::npos == end) ? str.size() : strpy::detail::skip_line_break(str, end);
+    }
+
+    /**
+     * @brief Returns the start of the first record that starts at or after a position,
+     * or \c std::string_view::npos if the last record starts before it
+     */
+    std::size_t next_record_start(const std::string_view str, const char delimiter, const std::size_t pos) noexcept
+    {
+        if (0 == pos) {
+            return 0;
+        }
+
+        const auto end = strpy::detail::find_byte(str, delimiter, pos - 1);
+        return (std::string_view::npos == end) ? std::string_view::npos : (end + 1);
+    }
+
+    /** @brief Find the first occurrence starting within [pos, limit) */
+    std::size_t find_before(const std::string_view str, const std::string_view sub, const std::size_t pos,
+                            const std::size_t limit) noexcept
+    {
+        if (pos >= limit) {
+            return std::string_view::npos;
+        }
+
+        return str.substr(0, std::min(str.size(), limit + sub.size() - 1)).find(sub, pos);
+    }
+
+    /** @brief Result of counting the occurrences that start within a chunk, scanning from a position */
+    struct ChunkCount
+    {
+        /** @brief Number of non-overlapping occurrences */
+        std::size_t count = 0;
+
+        /** @brief The position after the last counted occurrence */
+        std::size_t next = 0;
+    };
+
+    /** @brief The counts of a chunk for every position at which the sequential scan can enter it */
+    struct ChunkCounts
+    {
+        /** @brief The count scanning from the beginning of the chunk */
+        ChunkCount first{};
+
+        /** @brief The entries inside the chunk, the ends of the occurrences that start before it, in order */
+        std::vector<std::size_t> entries{};
+
+        /** @brief The count scanning from each entry */
+        std::vector<ChunkCount> entry_counts{};
+    };
+
+    /**
+     * @brief Counts the occurrences that start within a chunk from its beginning and from each of its entries.
+     *
+     * The sequential scan enters a chunk at its beginning or at the end of an occurrence that starts
+     * less than the size of the substring before it. The scans from all these positions are followed
+     * together, in the order of their current occurrences, and two scans that reach the same occurrence
+     * are identical after it, so only one of them goes on. The scans are out of phase and all go on
+     * only when the substring overlaps itself in a periodic text, such as "aa" in "aaaa".
+     */
+    ChunkCounts count_chunk(const std::string_view str, const std::string_view sub, const Chunk& chunk) noexcept
+    {
+        ChunkCounts result{};
+        std::vector<std::size_t> starts{chunk.begin};
+
+        for (auto pos = find_before(str, sub, chunk.begin - std::min(chunk.begin, sub.size() - 1), chunk.begin);
+             pos != std::string_view::npos; pos = find_before(str, sub, pos + 1, chunk.begin)) {
+            result.entries.push_back(pos + sub.size());
+            starts.push_back(pos + sub.size());
+        }
+
+        /** @brief A scan that was merged into another one */
+        struct Merge
+        {
+            std::size_t into;
+            std::size_t count;
+            std::size_t into_count;
+        };
+
+        // The current occurrence and the index of every scan that goes on, in order
+        using Scan = std::pair<std::size_t, std::size_t>;
+        std::vector<Scan> scans{};
+        std::vector<ChunkCount> counts(starts.size());
+        std::vector<Merge> merges(starts.size(), Merge{std::string_view::npos, 0, 0});
+
+        // There is no occurrence before the first one of the scan from the beginning of the chunk,
+        // so a scan from an entry up to it starts with it as well
+        const auto first = find_before(str, sub, chunk.begin, chunk.end);
+
+        for (std::size_t index = 0; (index < starts.size()) && (first != std::string_view::npos); ++index) {
+            const auto pos = (starts[index] <= first) ? first : find_before(str, sub, starts[index], chunk.end);
+
+            if (pos != std::string_view::npos) {
+                scans.emplace_back(pos, index);
+            }
+        }
+
+        std::sort(scans.begin(), scans.end());
+
+        while (!scans.empty()) {
+            const auto [pos, index] = scans.front();
+
+            // The scans with a larger index at the same occurrence follow the scan with the smallest one
+            while ((scans.size() > 1) && (scans[1].first == pos)) {
+                const auto other = scans[1].second;
+                merges[other] = {index, counts[other].count, counts[index].count};
+                scans.erase(scans.begin() + 1);
+            }
+
+            ++counts[index].count;
+            counts[index].next = pos + sub.size();
+
+            const auto next = find_before(str, sub, pos + sub.size(), chunk.end);
+
+            if (std::string_view::npos == next) {
+                scans.erase(scans.begin());
+                continue;
+            }
+
+            // Only the scans that are out of phase with this one remain, usually very few of them
+            scans.front().first = next;
+
+            for (std::size_t i = 1; (i < scans.size()) && (scans[i] < scans[i - 1]); ++i) {
+                std::swap(scans[i], scans[i - 1]);
+            }
+        }
+
+        // A scan is merged into a scan with a smaller index, which is resolved before it
+        for (std::size_t index = 0; index < starts.size(); ++index) {
+            if (const auto& merge = merges[index]; merge.into != std::string_view::npos) {
+                counts[index] = {merge.count + (counts[merge.into].count - merge.into_count), counts[merge.into].next};
+            }
+        }
+
+        result.first = counts.front();
+        result.entry_counts.assign(counts.cbegin() + 1, counts.cend());
+
+        return result;
+    }
+
+    /**
+     * @brief Merge the per-chunk counts in order.
+     *
+     * A chunk is entered at its beginning, or at the end of the last occurrence counted before it,
+     * which is one of the entries of the chunk. Either way its count was already computed by its task.
+     */
+    std::size_t merge_counts(const std::vector<ChunkCounts>& counts) noexcept
+    {
+        std::size_t total = 0;
+        std::size_t carried = 0;
+
+        for (const auto& chunk : counts) {
+            const auto* result = &chunk.first;
+
+            if (const auto entry = std::lower_bound(chunk.entries.cbegin(), chunk.entries.cend(), carried);
+                (entry != chunk.entries.cend()) && (*entry == carried)) {
+                result = &chunk.entry_counts[static_cast<std::size_t>(entry - chunk.entries.cbegin())];
+            }
+
+            total += result->count;
+            carried = (result->count != 0) ? result->next : carried;
+        }
+
+        return total;
+    }
+}
+
+namespace strpy::par
+{
+    Executor make_thread_executor(const std::size_t thread_count) noexcept
+    {
+        return [thread_count = resolve_thread_count(thread_count)](const std::size_t task_count, const Task& task) {
+            if (0 == task_count) {
+                return;
+            }
+
+            std::atomic<std::size_t> next_task{0};
+
+            const auto worker = [&next_task, &task, task_count] {
+                for (auto index = next_task++; index < task_count; index = next_task++) {
+                    task(index);
+                }
+            };
+
+            std::vector<std::thread> threads{};
+            const auto extra_threads = std::min(thread_count, task_count) - 1;
+            threads.reserve(extra_threads);
+
+            try {
+                for (std::size_t i = 0; i < extra_threads; ++i) {
+                    threads.emplace_back(worker);
+                }
+            }
+            catch (const std::system_error&) {
+                // Run the remaining tasks on the threads that were created
+            }
+
+            worker();
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        };
+    }
+
+    std::size_t count(const std::string_view str, const std::string_view sub, const Executor& executor,
+                      const std::size_t chunk_count) noexcept
+    {
+        const auto chunks = resolve_chunk_count(str.size(), sub.size(), chunk_count);
+
+        if (chunks <= 1) {
+            return strpy::count(str, sub);
+        }
+
+        std::vector<ChunkCounts> counts(chunks);
+
+        executor(chunks, [&](const std::size_t index) {
+            counts[index] = count_chunk(str, sub, make_chunk(str.size(), chunks, index));
+        });
+
+        return merge_counts(counts);
+    }
+
+    std::size_t count(const std::string_view str, const std::string_view sub, const std::size_t thread_count) noexcept
+    {
+        const auto threads = resolve_thread_count(thread_count);
+        const auto chunks = resolve_chunk_count(str.size(), sub.size(), CHUNKS_PER_THREAD * threads, MIN_CHUNK_SIZE);
+
+        if ((threads <= 1) || (chunks <= 1)) {
+            return strpy::count(str, sub);
+        }
+
+        return count(str, sub, make_thread_executor(threads), chunks);
+    }
+
+    std::size_t find(const std::string_view str, const std::string_view sub, const Executor& executor,
+                     const std::size_t chunk_count) noexcept
+    {
+        const auto chunks = resolve_chunk_count(str.size(), sub.size(), chunk_count);
+
+        if (chunks <= 1) {
+            return strpy::find(str, sub);
+        }
+
+        std::atomic<std::size_t> best{std::string_view::npos};
+
+        executor(chunks, [&](const std::size_t index) {
+            const auto chunk = make_chunk(str.size(), chunks, index);
+
+            // An occurrence was already found before this chunk
+            if (best.load(std::memory_order_relaxed) < chunk.begin) {
+                return;
+            }
+
+            if (const auto pos = find_before(str, sub, chunk.begin, chunk.end); pos != std::string_view::npos) {
+                auto current = best.load(std::memory_order_relaxed);
+
+                // Keep the smallest position, compare_exchange_weak reloads current on failure
+                while ((pos < current) && !best.compare_exchange_weak(current, pos, std::memory_order_relaxed)) {
+                    continue;
+                }
+            }
+        });
+
+        return best.load();
+    }
+
+    std::size_t find(const std::string_view str, const std::string_view sub, const std::size_t thread_count) noexcept
+    {
+        const auto threads = resolve_thread_count(thread_count);
+        const auto chunks = resolve_chunk_count(str.size(), sub.size(), CHUNKS_PER_THREAD * threads, MIN_CHUNK_SIZE);
+
+        if ((threads <= 1) || (chunks <= 1)) {
+            return strpy::find(str, sub);
+        }
+
+        return find(str, sub, make_thread_executor(threads), chunks);
+    }
+
+    std::vector<SplitResult> split_lines(const std::string_view str, const bool keep_ends, const Executor& executor,
+                                         const std::size_t chunk_count) noexcept
+    {
+        const auto chunks = resolve_chunk_count(str.size(), 1, chunk_count);
+        std::vector<SplitResult> shards(chunks);
+
+        if (chunks <= 1) {
+            strpy::split_lines_into(shards.front(), str, keep_ends);
+            return shards;
+        }
+
+        executor(chunks, [&](const std::size_t index) {
+            const auto chunk = make_chunk(str.size(), chunks, index);
+            const auto begin = next_line_start(str, chunk.begin);
+            const auto end = (index + 1 == chunks) ? str.size() : next_line_start(str, chunk.end);
+
+            // Every chunk but the last ends with a line break, which does not start another line
+            strpy::split_lines_into(shards[index], str.substr(begin, end - begin), keep_ends);
+        });
+
+        return shards;
+    }
+
+    std::vector<SplitResult> split_lines(const std::string_view str, const bool keep_ends,
+                                         const std::size_t thread_count) noexcept
+    {
+        const auto threads = resolve_thread_count(thread_count);
+        const auto chunks = resolve_chunk_count(str.size(), 1, CHUNKS_PER_THREAD * threads, MIN_CHUNK_SIZE);
+
+        if ((threads <= 1) || (chunks <= 1)) {
+            return split_lines(str, keep_ends, make_thread_executor(1), 1);
+        }
+
+        return split_lines(str, keep_ends, make_thread_executor(threads), chunks);
+    }
+
+    std::vector<SplitResult> split(const std::string_view str, const char delimiter, const StringSplitOptions options,
+                                   const Executor& executor, const std::size_t chunk_count) noexcept
+    {
+        const auto chunks = resolve_chunk_count(str.size(), 1, chunk_count);
+        std::vector<SplitResult> shards(chunks);
+
+        if (chunks <= 1) {
+            strpy::split_into(shards.front(), str, delimiter, options);
+            return shards;
+        }
+
+        const auto keep_empty = (options & StringSplitOptions::remove_empty) == StringSplitOptions::none;
+
+        executor(chunks, [&](const std::size_t index) {
+            const auto chunk = make_chunk(str.size(), chunks, index);
+            const auto begin = next_record_start(str, delimiter, chunk.begin);
+            const auto end = (index + 1 == chunks) ? std::string_view::npos
+                                                   : next_record_start(str, delimiter, chunk.end);
+            auto& shard = shards[index];
+
+            if (begin >= end) {
+                return;
+            }
+
+            if (std::string_view::npos == end) {
+                // The empty record after a delimiter at the end of the string
+                if (begin == str.size()) {
+                    if (keep_empty) {
+                        shard.push_back({});
+                    }
+                }
+                else {
+                    strpy::split_into(shard, str.substr(begin), delimiter, options);
+                }
+
+                return;
+            }
+
+            // The chunk ends with a delimiter, the records before it are split exactly as by the sequential split,
+            // which then adds the empty record that follows the delimiter
+            thread_local std::vector<std::string_view> records{};
+            strpy::detail::split_into(records, str.substr(begin, end - begin), delimiter, std::string::npos, options);
+
+            if (keep_empty) {
+                records.pop_back();
+            }
+
+            shard.assign(records.cbegin(), records.cend());
+            strpy::detail::reset_scratch(records);
+        });
+
+        return shards;
+    }
+
+    std::vector<SplitResult> split(const std::string_view str, const char delimiter, const StringSplitOptions options,
+                                   const std::size_t thread_count) noexcept
+    {
+        const auto threads = resolve_thread_count(thread_count);
+        const auto chunks = resolve_chunk_count(str.size(), 1, CHUNKS_PER_THREAD * threads, MIN_CHUNK_SIZE);
+
+        if ((threads <= 1) || (chunks <= 1)) {
+            return split(str, delimiter, options, make_thread_executor(1), 1);
+        }
+
+        return split(str, delimiter, options, make_thread_executor(threads), chunks);
+    }
+}
@@ -4,41 +4,60 @@
  */
 
 #include "stringpy/partition.hpp"
-#include "stringpy/const.hpp"
+#include "bytescan.hpp"
 #include "stringpy/find.hpp"
 
 namespace
 {
+    /** @brief Type alias for the parts of a partitioned string */
+    using Parts = std::tuple<std::string, std::string, std::string>;
+
     /** @brief Type alias for a function pointer to strpy::find or strpy::find_icase */
     using FindFunc = decltype(&strpy::find);
 
-    std::tuple<std::string, std::string, std::string>
-      partition_impl(const std::string_view str, const std::string_view sep, const FindFunc find) noexcept
+    /** @brief Type alias for a function pointer to strpy::rfind or strpy::rfind_icase */
+    using RFindFunc = decltype(&strpy::rfind);
+
+    /** @brief Assign the parts of a string, the strings of the tuple keep their buffers */
+    void assign_parts(Parts& out, const std::string_view before, const std::string_view sep,
+                      const std::string_view after) noexcept
+    {
+        std::get<0>(out).assign(before);
+        std::get<1>(out).assign(sep);
+        std::get<2>(out).assign(after);
+    }
+
+    /** @brief Assign the parts of a string split at a separator found at the given position */
+    void assign_split(Parts& out, const std::string_view str, const std::size_t pos,
+                      const std::size_t sep_size) noexcept
+    {
+        assign_parts(out, str.substr(0, pos), str.substr(pos, sep_size), str.substr(pos + sep_size));
+    }
+
+    void partition_impl(Parts& out, const std::string_view str, const std::string_view sep,
+                        const FindFunc find) noexcept
     {
         const auto pos = find(str, sep, 0, std::string_view::npos);
 
         if (std::string_view::npos == pos) {
-            return {std::string{str}, strpy::EMPTY_STR, strpy::EMPTY_STR};
+            assign_parts(out, str, {}, {});
+            return;
         }
 
-        return {std::string{str.substr(0, pos)}, std::string{str.substr(pos, sep.length())},
-                std::string{str.substr(pos + sep.size())}};
+        assign_split(out, str, pos, sep.size());
     }
 
-    /** @brief Type alias for a function pointer to strpy::rfind or strpy::rfind_icase */
-    using RFindFunc = decltype(&strpy::rfind);
-
-    std::tuple<std::string, std::string, std::string>
-      rpartition_impl(const std::string_view str, const std::string_view sep, const RFindFunc rfind) noexcept
+    void rpartition_impl(Parts& out, const std::string_view str, const std::string_view sep,
+                         const RFindFunc rfind) noexcept
     {
         const auto pos = rfind(str, sep, 0, std::string_view::npos);
 
-        if (pos == std::string_view::npos) {
-            return {strpy::EMPTY_STR, strpy::EMPTY_STR, std::string{str}};
+        if (std::string_view::npos == pos) {
+            assign_parts(out, {}, {}, str);
+            return;
         }
 
-        return {std::string{str.substr(0, pos)}, std::string{str.substr(pos, sep.length())},
-                std::string{str.substr(pos + sep.size())}};
+        assign_split(out, str, pos, sep.size());
     }
 }
 
@@ -47,24 +66,102 @@ namespace strpy
     std::tuple<std::string, std::string, std::string> partition(const std::string_view str,
                                                                 const std::string_view sep) noexcept
     {
-        return partition_impl(str, sep, find);
+        Parts result{};
+        partition_impl(result, str, sep, find);
+
+        return result;
+    }
+
+    std::tuple<std::string, std::string, std::string> partition(const std::string_view str, const char sep) noexcept
+    {
+        Parts result{};
+        partition_into(result, str, sep);
+
+        return result;
     }
 
     std::tuple<std::string, std::string, std::string> partition_icase(const std::string_view str,
                                                                       const std::string_view sep) noexcept
     {
-        return partition_impl(str, sep, find_icase);
+        Parts result{};
+        partition_impl(result, str, sep, find_icase);
+
+        return result;
     }
 
     std::tuple<std::string, std::string, std::string> rpartition(const std::string_view str,
                                                                  const std::string_view sep) noexcept
     {
-        return rpartition_impl(str, sep, rfind);
+        Parts result{};
+        rpartition_impl(result, str, sep, rfind);
+
+        return result;
+    }
+
+    std::tuple<std::string, std::string, std::string> rpartition(const std::string_view str, const char sep) noexcept
+    {
+        Parts result{};
+        rpartition_into(result, str, sep);
+
+        return result;
     }
 
     std::tuple<std::string, std::string, std::string> rpartition_icase(const std::string_view str,
                                                                        const std::string_view sep) noexcept
     {
-        return rpartition_impl(str, sep, rfind_icase);
+        Parts result{};
+        rpartition_impl(result, str, sep, rfind_icase);
+
+        return result;
+    }
+
+    void partition_into(std::tuple<std::string, std::string, std::string>& out, const std::string_view str,
+                        const std::string_view sep) noexcept
+    {
+        partition_impl(out, str, sep, find);
+    }
+
+    void partition_into(std::tuple<std::string, std::string, std::string>& out, const std::string_view str,
+                        const char sep) noexcept
+    {
+        const auto pos = detail::find_byte(str, sep);
+
+        if (std::string_view::npos == pos) {
+            assign_parts(out, str, {}, {});
+            return;
+        }
+
+        assign_split(out, str, pos, 1);
+    }
+
+    void partition_into_icase(std::tuple<std::string, std::string, std::string>& out, const std::string_view str,
+                              const std::string_view sep) noexcept
+    {
+        partition_impl(out, str, sep, find_icase);
+    }
+
+    void rpartition_into(std::tuple<std::string, std::string, std::string>& out, const std::string_view str,
+                         const std::string_view sep) noexcept
+    {
+        rpartition_impl(out, str, sep, rfind);
+    }
+
+    void rpartition_into(std::tuple<std::string, std::string, std::string>& out, const std::string_view str,
+                         const char sep) noexcept
+    {
+        const auto pos = str.rfind(sep);
+
+        if (std::string_view::npos == pos) {
+            assign_parts(out, {}, {}, str);
+            return;
+        }
+
+        assign_split(out, str, pos, 1);
+    }
+
+    void rpartition_into_icase(std::tuple<std::string, std::string, std::string>& out, const std::string_view str,
+                               const std::string_view sep) noexcept
+    {
+        rpartition_impl(out, str, sep, rfind_icase);
     }
 }
@@ -4,31 +4,144 @@
  */
 
 #include "stringpy/replace.hpp"
+#include "bytescan.hpp"
 #include "stringpy/find.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 namespace
 {
     /** @brief Type alias for a function pointer to strpy::find or strpy::find_icase */
     using FindFunc = decltype(&strpy::find);
 
+    /** @brief Collect the positions of at most count non-overlapping occurrences in a single pass */
+    std::vector<std::size_t> find_matches(const std::string_view str, const std::string_view old_value,
+                                          std::size_t count, const FindFunc find) noexcept
+    {
+        std::vector<std::size_t> matches{};
+
+        constexpr auto end = std::string_view::npos;
+
+        for (auto pos = find(str, old_value, 0, end); (pos != std::string_view::npos) && (count != 0);
+             pos = find(str, old_value, pos + old_value.size(), end)) {
+            matches.push_back(pos);
+            --count;
+        }
+
+        return matches;
+    }
+
+    /** @brief Returns the size of the string after replacing the given number of occurrences */
+    std::size_t replaced_size(const std::size_t size, const std::size_t matches, const std::size_t old_size,
+                              const std::size_t new_size) noexcept
+    {
+        return (size - (matches * old_size)) + (matches * new_size);
+    }
+
     std::string replace_impl(const std::string_view str, const std::string_view old_value,
-                             const std::string_view new_value, std::size_t count, const FindFunc find) noexcept
+                             const std::string_view new_value, const std::size_t count, const FindFunc find) noexcept
     {
-        if (old_value.empty()) {
+        if (old_value.empty() || (0 == count)) {
             return std::string{str};
         }
 
-        std::string result{str};
+        const auto matches = find_matches(str, old_value, count, find);
+
+        std::string result{};
+        result.reserve(replaced_size(str.size(), matches.size(), old_value.size(), new_value.size()));
         std::size_t start = 0;
+
+        for (const auto pos : matches) {
+            result.append(str.substr(start, pos - start)).append(new_value);
+            start = pos + old_value.size();
+        }
+
+        result.append(str.substr(start));
+
+        return result;
+    }
+
+    /** @brief Replace in place when the result is not longer, the unread part of the string is never overwritten */
+    std::size_t replace_shrinking(std::string& str, const std::string_view old_value,
+                                  const std::string_view new_value, std::size_t count, const FindFunc find) noexcept
+    {
+        std::size_t read = 0;
+        std::size_t write = 0;
+        std::size_t replaced = 0;
+
         constexpr auto end = std::string_view::npos;
 
-        while (((start = find(result, old_value, start, end)) != std::string::npos) && (count != 0)) {
-            result.replace(start, old_value.length(), new_value);
-            start += new_value.length();
+        for (auto pos = find(str, old_value, 0, end); (pos != std::string_view::npos) && (count != 0);
+             pos = find(str, old_value, read, end)) {
+            std::string::traits_type::move(&str[write], &str[read], pos - read);
+            write += pos - read;
+            std::string::traits_type::copy(&str[write], new_value.data(), new_value.size());
+            write += new_value.size();
+            read = pos + old_value.size();
+            ++replaced;
             --count;
         }
 
-        return result;
+        if (write != read) {
+            str.erase(write, read - write);
+        }
+
+        return replaced;
+    }
+
+    /** @brief Replace in place when the result is longer, the string is resized once and filled from the end */
+    std::size_t replace_growing(std::string& str, const std::string_view old_value, const std::string_view new_value,
+                                const std::size_t count, const FindFunc find) noexcept
+    {
+        const auto matches = find_matches(str, old_value, count, find);
+
+        if (matches.empty()) {
+            return 0;
+        }
+
+        auto read = str.size();
+        auto write = replaced_size(str.size(), matches.size(), old_value.size(), new_value.size());
+        str.resize(write);
+
+        for (auto it = matches.crbegin(); it != matches.crend(); ++it) {
+            const auto tail = read - (*it + old_value.size());
+            write -= tail;
+            std::string::traits_type::move(&str[write], &str[read - tail], tail);
+            write -= new_value.size();
+            std::string::traits_type::copy(&str[write], new_value.data(), new_value.size());
+            read = *it;
+        }
+
+        return matches.size();
+    }
+
+    /** @brief Checks whether a view overlaps the buffer of a string */
+    bool overlaps(const std::string& str, const std::string_view value) noexcept
+    {
+        const std::less<const char*> less{};
+        return (!value.empty()) && less(value.data(), str.data() + str.size()) &&
+               less(str.data(), value.data() + value.size());
+    }
+
+    std::size_t replace_inplace_impl(std::string& str, const std::string_view old_value,
+                                     const std::string_view new_value, const std::size_t count,
+                                     const FindFunc find) noexcept
+    {
+        if (old_value.empty() || (0 == count)) {
+            return 0;
+        }
+
+        // The string is overwritten and may be reallocated, so the values that point into it are copied first
+        if (overlaps(str, old_value) || overlaps(str, new_value)) {
+            return replace_inplace_impl(str, std::string{old_value}, std::string{new_value}, count, find);
+        }
+
+        if (new_value.size() <= old_value.size()) {
+            return replace_shrinking(str, old_value, new_value, count, find);
+        }
+
+        return replace_growing(str, old_value, new_value, count, find);
     }
 }
 
@@ -40,9 +153,54 @@ namespace strpy
         return replace_impl(str, old_value, new_value, count, find);
     }
 
+    std::string replace(const std::string_view str, const char old_value, const std::string_view new_value,
+                        std::size_t count) noexcept
+    {
+        auto pos = detail::find_byte(str, old_value);
+
+        if ((std::string_view::npos == pos) || (0 == count)) {
+            return std::string{str};
+        }
+
+        std::string result{};
+
+        if (new_value.size() > 1) {
+            const auto occurrences = std::min(count, detail::count_byte(str.substr(pos), old_value));
+            result.reserve(str.size() + (occurrences * (new_value.size() - 1)));
+        }
+        else {
+            result.reserve(str.size());
+        }
+
+        std::size_t start = 0;
+
+        while ((pos != std::string_view::npos) && (count != 0)) {
+            result.append(str.substr(start, pos - start)).append(new_value);
+            start = pos + 1;
+            pos = detail::find_byte(str, old_value, start);
+            --count;
+        }
+
+        result.append(str.substr(start));
+
+        return result;
+    }
+
     std::string replace_icase(const std::string_view str, const std::string_view old_value,
                               const std::string_view new_value, const std::size_t count) noexcept
     {
         return replace_impl(str, old_value, new_value, count, find_icase);
     }
+
+    std::size_t replace_inplace(std::string& str, const std::string_view old_value, const std::string_view new_value,
+                                const std::size_t count) noexcept
+    {
+        return replace_inplace_impl(str, old_value, new_value, count, find);
+    }
+
+    std::size_t replace_inplace_icase(std::string& str, const std::string_view old_value,
+                                      const std::string_view new_value, const std::size_t count) noexcept
+    {
+        return replace_inplace_impl(str, old_value, new_value, count, find_icase);
+    }
 }
@@ -0,0 +1,288 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "search.hpp"
+#include "simd.hpp"
+#include "stringpy/cpu.hpp"
+#include "stringpy/ctype.hpp"
+#include "stringpy/equal.hpp"
+#include <cstdint>
+
+namespace
+{
+    using CharType = std::string_view::value_type;
+
+    /** @brief The two byte values a haystack byte may take to match a needle byte, ignoring case */
+    struct CaseVariants
+    {
+        CharType lower;
+        CharType upper;
+    };
+
+    /** @brief A substring prepared for the case-insensitive search */
+    struct Needle
+    {
+        const CharType* data;
+        std::size_t size;
+        CaseVariants first;
+        CaseVariants last;
+    };
+
+    CaseVariants make_case_variants(const CharType ch) noexcept
+    {
+        return {strpy::to_lower_char<CharType>(ch), strpy::to_upper_char<CharType>(ch)};
+    }
+
+    Needle make_needle(const std::string_view sub) noexcept
+    {
+        return {sub.data(), sub.size(), make_case_variants(sub.front()), make_case_variants(sub.back())};
+    }
+
+    bool is_variant(const CharType ch, const CaseVariants& variants) noexcept
+    {
+        return (ch == variants.lower) || (ch == variants.upper);
+    }
+
+    /** @brief Verify the bytes between the first and last bytes of a candidate */
+    bool verify(const CharType* str, const std::size_t pos, const Needle& needle) noexcept
+    {
+        for (std::size_t i = 1; (i + 1) < needle.size; ++i) {
+            if (!strpy::equal_char_icase(str[pos + i], needle.data[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool is_match(const CharType* str, const std::size_t pos, const Needle& needle) noexcept
+    {
+        return is_variant(str[pos], needle.first) && is_variant(str[pos + needle.size - 1], needle.last) &&
+               verify(str, pos, needle);
+    }
+
+    /** @brief Scan the candidate positions [pos, count) from left to right */
+    std::size_t search_scalar(const CharType* str, std::size_t pos, const std::size_t count,
+                              const Needle& needle) noexcept
+    {
+        for (; pos < count; ++pos) {
+            if (is_match(str, pos, needle)) {
+                return pos;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    /** @brief Scan the candidate positions [0, count) from right to left */
+    std::size_t rsearch_scalar(const CharType* str, std::size_t count, const Needle& needle) noexcept
+    {
+        while (count != 0) {
+            if (is_match(str, --count, needle)) {
+                return count;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+#ifdef STRINGPY_X86
+    /** @brief Number of candidate positions checked per SSE4.2 step */
+    constexpr std::size_t SSE42_BLOCK_SIZE = 16;
+
+    STRINGPY_TARGET_SSE42 __m128i load_sse42(const CharType* ptr) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); // NOLINT(*-reinterpret-cast)
+    }
+
+    /** @brief Broadcast case variants of the first and last needle bytes */
+    struct NeedleSse42
+    {
+        STRINGPY_TARGET_SSE42 explicit NeedleSse42(const Needle& needle) noexcept :
+            first_lower(_mm_set1_epi8(needle.first.lower)), first_upper(_mm_set1_epi8(needle.first.upper)),
+            last_lower(_mm_set1_epi8(needle.last.lower)), last_upper(_mm_set1_epi8(needle.last.upper)),
+            last_offset(needle.size - 1)
+        {
+        }
+
+        /** @brief Mask of the candidate positions [pos, pos + 16) */
+        [[nodiscard]] STRINGPY_TARGET_SSE42 std::uint32_t candidates(const CharType* str,
+                                                                     const std::size_t pos) const noexcept
+        {
+            const auto head = load_sse42(str + pos);
+            const auto tail = load_sse42(str + pos + last_offset);
+            const auto head_eq = _mm_or_si128(_mm_cmpeq_epi8(head, first_lower), _mm_cmpeq_epi8(head, first_upper));
+            const auto tail_eq = _mm_or_si128(_mm_cmpeq_epi8(tail, last_lower), _mm_cmpeq_epi8(tail, last_upper));
+
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(head_eq, tail_eq)));
+        }
+
+        __m128i first_lower;
+        __m128i first_upper;
+        __m128i last_lower;
+        __m128i last_upper;
+        std::size_t last_offset;
+    };
+
+    /** @brief Number of candidate positions checked per AVX2 step */
+    constexpr std::size_t AVX2_BLOCK_SIZE = 32;
+
+    STRINGPY_TARGET_AVX2 __m256i load_avx2(const CharType* ptr) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); // NOLINT(*-reinterpret-cast)
+    }
+
+    /** @brief Broadcast case variants of the first and last needle bytes */
+    struct NeedleAvx2
+    {
+        STRINGPY_TARGET_AVX2 explicit NeedleAvx2(const Needle& needle) noexcept :
+            first_lower(_mm256_set1_epi8(needle.first.lower)), first_upper(_mm256_set1_epi8(needle.first.upper)),
+            last_lower(_mm256_set1_epi8(needle.last.lower)), last_upper(_mm256_set1_epi8(needle.last.upper)),
+            last_offset(needle.size - 1)
+        {
+        }
+
+        /** @brief Mask of the candidate positions [pos, pos + 32) */
+        [[nodiscard]] STRINGPY_TARGET_AVX2 std::uint32_t candidates(const CharType* str,
+                                                                    const std::size_t pos) const noexcept
+        {
+            const auto head = load_avx2(str + pos);
+            const auto tail = load_avx2(str + pos + last_offset);
+            const auto head_eq =
+              _mm256_or_si256(_mm256_cmpeq_epi8(head, first_lower), _mm256_cmpeq_epi8(head, first_upper));
+            const auto tail_eq =
+              _mm256_or_si256(_mm256_cmpeq_epi8(tail, last_lower), _mm256_cmpeq_epi8(tail, last_upper));
+
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(head_eq, tail_eq)));
+        }
+
+        __m256i first_lower;
+        __m256i first_upper;
+        __m256i last_lower;
+        __m256i last_upper;
+        std::size_t last_offset;
+    };
+#endif
+
+    /** @brief Scan the candidate positions [0, count) from left to right, a block at a time */
+    template <typename Engine, std::size_t BlockSize>
+    std::size_t search_blocks(const CharType* str, const std::size_t count, const Needle& needle) noexcept
+    {
+        const Engine engine{needle};
+        std::size_t pos = 0;
+
+        for (; (pos + BlockSize) <= count; pos += BlockSize) {
+            for (auto mask = engine.candidates(str, pos); mask != 0; mask &= mask - 1) {
+                if (const auto candidate = pos + strpy::detail::lowest_bit(mask); verify(str, candidate, needle)) {
+                    return candidate;
+                }
+            }
+        }
+
+        return search_scalar(str, pos, count, needle);
+    }
+
+    /** @brief Scan the candidate positions [0, count) from right to left, a block at a time */
+    template <typename Engine, std::size_t BlockSize>
+    std::size_t rsearch_blocks(const CharType* str, std::size_t count, const Needle& needle) noexcept
+    {
+        const Engine engine{needle};
+
+        for (; count >= BlockSize; count -= BlockSize) {
+            const auto pos = count - BlockSize;
+
+            for (auto mask = engine.candidates(str, pos); mask != 0;) {
+                const auto bit = strpy::detail::highest_bit(mask);
+
+                if (verify(str, pos + bit, needle)) {
+                    return pos + bit;
+                }
+
+                mask &= ~(std::uint32_t{1} << bit);
+            }
+        }
+
+        return rsearch_scalar(str, count, needle);
+    }
+
+#ifdef STRINGPY_X86
+    STRINGPY_TARGET_SSE42 STRINGPY_FLATTEN std::size_t search_sse42(const CharType* str, const std::size_t count,
+                                                                    const Needle& needle) noexcept
+    {
+        return search_blocks<NeedleSse42, SSE42_BLOCK_SIZE>(str, count, needle);
+    }
+
+    STRINGPY_TARGET_SSE42 STRINGPY_FLATTEN std::size_t rsearch_sse42(const CharType* str, const std::size_t count,
+                                                                     const Needle& needle) noexcept
+    {
+        return rsearch_blocks<NeedleSse42, SSE42_BLOCK_SIZE>(str, count, needle);
+    }
+
+    STRINGPY_TARGET_AVX2 STRINGPY_FLATTEN std::size_t search_avx2(const CharType* str, const std::size_t count,
+                                                                  const Needle& needle) noexcept
+    {
+        return search_blocks<NeedleAvx2, AVX2_BLOCK_SIZE>(str, count, needle);
+    }
+
+    STRINGPY_TARGET_AVX2 STRINGPY_FLATTEN std::size_t rsearch_avx2(const CharType* str, const std::size_t count,
+                                                                   const Needle& needle) noexcept
+    {
+        return rsearch_blocks<NeedleAvx2, AVX2_BLOCK_SIZE>(str, count, needle);
+    }
+#endif
+}
+
+namespace strpy::detail
+{
+    std::size_t search_icase(const std::string_view str, const std::string_view sub) noexcept
+    {
+        if (sub.empty()) {
+            return 0;
+        }
+
+        if (str.size() < sub.size()) {
+            return std::string_view::npos;
+        }
+
+        const auto needle = make_needle(sub);
+        const auto count = str.size() - sub.size() + 1;
+
+        switch (simd_level()) {
+#ifdef STRINGPY_X86
+            case SimdLevel::avx2:
+                return search_avx2(str.data(), count, needle);
+            case SimdLevel::sse42:
+                return search_sse42(str.data(), count, needle);
+#endif
+            default:
+                return search_scalar(str.data(), 0, count, needle);
+        }
+    }
+
+    std::size_t rsearch_icase(const std::string_view str, const std::string_view sub) noexcept
+    {
+        if (sub.empty()) {
+            return str.size();
+        }
+
+        if (str.size() < sub.size()) {
+            return std::string_view::npos;
+        }
+
+        const auto needle = make_needle(sub);
+        const auto count = str.size() - sub.size() + 1;
+
+        switch (simd_level()) {
+#ifdef STRINGPY_X86
+            case SimdLevel::avx2:
+                return rsearch_avx2(str.data(), count, needle);
+            case SimdLevel::sse42:
+                return rsearch_sse42(str.data(), count, needle);
+#endif
+            default:
+                return rsearch_scalar(str.data(), count, needle);
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal case-insensitive substring search engine.
+ */
+
+#pragma once
+
+#include <string_view>
+#include <cstddef>
+
+namespace strpy::detail
+{
+    /**
+     * @brief Finds the first occurrence of a substring within a string, ignoring case.
+     *
+     * Candidate positions are selected by comparing the first and last bytes of the substring
+     * against both of their case variants, 16 or 32 haystack bytes at a time depending on \ref strpy::simd_level.
+     * Only the candidates are verified with \ref strpy::equal_char_icase.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     *
+     * @return The index of the first occurrence of the substring, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] std::size_t search_icase(std::string_view str, std::string_view sub) noexcept;
+
+    /**
+     * @brief Finds the last occurrence of a substring within a string, ignoring case.
+     *
+     * @param str The string to search within.
+     * @param sub The substring to search for.
+     *
+     * @return The index of the last occurrence of the substring, or \c std::string_view::npos if not found.
+     */
+    [[nodiscard]] std::size_t rsearch_icase(std::string_view str, std::string_view sub) noexcept;
+}
@@ -0,0 +1,419 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/searcher.hpp"
+#include "search.hpp"
+#include "stringpy/ctype.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace
+{
+    /** @brief Number of distinct byte values */
+    constexpr std::size_t BYTE_VALUES = std::numeric_limits<unsigned char>::max() + 1;
+
+    /** @brief Needles shorter than this are searched for without the Horspool tables */
+    constexpr std::size_t HORSPOOL_MIN_SIZE = 16;
+
+    /** @brief Number of prefilter candidates checked before its effectiveness is evaluated */
+    constexpr std::size_t PREFILTER_WARMUP = 16;
+
+    /** @brief Bytes that are common in text, from the most to the least frequent */
+    constexpr std::string_view COMMON_BYTES{" etaoinsrhldcumfpgwybvkxjqz"};
+
+    /** @brief Approximate frequency rank of a byte in typical text, the lower the rarer */
+    constexpr std::size_t byte_rank(const unsigned char ch) noexcept
+    {
+        constexpr std::size_t common_rank = 255;
+        constexpr std::size_t digit_rank = 150;
+        constexpr std::size_t punct_rank = 140;
+        constexpr std::size_t upper_rank = 120;
+        constexpr std::size_t printable_rank = 60;
+        constexpr std::size_t other_rank = 10;
+
+        if (const auto pos = COMMON_BYTES.find(static_cast<char>(ch)); pos != std::string_view::npos) {
+            return common_rank - pos;
+        }
+
+        if ((ch >= '0') && (ch <= '9')) {
+            return digit_rank;
+        }
+
+        if (std::string_view{",.-_/:=\n\t"}.find(static_cast<char>(ch)) != std::string_view::npos) {
+            return punct_rank;
+        }
+
+        if ((ch >= 'A') && (ch <= 'Z')) {
+            return upper_rank;
+        }
+
+        return ((ch >= ' ') && (ch <= '~')) ? printable_rank : other_rank;
+    }
+
+    /** @brief Narrow a string to the [start, end) range, the same way as strpy::find does */
+    bool narrow(std::string_view& str, const std::size_t start, std::size_t end) noexcept
+    {
+        if ((start != 0) && ((start > end) || (start >= str.size()))) {
+            return false;
+        }
+
+        if ((start != 0) || (end != std::string_view::npos)) {
+            end = std::min(end, str.size());
+            str = str.substr(start, end - start);
+        }
+
+        return true;
+    }
+}
+
+namespace strpy::detail
+{
+    /** @brief Immutable preprocessed needle shared between copies of a strpy::Searcher */
+    struct SearcherData
+    {
+        /** @brief The needle as it was given */
+        std::string needle{};
+
+        /** @brief The needle with every byte passed through the folding table */
+        std::string folded{};
+
+        /** @brief Byte folding table: identity, or upper case for a case-insensitive searcher */
+        std::array<unsigned char, BYTE_VALUES> fold{};
+
+        /** @brief Horspool shifts for the forward search, indexed by folded byte */
+        std::array<std::size_t, BYTE_VALUES> shift{};
+
+        /** @brief Horspool shifts for the reverse search, indexed by folded byte */
+        std::array<std::size_t, BYTE_VALUES> rshift{};
+
+        /** @brief Offset of the rarest byte of the needle, used as a memchr prefilter */
+        std::size_t rare_offset = 0;
+
+        /** @brief Whether the case is ignored */
+        bool icase = false;
+    };
+}
+
+namespace
+{
+    using strpy::detail::SearcherData;
+
+    const SearcherData& empty_data() noexcept
+    {
+        static const SearcherData data{};
+        return data;
+    }
+
+    unsigned char to_byte(const char ch) noexcept
+    {
+        return static_cast<unsigned char>(ch);
+    }
+
+    std::shared_ptr<const SearcherData> make_data(const std::string_view needle, const bool icase)
+    {
+        auto data = std::make_shared<SearcherData>();
+        data->needle = std::string{needle};
+        data->icase = icase;
+
+        for (std::size_t ch = 0; ch < BYTE_VALUES; ++ch) {
+            const auto byte = static_cast<unsigned char>(ch);
+            data->fold[ch] = icase ? strpy::to_upper_char<unsigned char>(byte) : byte;
+        }
+
+        data->folded.reserve(needle.size());
+
+        for (const auto ch : needle) {
+            data->folded += static_cast<char>(data->fold[to_byte(ch)]);
+        }
+
+        const auto size = needle.size();
+        data->shift.fill(size);
+        data->rshift.fill(size);
+
+        for (std::size_t i = 0; (i + 1) < size; ++i) {
+            data->shift[to_byte(data->folded[i])] = size - 1 - i;
+        }
+
+        for (auto i = size; i > 1; --i) {
+            data->rshift[to_byte(data->folded[i - 1])] = i - 1;
+        }
+
+        for (std::size_t i = 1; i < size; ++i) {
+            if (byte_rank(to_byte(needle[i])) < byte_rank(to_byte(needle[data->rare_offset]))) {
+                data->rare_offset = i;
+            }
+        }
+
+        return data;
+    }
+
+    /** @brief Compare count bytes of a window with the folded needle */
+    template <bool ICase>
+    bool equal_window(const SearcherData& data, const char* window, const char* needle,
+                      const std::size_t count) noexcept
+    {
+        if constexpr (ICase) {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (data.fold[to_byte(window[i])] != to_byte(needle[i])) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+        else {
+            return std::memcmp(window, needle, count) == 0;
+        }
+    }
+
+    /** @brief Forward Boyer-Moore-Horspool search starting at window pos */
+    template <bool ICase>
+    std::size_t horspool(const SearcherData& data, const std::string_view str, std::size_t pos) noexcept
+    {
+        const auto size = data.folded.size();
+        const auto last = str.size() - size;
+        const auto last_byte = to_byte(data.folded.back());
+
+        while (pos <= last) {
+            const auto ch = ICase ? data.fold[to_byte(str[pos + size - 1])] : to_byte(str[pos + size - 1]);
+
+            if ((ch == last_byte) && equal_window<ICase>(data, str.data() + pos, data.folded.data(), size - 1)) {
+                return pos;
+            }
+
+            pos += data.shift[ch];
+        }
+
+        return std::string_view::npos;
+    }
+
+    /** @brief Reverse Boyer-Moore-Horspool search starting at the last window */
+    template <bool ICase>
+    std::size_t rhorspool(const SearcherData& data, const std::string_view str) noexcept
+    {
+        const auto size = data.folded.size();
+        const auto first_byte = to_byte(data.folded.front());
+        auto pos = str.size() - size;
+
+        while (true) {
+            const auto ch = ICase ? data.fold[to_byte(str[pos])] : to_byte(str[pos]);
+
+            if ((ch == first_byte) &&
+                equal_window<ICase>(data, str.data() + pos + 1, data.folded.data() + 1, size - 1)) {
+                return pos;
+            }
+
+            if (pos < data.rshift[ch]) {
+                return std::string_view::npos;
+            }
+
+            pos -= data.rshift[ch];
+        }
+    }
+
+    /**
+     * @brief Search with memchr for the rarest needle byte and verify the candidates.
+     * Falls back to Horspool when the prefilter produces too many false candidates.
+     */
+    std::size_t prefilter_search(const SearcherData& data, const std::string_view str, std::size_t pos) noexcept
+    {
+        const auto size = data.needle.size();
+        const auto last = str.size() - size;
+        const auto rare = data.needle[data.rare_offset];
+        const auto begin = pos;
+        std::size_t candidates = 0;
+
+        while (pos <= last) {
+            const auto* hit = static_cast<const char*>(
+              std::memchr(str.data() + pos + data.rare_offset, rare, (last - pos) + 1));
+
+            if (nullptr == hit) {
+                return std::string_view::npos;
+            }
+
+            const auto window = static_cast<std::size_t>(hit - str.data()) - data.rare_offset;
+
+            if (std::memcmp(str.data() + window, data.needle.data(), size) == 0) {
+                return window;
+            }
+
+            pos = window + 1;
+
+            if ((++candidates > PREFILTER_WARMUP) && ((pos - begin) < (candidates * size))) {
+                return horspool<false>(data, str, pos);
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    /** @brief Find the first window at or after pos that matches the needle */
+    std::size_t find_from(const SearcherData& data, const std::string_view str, const std::size_t pos) noexcept
+    {
+        const auto size = data.needle.size();
+
+        if (size == 0) {
+            return pos <= str.size() ? pos : std::string_view::npos;
+        }
+
+        if ((str.size() < size) || (pos > (str.size() - size))) {
+            return std::string_view::npos;
+        }
+
+        if (data.icase) {
+            if (size < HORSPOOL_MIN_SIZE) {
+                const auto result = strpy::detail::search_icase(str.substr(pos), data.needle);
+                return std::string_view::npos == result ? result : pos + result;
+            }
+
+            return horspool<true>(data, str, pos);
+        }
+
+        if (size == 1) {
+            return str.find(data.needle.front(), pos);
+        }
+
+        return prefilter_search(data, str, pos);
+    }
+
+    /** @brief Find the last window that matches the needle */
+    std::size_t rfind_in(const SearcherData& data, const std::string_view str) noexcept
+    {
+        const auto size = data.needle.size();
+
+        if (size == 0) {
+            return str.size();
+        }
+
+        if (str.size() < size) {
+            return std::string_view::npos;
+        }
+
+        if (size < HORSPOOL_MIN_SIZE) {
+            return data.icase ? strpy::detail::rsearch_icase(str, data.needle) : str.rfind(data.needle);
+        }
+
+        return data.icase ? rhorspool<true>(data, str) : rhorspool<false>(data, str);
+    }
+}
+
+namespace strpy
+{
+    Searcher::Searcher() noexcept = default;
+
+    Searcher::Searcher(std::shared_ptr<const detail::SearcherData> data) noexcept : data_(std::move(data)) {}
+
+    std::size_t Searcher::find(std::string_view str, const std::size_t start, const std::size_t end) const noexcept
+    {
+        if (!narrow(str, start, end)) {
+            return std::string_view::npos;
+        }
+
+        const auto result = find_from(data_ ? *data_ : empty_data(), str, 0);
+        return std::string_view::npos == result ? result : start + result;
+    }
+
+    std::size_t Searcher::rfind(std::string_view str, const std::size_t start, const std::size_t end) const noexcept
+    {
+        if (!narrow(str, start, end)) {
+            return std::string_view::npos;
+        }
+
+        const auto result = rfind_in(data_ ? *data_ : empty_data(), str);
+        return std::string_view::npos == result ? result : start + result;
+    }
+
+    std::size_t Searcher::count(std::string_view str, const std::size_t start, std::size_t end) const noexcept
+    {
+        const auto& data = data_ ? *data_ : empty_data();
+        const auto size = data.needle.size();
+
+        if (str.empty() || (start > end) || (start >= str.size()) || (size > str.size())) {
+            return 0;
+        }
+
+        if (size == 0) {
+            end = std::min(end, str.size());
+            return (end - start) + 1;
+        }
+
+        narrow(str, start, end);
+        std::size_t result = 0;
+
+        for (auto pos = find_from(data, str, 0); pos != std::string_view::npos; pos = find_from(data, str, pos)) {
+            pos += size;
+            ++result;
+        }
+
+        return result;
+    }
+
+    std::vector<std::size_t> Searcher::find_all(const std::string_view str) const noexcept
+    {
+        const auto& data = data_ ? *data_ : empty_data();
+        const auto step = std::max<std::size_t>(data.needle.size(), 1);
+        std::vector<std::size_t> result{};
+
+        for (auto pos = find_from(data, str, 0); pos != std::string_view::npos;
+             pos = find_from(data, str, pos + step)) {
+            result.push_back(pos);
+        }
+
+        return result;
+    }
+
+    std::string Searcher::replace(const std::string_view str, const std::string_view new_value,
+                                  std::size_t count) const noexcept
+    {
+        const auto& data = data_ ? *data_ : empty_data();
+        const auto size = data.needle.size();
+
+        if (size == 0) {
+            return std::string{str};
+        }
+
+        std::vector<std::size_t> positions{};
+
+        for (auto pos = find_from(data, str, 0); (pos != std::string_view::npos) && (count != 0);
+             pos = find_from(data, str, pos + size), --count) {
+            positions.push_back(pos);
+        }
+
+        std::string result{};
+        result.reserve((str.size() - (positions.size() * size)) + (positions.size() * new_value.size()));
+        std::size_t last = 0;
+
+        for (const auto pos : positions) {
+            result.append(str.substr(last, pos - last)).append(new_value);
+            last = pos + size;
+        }
+
+        result.append(str.substr(last));
+        return result;
+    }
+
+    std::string_view Searcher::needle() const noexcept
+    {
+        return data_ ? std::string_view{data_->needle} : std::string_view{};
+    }
+
+    bool Searcher::icase() const noexcept
+    {
+        return data_ && data_->icase;
+    }
+
+    Searcher make_searcher(const std::string_view needle) noexcept
+    {
+        return Searcher{make_data(needle, false)};
+    }
+
+    Searcher make_searcher_icase(const std::string_view needle) noexcept
+    {
+        return Searcher{make_data(needle, true)};
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal helpers for the vectorized kernels of the library.
+ *
+ * Declares the target attributes of the per-tier kernels, which are selected at run time
+ * by \ref strpy::simd_level, and provides portable bit manipulation helpers used to walk the match masks.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define STRINGPY_X86 1
+  #include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+  #include <intrin.h>
+#endif
+
+// A kernel of a tier is compiled for the instructions of that tier regardless of the compiler flags,
+// it must only be called when the tier is active. MSVC allows any intrinsic without a target attribute.
+#if defined(STRINGPY_X86) && (defined(__GNUC__) || defined(__clang__))
+  #define STRINGPY_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+  #define STRINGPY_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+  #define STRINGPY_FLATTEN __attribute__((flatten))
+#else
+  #define STRINGPY_TARGET_SSE42
+  #define STRINGPY_TARGET_AVX2
+  #define STRINGPY_FLATTEN
+#endif
+
+namespace strpy::detail
+{
+    /**
+     * @brief Returns the index of the lowest set bit of a non-zero mask.
+     *
+     * @param mask The mask to inspect. Must not be zero.
+     *
+     * @return The index of the lowest set bit.
+     */
+    [[nodiscard]] inline unsigned lowest_bit(const std::uint32_t mask) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index = 0; // NOLINT(google-runtime-int)
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+
+    /**
+     * @brief Returns the number of set bits of a mask.
+     *
+     * Compiles to a single instruction within the kernels of the SSE4.2 and AVX2 tiers.
+     *
+     * @param mask The mask to inspect.
+     *
+     * @return The number of set bits.
+     */
+    [[nodiscard]] inline unsigned popcount(const std::uint32_t mask) noexcept
+    {
+#ifdef _MSC_VER
+        return __popcnt(mask);
+#else
+        return static_cast<unsigned>(__builtin_popcount(mask));
+#endif
+    }
+
+    /**
+     * @brief Returns the index of the highest set bit of a non-zero mask.
+     *
+     * @param mask The mask to inspect. Must not be zero.
+     *
+     * @return The index of the highest set bit.
+     */
+    [[nodiscard]] inline unsigned highest_bit(const std::uint32_t mask) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index = 0; // NOLINT(google-runtime-int)
+        _BitScanReverse(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        constexpr unsigned last_bit = 31;
+        return last_bit - static_cast<unsigned>(__builtin_clz(mask));
+#endif
+    }
+}
@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal tokenizers for the functions that split a string on runs of space characters
+ * or of the characters of a set.
+ */
+
+#pragma once
+
+#include "blockscan.hpp"
+#include "stringpy/charset.hpp"
+#include "stringpy/find.hpp"
+#include <string_view>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace strpy::detail
+{
+    /** @brief The space characters of \ref strpy::SPACE_CHARS, the ones that Python's \c str.split() splits on. */
+    constexpr std::array<std::string_view::value_type, 6> SPACE_BYTES = {' ', '\f', '\n', '\r', '\t', '\v'};
+
+    /**
+     * @brief Classifies a block of bytes into a whitespace bitmask.
+     *
+     * @param data The bytes to classify.
+     * @param size The number of bytes, at most \ref BLOCK_SIZE.
+     *
+     * @return A mask with bit i set if the byte data[i] is a space character.
+     */
+    [[nodiscard]] inline std::uint32_t space_mask(const std::string_view::value_type* const data,
+                                                  const std::size_t size) noexcept
+    {
+        return equal_mask(data, size, SPACE_BYTES);
+    }
+
+    /**
+     * @brief Walks the boundaries between the words and the runs of space characters of a string.
+     *
+     * The string is divided into blocks of \ref BLOCK_SIZE bytes. The whitespace mask of the last
+     * visited block is kept, so finding the start and the end of the words that lie within a block
+     * classifies its bytes once, and each boundary is found with a single bit scan of the mask.
+     * The scanner refers to the string and must not outlive it.
+     */
+    class SpaceScanner
+    {
+    public:
+        /**
+         * @brief Constructs a scanner over a string.
+         *
+         * @param str The string to scan.
+         */
+        explicit SpaceScanner(const std::string_view str) noexcept : str_(str) {}
+
+        /**
+         * @brief Finds the first byte at or after a position that is, or is not, a space character.
+         *
+         * @param pos The position to start the search at.
+         * @param space \c true to find a space character, \c false to find any other byte.
+         *
+         * @return The index of the found byte, or \c std::string_view::npos if not found.
+         */
+        [[nodiscard]] std::size_t find(std::size_t pos, const bool space) noexcept
+        {
+            while (pos < str_.size()) {
+                const auto block = pos - (pos % BLOCK_SIZE);
+
+                if (const auto mask = block_mask(block, space) & (~std::uint32_t{0} << (pos - block)); mask != 0) {
+                    return block + lowest_bit(mask);
+                }
+
+                pos = block + BLOCK_SIZE;
+            }
+
+            return std::string_view::npos;
+        }
+
+        /**
+         * @brief Finds the last byte before a position that is, or is not, a space character.
+         *
+         * @param end The position to end the search at, the byte at this position is not inspected.
+         * @param space \c true to find a space character, \c false to find any other byte.
+         *
+         * @return The index of the found byte, or \c std::string_view::npos if not found.
+         */
+        [[nodiscard]] std::size_t rfind(std::size_t end, const bool space) noexcept
+        {
+            while (end != 0) {
+                const auto block = (end - 1) - ((end - 1) % BLOCK_SIZE);
+
+                if (const auto mask = block_mask(block, space) & low_bits(end - block); mask != 0) {
+                    return block + highest_bit(mask);
+                }
+
+                end = block;
+            }
+
+            return std::string_view::npos;
+        }
+
+    private:
+        /** @brief Returns a mask with the given number of low bits set. */
+        [[nodiscard]] static std::uint32_t low_bits(const std::size_t count) noexcept
+        {
+            return (count >= BLOCK_SIZE) ? ~std::uint32_t{0} : ((std::uint32_t{1} << count) - 1);
+        }
+
+        /** @brief Returns the mask of the space characters, or of the other bytes, of the block at a position. */
+        [[nodiscard]] std::uint32_t block_mask(const std::size_t block, const bool space) noexcept
+        {
+            if (block != block_) {
+                const auto size = (str_.size() - block < BLOCK_SIZE) ? (str_.size() - block) : BLOCK_SIZE;
+
+                spaces_ = space_mask(str_.data() + block, size);
+                bytes_ = low_bits(size);
+                block_ = block;
+            }
+
+            return space ? spaces_ : (~spaces_ & bytes_);
+        }
+
+        std::string_view str_;
+        std::size_t block_ = std::string_view::npos;
+        std::uint32_t spaces_ = 0;
+        std::uint32_t bytes_ = 0;
+    };
+
+    /**
+     * @brief Walks the boundaries between the words and the runs of separators of a string,
+     * with the same interface as \ref SpaceScanner.
+     *
+     * The separators are the characters of a \ref strpy::CharSet, so the split functions that take
+     * a set treat the runs of separators exactly as the whitespace versions treat the runs of spaces.
+     */
+    class SetScanner
+    {
+    public:
+        /**
+         * @brief Constructs a scanner over a string.
+         *
+         * @param str The string to scan.
+         * @param separators The set of separator characters, it must outlive the scanner.
+         */
+        SetScanner(const std::string_view str, const CharSet& separators) noexcept :
+            str_(str), separators_(separators)
+        {
+        }
+
+        /**
+         * @brief Finds the first separator, or the first other character, at or after a position.
+         *
+         * @param pos The position to start the search at.
+         * @param separator Whether to find a separator or a character that is not one.
+         *
+         * @return The position of the character, or \c std::string_view::npos if there is none.
+         */
+        [[nodiscard]] std::size_t find(const std::size_t pos, const bool separator) const noexcept
+        {
+            return separator ? find_first_of(str_, separators_, pos) : find_first_not_of(str_, separators_, pos);
+        }
+
+        /**
+         * @brief Finds the last separator, or the last other character, before a position.
+         *
+         * @param end The position to search before.
+         * @param separator Whether to find a separator or a character that is not one.
+         *
+         * @return The position of the character, or \c std::string_view::npos if there is none.
+         */
+        [[nodiscard]] std::size_t rfind(const std::size_t end, const bool separator) const noexcept
+        {
+            return separator ? find_last_of(str_, separators_, 0, end) : find_last_not_of(str_, separators_, 0, end);
+        }
+
+    private:
+        std::string_view str_;
+        const CharSet& separators_;
+    };
+}
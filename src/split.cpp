@@ -4,7 +4,9 @@
  */
 
 #include "stringpy/split.hpp"
-#include "stringpy/const.hpp"
+#include "bytescan.hpp"
+#include "spacescan.hpp"
+#include "splitoutput.hpp"
 #include "stringpy/strip.hpp"
 #include <algorithm>
 
@@ -13,34 +15,6 @@ namespace
     /** @brief Setting the initial size of the result vector */
     constexpr std::size_t DEFAULT_RESULT_CAPACITY = 24;
 
-    /** @brief Find the position of the delimiter in the string */
-    std::size_t find_delimiter(const std::string_view str, const std::string_view delimiter,
-                               const std::size_t start) noexcept
-    {
-        return str.find(delimiter, start);
-    }
-
-    /** @brief Find the position of an any space delimiter in the string */
-    std::size_t find_delimiter_space(const std::string_view str, const std::string_view /* delimiter */,
-                                     const std::size_t start) noexcept
-    {
-        return str.find_first_of(strpy::SPACE_CHARS, start);
-    }
-
-    /** @brief Find the position of the delimiter in the string, searching from right to left */
-    std::size_t rfind_delimiter(const std::string_view str, const std::string_view delimiter,
-                                const std::size_t start) noexcept
-    {
-        return str.rfind(delimiter, start);
-    }
-
-    /** @brief Find the position of any space delimiter in the string, searching from right to left */
-    std::size_t rfind_delimiter_space(const std::string_view str, const std::string_view /* delimiter */,
-                                      const std::size_t start) noexcept
-    {
-        return str.find_last_of(strpy::SPACE_CHARS, start);
-    }
-
     /** @brief Convert a StringSplitOptions value to a bool */
     [[nodiscard]] constexpr bool to_bool(const strpy::StringSplitOptions value) noexcept
     {
@@ -48,8 +22,9 @@ namespace
     }
 
     /** @brief Add a substring to the result vector, taking into account the options */
+    template <typename Output>
     bool add_substring_to_result(std::string_view substring, const strpy::StringSplitOptions options,
-                                 std::vector<std::string>& result) noexcept
+                                 Output& result) noexcept
     {
         if (to_bool(options & strpy::StringSplitOptions::trim) && (!substring.empty())) {
             substring = strpy::strip<std::string_view>(substring);
@@ -63,36 +38,21 @@ namespace
         return false;
     }
 
-    /** @brief Type alias for a function pointer to find_delimiter */
-    using FindDelimiterFunc = decltype(&find_delimiter);
-
     /** @brief Split a string using a custom delimiter search function */
-    std::vector<std::string> split_impl(const std::string_view str, const std::string_view delimiter,
-                                        std::size_t maxsplit, const strpy::StringSplitOptions options,
-                                        const FindDelimiterFunc find) noexcept
+    template <typename Ret, typename FindDelimiter>
+    void split_impl(std::vector<Ret>& out, const std::string_view str, const std::size_t delimiter_size,
+                    std::size_t maxsplit, const strpy::StringSplitOptions options, const FindDelimiter& find) noexcept
     {
-        if (str.empty()) {
-            return {};
-        }
-
-        if (delimiter.empty()) {
-            std::vector<std::string> result{};
-            result.emplace_back(str);
-
-            return result;
-        }
+        strpy::detail::SplitOutput<Ret> result{out};
 
         std::size_t start = 0;
         auto end = std::string_view::npos;
-
         const auto str_size = str.size();
-        const auto delimiter_size = delimiter.size();
 
-        std::vector<std::string> result{};
         result.reserve(maxsplit == std::string::npos ? DEFAULT_RESULT_CAPACITY : (maxsplit + 1));
 
         while ((start < str_size) && (maxsplit != 0)) {
-            if (end = find(str, delimiter, start); std::string_view::npos == end) {
+            if (end = find(start); std::string_view::npos == end) {
                 break;
             }
 
@@ -107,40 +67,27 @@ namespace
             result.emplace_back(str.substr(start));
         }
         else if ((start == str_size) && (!to_bool(options & strpy::StringSplitOptions::remove_empty))) {
-            result.emplace_back(strpy::EMPTY_STR);
+            result.emplace_back(str.substr(str_size));
         }
 
-        return result;
+        result.finish();
     }
 
-    /** @brief Type alias for a function pointer to rfind_delimiter */
-    using RFindDelimiterFunc = decltype(&rfind_delimiter);
-
     /** @brief Split a string from the end using a custom delimiter search function */
-    std::vector<std::string> rsplit_impl(const std::string_view str, const std::string_view delimiter,
-                                         std::size_t maxsplit, const strpy::StringSplitOptions options,
-                                         const RFindDelimiterFunc rfind) noexcept
+    template <typename Ret, typename RFindDelimiter>
+    void rsplit_impl(std::vector<Ret>& out, const std::string_view str, const std::size_t delimiter_size,
+                     std::size_t maxsplit, const strpy::StringSplitOptions options,
+                     const RFindDelimiter& rfind) noexcept
     {
-        if (str.empty()) {
-            return {};
-        }
-
-        if (delimiter.empty()) {
-            std::vector<std::string> result{};
-            result.emplace_back(str);
+        strpy::detail::SplitOutput<Ret> result{out};
 
-            return result;
-        }
-
-        const auto delimiter_size = delimiter.size();
         auto start = std::string_view::npos;
         auto end = str.size();
 
-        std::vector<std::string> result{};
         result.reserve(maxsplit == std::string::npos ? DEFAULT_RESULT_CAPACITY : (maxsplit + 1));
 
         while ((end != 0) && (maxsplit != 0)) {
-            if (start = rfind(str, delimiter, end - 1); std::string_view::npos == start) {
+            if (start = rfind(end); std::string_view::npos == start) {
                 break;
             }
 
@@ -156,37 +103,305 @@ namespace
             result.emplace_back(str.substr(0, end));
         }
         else if (!to_bool(options & strpy::StringSplitOptions::remove_empty)) {
-            result.emplace_back(strpy::EMPTY_STR);
+            result.emplace_back(str.substr(0, 0));
+        }
+
+        // Reverse result to have the elements in the correct order after splitting from the end
+        auto& substrings = result.finish();
+        std::reverse(substrings.begin(), substrings.end());
+    }
+
+    /**
+     * @brief Split a string on runs of separators the way Python's str.split() splits on runs of spaces.
+     *
+     * The separators are the space characters of a detail::SpaceScanner or the characters of the set
+     * of a detail::SetScanner. Once max_split words are found, the rest of the string is the last substring
+     * without its leading separators. A string of separators yields no substrings.
+     */
+    template <typename Ret, typename Scanner>
+    void split_words_impl(std::vector<Ret>& out, const std::string_view str, std::size_t max_split,
+                          Scanner scanner) noexcept
+    {
+        strpy::detail::SplitOutput<Ret> result{out};
+
+        result.reserve(max_split == std::string::npos ? DEFAULT_RESULT_CAPACITY : (max_split + 1));
+
+        for (auto start = scanner.find(0, false); std::string_view::npos != start; --max_split) {
+            const auto end = (max_split != 0) ? scanner.find(start, true) : std::string_view::npos;
+
+            if (std::string_view::npos == end) {
+                result.emplace_back(str.substr(start));
+                break;
+            }
+
+            result.emplace_back(str.substr(start, end - start));
+            start = scanner.find(end, false);
+        }
+
+        result.finish();
+    }
+
+    /**
+     * @brief Split a string from the end on runs of separators the way Python's str.rsplit() splits
+     * on runs of spaces.
+     *
+     * Once max_split words are found, the rest of the string is the first substring
+     * without its trailing separators. A string of separators yields no substrings.
+     */
+    template <typename Ret, typename Scanner>
+    void rsplit_words_impl(std::vector<Ret>& out, const std::string_view str, std::size_t max_split,
+                           Scanner scanner) noexcept
+    {
+        strpy::detail::SplitOutput<Ret> result{out};
+
+        result.reserve(max_split == std::string::npos ? DEFAULT_RESULT_CAPACITY : (max_split + 1));
+
+        for (auto last = scanner.rfind(str.size(), false); std::string_view::npos != last; --max_split) {
+            const auto space = (max_split != 0) ? scanner.rfind(last, true) : std::string_view::npos;
+
+            if (std::string_view::npos == space) {
+                result.emplace_back(str.substr(0, last + 1));
+                break;
+            }
+
+            result.emplace_back(str.substr(space + 1, last - space));
+            last = scanner.rfind(space, false);
         }
 
         // Reverse result to have the elements in the correct order after splitting from the end
-        std::reverse(result.begin(), result.end());
+        auto& substrings = result.finish();
+        std::reverse(substrings.begin(), substrings.end());
+    }
+
+    /** @brief Split a string on runs of space characters */
+    template <typename Ret>
+    void split_space_impl(std::vector<Ret>& result, const std::string_view str, const std::size_t max_split) noexcept
+    {
+        split_words_impl(result, str, max_split, strpy::detail::SpaceScanner{str});
+    }
+
+    /** @brief Split a string from the end on runs of space characters */
+    template <typename Ret>
+    void rsplit_space_impl(std::vector<Ret>& result, const std::string_view str, const std::size_t max_split) noexcept
+    {
+        rsplit_words_impl(result, str, max_split, strpy::detail::SpaceScanner{str});
+    }
+
+    /** @brief Split a string on runs of the characters from a set */
+    template <typename Ret>
+    void split_set_impl(std::vector<Ret>& result, const std::string_view str, const strpy::CharSet& separators,
+                        const std::size_t max_split) noexcept
+    {
+        split_words_impl(result, str, max_split, strpy::detail::SetScanner{str, separators});
+    }
+
+    /** @brief Split a string on a delimiter string */
+    template <typename Ret>
+    void split_delimiter_impl(std::vector<Ret>& result, const std::string_view str, const std::string_view delimiter,
+                              const std::size_t max_split, const strpy::StringSplitOptions options) noexcept
+    {
+        if (str.empty()) {
+            result.clear();
+            return;
+        }
+
+        if (delimiter.empty()) {
+            strpy::detail::SplitOutput<Ret> output{result};
+            output.emplace_back(str);
+            output.finish();
+            return;
+        }
+
+        split_impl(result, str, delimiter.size(), max_split, options, [&](const std::size_t start) {
+            return str.find(delimiter, start);
+        });
+    }
+
+    /** @brief Split a string on a delimiter character */
+    template <typename Ret>
+    void split_char_impl(std::vector<Ret>& result, const std::string_view str, const char delimiter,
+                         const std::size_t max_split, const strpy::StringSplitOptions options) noexcept
+    {
+        if (str.empty()) {
+            result.clear();
+            return;
+        }
+
+        split_impl(result, str, 1, max_split, options, [&](const std::size_t start) {
+            return strpy::detail::find_byte(str, delimiter, start);
+        });
+    }
+
+    /** @brief Split a string from the end on runs of the characters from a set */
+    template <typename Ret>
+    void rsplit_set_impl(std::vector<Ret>& result, const std::string_view str, const strpy::CharSet& separators,
+                         const std::size_t max_split) noexcept
+    {
+        rsplit_words_impl(result, str, max_split, strpy::detail::SetScanner{str, separators});
+    }
+
+    /** @brief Split a string from the end on a delimiter string */
+    template <typename Ret>
+    void rsplit_delimiter_impl(std::vector<Ret>& result, const std::string_view str, const std::string_view delimiter,
+                               const std::size_t max_split, const strpy::StringSplitOptions options) noexcept
+    {
+        if (str.empty()) {
+            result.clear();
+            return;
+        }
+
+        if (delimiter.empty()) {
+            strpy::detail::SplitOutput<Ret> output{result};
+            output.emplace_back(str);
+            output.finish();
+            return;
+        }
 
-        return result;
+        // A match must end before the previous one starts, runs of the delimiter are split from the end
+        rsplit_impl(result, str, delimiter.size(), max_split, options, [&](const std::size_t end) {
+            return (end < delimiter.size()) ? std::string_view::npos : str.rfind(delimiter, end - delimiter.size());
+        });
     }
 }
 
-namespace strpy
+namespace strpy::detail
 {
-    std::vector<std::string> split(const std::string_view str, const std::size_t max_split) noexcept
+    void split_into(std::vector<std::string>& result, const std::string_view str, const std::size_t max_split) noexcept
+    {
+        split_space_impl(result, str, max_split);
+    }
+
+    void split_into(std::vector<std::string_view>& result, const std::string_view str,
+                    const std::size_t max_split) noexcept
+    {
+        split_space_impl(result, str, max_split);
+    }
+
+    void split_into(SplitResult& result, const std::string_view str, const std::size_t max_split) noexcept
+    {
+        split_compact(result, [&](auto& substrings) {
+            split_space_impl(substrings, str, max_split);
+        });
+    }
+
+    void split_into(std::vector<std::string>& result, const std::string_view str, const CharSet& separators,
+                    const std::size_t max_split) noexcept
+    {
+        split_set_impl(result, str, separators, max_split);
+    }
+
+    void split_into(std::vector<std::string_view>& result, const std::string_view str, const CharSet& separators,
+                    const std::size_t max_split) noexcept
+    {
+        split_set_impl(result, str, separators, max_split);
+    }
+
+    void split_into(SplitResult& result, const std::string_view str, const CharSet& separators,
+                    const std::size_t max_split) noexcept
+    {
+        split_compact(result, [&](auto& substrings) {
+            split_set_impl(substrings, str, separators, max_split);
+        });
+    }
+
+    void split_into(std::vector<std::string>& result, const std::string_view str, const std::string_view delimiter,
+                    const std::size_t max_split, const StringSplitOptions options) noexcept
+    {
+        split_delimiter_impl(result, str, delimiter, max_split, options);
+    }
+
+    void split_into(std::vector<std::string_view>& result, const std::string_view str,
+                    const std::string_view delimiter, const std::size_t max_split,
+                    const StringSplitOptions options) noexcept
+    {
+        split_delimiter_impl(result, str, delimiter, max_split, options);
+    }
+
+    void split_into(SplitResult& result, const std::string_view str, const std::string_view delimiter,
+                    const std::size_t max_split, const StringSplitOptions options) noexcept
+    {
+        split_compact(result, [&](auto& substrings) {
+            split_delimiter_impl(substrings, str, delimiter, max_split, options);
+        });
+    }
+
+    void split_into(std::vector<std::string>& result, const std::string_view str, const char delimiter,
+                    const std::size_t max_split, const StringSplitOptions options) noexcept
+    {
+        split_char_impl(result, str, delimiter, max_split, options);
+    }
+
+    void split_into(std::vector<std::string_view>& result, const std::string_view str, const char delimiter,
+                    const std::size_t max_split, const StringSplitOptions options) noexcept
+    {
+        split_char_impl(result, str, delimiter, max_split, options);
+    }
+
+    void split_into(SplitResult& result, const std::string_view str, const char delimiter,
+                    const std::size_t max_split, const StringSplitOptions options) noexcept
+    {
+        split_compact(result, [&](auto& substrings) {
+            split_char_impl(substrings, str, delimiter, max_split, options);
+        });
+    }
+
+    void rsplit_into(std::vector<std::string>& result, const std::string_view str,
+                     const std::size_t max_split) noexcept
+    {
+        rsplit_space_impl(result, str, max_split);
+    }
+
+    void rsplit_into(std::vector<std::string_view>& result, const std::string_view str,
+                     const std::size_t max_split) noexcept
+    {
+        rsplit_space_impl(result, str, max_split);
+    }
+
+    void rsplit_into(SplitResult& result, const std::string_view str, const std::size_t max_split) noexcept
+    {
+        split_compact(result, [&](auto& substrings) {
+            rsplit_space_impl(substrings, str, max_split);
+        });
+    }
+
+    void rsplit_into(std::vector<std::string>& result, const std::string_view str, const CharSet& separators,
+                     const std::size_t max_split) noexcept
+    {
+        rsplit_set_impl(result, str, separators, max_split);
+    }
+
+    void rsplit_into(std::vector<std::string_view>& result, const std::string_view str, const CharSet& separators,
+                     const std::size_t max_split) noexcept
+    {
+        rsplit_set_impl(result, str, separators, max_split);
+    }
+
+    void rsplit_into(SplitResult& result, const std::string_view str, const CharSet& separators,
+                     const std::size_t max_split) noexcept
     {
-        return split_impl(str, " ", max_split, StringSplitOptions::trim_remove_empty, find_delimiter_space);
+        split_compact(result, [&](auto& substrings) {
+            rsplit_set_impl(substrings, str, separators, max_split);
+        });
     }
 
-    std::vector<std::string> split(const std::string_view str, const std::string_view delimiter,
-                                   const std::size_t max_split, const StringSplitOptions options) noexcept
+    void rsplit_into(std::vector<std::string>& result, const std::string_view str, const std::string_view delimiter,
+                     const std::size_t max_split, const StringSplitOptions options) noexcept
     {
-        return split_impl(str, delimiter, max_split, options, find_delimiter);
+        rsplit_delimiter_impl(result, str, delimiter, max_split, options);
     }
 
-    std::vector<std::string> rsplit(const std::string_view str, const std::size_t max_split) noexcept
+    void rsplit_into(std::vector<std::string_view>& result, const std::string_view str,
+                     const std::string_view delimiter, const std::size_t max_split,
+                     const StringSplitOptions options) noexcept
     {
-        return rsplit_impl(str, " ", max_split, StringSplitOptions::trim_remove_empty, rfind_delimiter_space);
+        rsplit_delimiter_impl(result, str, delimiter, max_split, options);
     }
 
-    std::vector<std::string> rsplit(const std::string_view str, const std::string_view delimiter,
-                                    const std::size_t max_split, const StringSplitOptions options) noexcept
+    void rsplit_into(SplitResult& result, const std::string_view str, const std::string_view delimiter,
+                     const std::size_t max_split, const StringSplitOptions options) noexcept
     {
-        return rsplit_impl(str, delimiter, max_split, options, rfind_delimiter);
+        split_compact(result, [&](auto& substrings) {
+            rsplit_delimiter_impl(substrings, str, delimiter, max_split, options);
+        });
     }
 }
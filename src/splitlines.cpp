@@ -4,7 +4,8 @@
  */
 
 #include "stringpy/splitlines.hpp"
-#include "stringpy/const.hpp"
+#include "linescan.hpp"
+#include "splitoutput.hpp"
 #include <algorithm>
 #include <cstddef>
 
@@ -12,39 +13,50 @@ namespace
 {
     constexpr std::size_t MIN_RESULT_CAPACITY = 2;
     constexpr std::size_t AVERAGE_LINE_LENGTH = 70;
-}
 
-namespace strpy
-{
-    std::vector<std::string> split_lines(const std::string_view str, const bool keep_ends) noexcept
+    /** @brief Split a string into lines, a line break is either CR, LF or CRLF */
+    template <typename Ret>
+    void split_lines_impl(std::vector<Ret>& out, const std::string_view str, const bool keep_ends) noexcept
     {
-        std::vector<std::string> result{};
+        strpy::detail::SplitOutput<Ret> result{out};
         result.reserve(std::max(MIN_RESULT_CAPACITY, str.size() / AVERAGE_LINE_LENGTH));
 
+        strpy::detail::LineScanner scanner{str};
         std::size_t start = 0;
-        auto end = std::string_view::npos;
-
         const auto str_size = str.size();
-        const std::size_t endline_offset = keep_ends ? 1 : 0;
-
-        // cppcheck-suppress redundantInitialization
-        while ((end = str.find_first_of("\r\n", start)) != std::string_view::npos) {
-            result.emplace_back(str.substr(start, (end - start) + endline_offset));
-            start = (end + 1);
 
-            if ((CARRIAGE_RETURN == str[end]) && (start < str_size) && (LINE_FEED == str[start])) {
-                if (keep_ends) {
-                    result.back() += LINE_FEED;
-                }
+        for (auto end = scanner.next(); std::string_view::npos != end; end = scanner.next()) {
+            const auto next = strpy::detail::skip_line_break(str, end);
 
-                ++start;
-            }
+            result.emplace_back(str.substr(start, (keep_ends ? next : end) - start));
+            start = next;
         }
 
         if (start < str_size) {
             result.emplace_back(str.substr(start));
         }
 
-        return result;
+        result.finish();
+    }
+}
+
+namespace strpy::detail
+{
+    void split_lines_into(std::vector<std::string>& result, const std::string_view str, const bool keep_ends) noexcept
+    {
+        split_lines_impl(result, str, keep_ends);
+    }
+
+    void split_lines_into(std::vector<std::string_view>& result, const std::string_view str,
+                          const bool keep_ends) noexcept
+    {
+        split_lines_impl(result, str, keep_ends);
+    }
+
+    void split_lines_into(SplitResult& result, const std::string_view str, const bool keep_ends) noexcept
+    {
+        split_compact(result, [&](auto& lines) {
+            split_lines_impl(lines, str, keep_ends);
+        });
     }
 }
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ * @brief Internal helpers that store the substrings found by the split functions.
+ */
+
+#pragma once
+
+#include "stringpy/splitresult.hpp"
+#include <string_view>
+#include <cstddef>
+#include <vector>
+
+namespace strpy::detail
+{
+    /**
+     * @brief Writes substrings into a vector, reusing the elements that are already in it.
+     *
+     * The existing elements are assigned in place, so the buffers of the strings are reused
+     * and a vector that is filled again and again stops allocating once it is large enough.
+     * The elements that are not overwritten are removed by \ref finish.
+     */
+    template <typename Ret>
+    class SplitOutput
+    {
+    public:
+        /**
+         * @brief Constructs an output that overwrites a vector from its first element.
+         *
+         * @param result The vector to fill.
+         */
+        explicit SplitOutput(std::vector<Ret>& result) noexcept : result_(result) {}
+
+        /**
+         * @brief Reserves storage for the given number of substrings.
+         *
+         * @param count The number of substrings.
+         */
+        void reserve(const std::size_t count) noexcept
+        {
+            result_.reserve(count);
+        }
+
+        /**
+         * @brief Stores a substring after the ones stored so far.
+         *
+         * @param substring The substring to store.
+         */
+        void emplace_back(const std::string_view substring) noexcept
+        {
+            if (size_ < result_.size()) {
+                result_[size_] = substring;
+            }
+            else {
+                result_.emplace_back(substring);
+            }
+
+            ++size_;
+        }
+
+        /**
+         * @brief Removes the elements that were not overwritten.
+         *
+         * @return The filled vector.
+         */
+        std::vector<Ret>& finish() noexcept
+        {
+            result_.erase(result_.begin() + static_cast<std::ptrdiff_t>(size_), result_.end());
+            return result_;
+        }
+
+    private:
+        std::vector<Ret>& result_;
+        std::size_t size_ = 0;
+    };
+
+    /**
+     * @brief The largest number of views a thread keeps between two splits into a SplitResult.
+     */
+    constexpr std::size_t MAX_KEPT_SUBSTRINGS = std::size_t{1} << 12U;
+
+    /**
+     * @brief Empties a vector of views that is reused by the splits of a thread.
+     *
+     * The storage of a vector that grew past \ref MAX_KEPT_SUBSTRINGS is released, so that a thread
+     * does not keep the memory of its largest split for its whole lifetime.
+     *
+     * @param substrings The vector to empty.
+     */
+    inline void reset_scratch(std::vector<std::string_view>& substrings) noexcept
+    {
+        if (substrings.capacity() > MAX_KEPT_SUBSTRINGS) {
+            std::vector<std::string_view>{}.swap(substrings);
+        }
+        else {
+            substrings.clear();
+        }
+    }
+
+    /**
+     * @brief Fills a SplitResult by collecting the substrings as views first.
+     *
+     * The views are kept in a vector of the calling thread that is reused by the next calls,
+     * so the buffers of the result are allocated once with the exact size. The vector of a large split
+     * is released by \ref reset_scratch.
+     *
+     * @param result The container to fill.
+     * @param split A function that fills a \c std::vector<std::string_view> with the substrings.
+     */
+    template <typename Split>
+    void split_compact(SplitResult& result, const Split& split) noexcept
+    {
+        thread_local std::vector<std::string_view> substrings{};
+
+        split(substrings);
+        result.assign(substrings.cbegin(), substrings.cend());
+        reset_scratch(substrings);
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/splitresult.hpp"
+#include <limits>
+
+namespace strpy
+{
+    void SplitResult::reserve(const size_type count, const size_type bytes) noexcept
+    {
+        if ((bytes > std::numeric_limits<std::uint32_t>::max()) || (!wide_ends_.empty())) {
+            wide_ends_.reserve(count);
+        }
+        else {
+            ends_.reserve(count);
+        }
+
+        buffer_.reserve(bytes);
+    }
+
+    void SplitResult::push_back(const std::string_view substring) noexcept
+    {
+        buffer_.append(substring);
+
+        if (wide_ends_.empty() && (buffer_.size() <= std::numeric_limits<std::uint32_t>::max())) {
+            ends_.push_back(static_cast<std::uint32_t>(buffer_.size()));
+            return;
+        }
+
+        // The end no longer fits in 32 bits, the offsets are converted once and the narrow ones are released
+        if (wide_ends_.empty()) {
+            wide_ends_.reserve(ends_.size() + 1);
+            wide_ends_.assign(ends_.cbegin(), ends_.cend());
+            std::vector<std::uint32_t>{}.swap(ends_);
+        }
+
+        wide_ends_.push_back(buffer_.size());
+    }
+
+    void SplitResult::clear() noexcept
+    {
+        ends_.clear();
+        wide_ends_.clear();
+        buffer_.clear();
+    }
+}
@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/splitview.hpp"
+#include "bytescan.hpp"
+#include "linescan.hpp"
+#include "spacescan.hpp"
+#include "stringpy/strip.hpp"
+
+namespace
+{
+    /** @brief Convert a StringSplitOptions value to a bool */
+    [[nodiscard]] constexpr bool to_bool(const strpy::StringSplitOptions value) noexcept
+    {
+        return static_cast<bool>(static_cast<std::underlying_type_t<strpy::StringSplitOptions>>(value));
+    }
+}
+
+namespace strpy
+{
+    SplitIterator::SplitIterator(const SplitRange& range) noexcept :
+        str_(range.str_), delimiter_(range.delimiter_), separators_(range.separators_),
+        next_(range.reverse_ ? range.str_.size() : 0), splits_left_(range.max_split_), options_(range.options_),
+        delimiter_byte_(range.delimiter_byte_), byte_(range.byte_), any_of_(range.any_of_), space_(range.space_),
+        reverse_(range.reverse_)
+    {
+        // Follow strpy::split, which yields nothing for an empty string and the whole string for an empty delimiter
+        if (str_.empty()) {
+            *this = SplitIterator{};
+        }
+        else if ((!byte_) && (!any_of_) && (!space_) && delimiter_.empty()) {
+            token_ = str_;
+            next_ = std::string_view::npos;
+        }
+        else {
+            ++*this;
+        }
+    }
+
+    template <typename Scanner>
+    void SplitIterator::advance_words(Scanner scanner) noexcept
+    {
+        const auto start = scanner.find(next_, false);
+
+        if (std::string_view::npos == start) {
+            *this = SplitIterator{};
+            return;
+        }
+
+        // After the last split the rest of the string is a single word, as in strpy::split
+        const auto end = (splits_left_ != 0) ? scanner.find(start, true) : std::string_view::npos;
+
+        if (std::string_view::npos == end) {
+            token_ = str_.substr(start);
+            next_ = std::string_view::npos;
+        }
+        else {
+            token_ = str_.substr(start, end - start);
+            next_ = end;
+            --splits_left_;
+        }
+    }
+
+    template <typename Scanner>
+    void SplitIterator::advance_words_reverse(Scanner scanner) noexcept
+    {
+        const auto last = scanner.rfind(next_, false);
+
+        if (std::string_view::npos == last) {
+            *this = SplitIterator{};
+            return;
+        }
+
+        const auto space = (splits_left_ != 0) ? scanner.rfind(last, true) : std::string_view::npos;
+
+        if (std::string_view::npos == space) {
+            token_ = str_.substr(0, last + 1);
+            next_ = std::string_view::npos;
+        }
+        else {
+            token_ = str_.substr(space + 1, last - space);
+            next_ = space;
+            --splits_left_;
+        }
+    }
+
+    SplitIterator& SplitIterator::operator++() noexcept
+    {
+        if (std::string_view::npos == next_) {
+            *this = SplitIterator{};
+        }
+        else if (space_ && reverse_) {
+            advance_words_reverse(detail::SpaceScanner{str_});
+        }
+        else if (space_) {
+            advance_words(detail::SpaceScanner{str_});
+        }
+        else if (any_of_ && reverse_) {
+            advance_words_reverse(detail::SetScanner{str_, separators_});
+        }
+        else if (any_of_) {
+            advance_words(detail::SetScanner{str_, separators_});
+        }
+        else if (reverse_) {
+            advance_reverse();
+        }
+        else {
+            advance();
+        }
+
+        return *this;
+    }
+
+    void SplitIterator::advance() noexcept
+    {
+        const auto str_size = str_.size();
+        const auto delimiter_size = byte_ ? 1 : delimiter_.size();
+
+        while ((next_ < str_size) && (splits_left_ != 0)) {
+            const auto end = find(next_);
+
+            if (std::string_view::npos == end) {
+                break;
+            }
+
+            const auto substring = str_.substr(next_, end - next_);
+            next_ = end + delimiter_size;
+
+            if (accept(substring)) {
+                --splits_left_;
+                return;
+            }
+        }
+
+        if (next_ < str_size) {
+            token_ = str_.substr(next_);
+        }
+        else if ((next_ == str_size) && (!to_bool(options_ & StringSplitOptions::remove_empty))) {
+            token_ = str_.substr(str_size);
+        }
+        else {
+            *this = SplitIterator{};
+            return;
+        }
+
+        next_ = std::string_view::npos;
+    }
+
+    void SplitIterator::advance_reverse() noexcept
+    {
+        const auto delimiter_size = byte_ ? 1 : delimiter_.size();
+
+        while ((next_ != 0) && (splits_left_ != 0)) {
+            const auto start = rfind(next_);
+
+            if (std::string_view::npos == start) {
+                break;
+            }
+
+            const auto substring = str_.substr(start + delimiter_size, next_ - start - delimiter_size);
+            next_ = start;
+
+            if (accept(substring)) {
+                --splits_left_;
+                return;
+            }
+        }
+
+        if (next_ > 0) {
+            token_ = str_.substr(0, next_);
+        }
+        else if (!to_bool(options_ & StringSplitOptions::remove_empty)) {
+            token_ = str_.substr(0, 0);
+        }
+        else {
+            *this = SplitIterator{};
+            return;
+        }
+
+        next_ = std::string_view::npos;
+    }
+
+    std::size_t SplitIterator::find(const std::size_t pos) const noexcept
+    {
+        if (byte_) {
+            return detail::find_byte(str_, delimiter_byte_, pos);
+        }
+
+        return str_.find(delimiter_, pos);
+    }
+
+    std::size_t SplitIterator::rfind(const std::size_t end) const noexcept
+    {
+        if (byte_) {
+            return (0 == end) ? std::string_view::npos : str_.rfind(delimiter_byte_, end - 1);
+        }
+
+        // A match must end before the previous one starts, the same as in strpy::rsplit
+        return (end < delimiter_.size()) ? std::string_view::npos : str_.rfind(delimiter_, end - delimiter_.size());
+    }
+
+    bool SplitIterator::accept(std::string_view substring) noexcept
+    {
+        if (to_bool(options_ & StringSplitOptions::trim) && (!substring.empty())) {
+            substring = strip<std::string_view>(substring);
+        }
+
+        if ((!to_bool(options_ & StringSplitOptions::remove_empty)) || (!substring.empty())) {
+            token_ = substring;
+            return true;
+        }
+
+        return false;
+    }
+
+    LineIterator::LineIterator(const std::string_view str, const bool keep_ends) noexcept :
+        str_(str), keep_ends_(keep_ends)
+    {
+        ++*this;
+    }
+
+    LineIterator& LineIterator::operator++() noexcept
+    {
+        const auto str_size = str_.size();
+
+        if (next_ >= str_size) {
+            *this = LineIterator{};
+            return *this;
+        }
+
+        const auto end = detail::find_line_break(str_, next_);
+
+        if (std::string_view::npos == end) {
+            line_ = str_.substr(next_);
+            next_ = str_size;
+            return *this;
+        }
+
+        const auto after = detail::skip_line_break(str_, end);
+        line_ = str_.substr(next_, (keep_ends_ ? after : end) - next_);
+        next_ = after;
+
+        return *this;
+    }
+}
@@ -4,6 +4,7 @@
  */
 
 #include "stringpy/stype.hpp"
+#include "bytemap.hpp"
 
 namespace
 {
@@ -65,7 +66,13 @@ namespace strpy
 
         std::string result{};
         result.resize(str.size());
-        std::transform(str.cbegin(), str.cend(), result.begin(), to_lower_char<std::string_view::value_type>);
+
+        if (str.size() < detail::BYTE_MAP_MIN_SIZE) {
+            std::transform(str.cbegin(), str.cend(), result.begin(), to_lower_char<std::string_view::value_type>);
+        }
+        else {
+            detail::map_bytes(detail::make_byte_map(to_lower_char<std::string_view::value_type>), str, result.data());
+        }
 
         return result;
     }
@@ -78,7 +85,13 @@ namespace strpy
 
         std::string result{};
         result.resize(str.size());
-        std::transform(str.cbegin(), str.cend(), result.begin(), to_upper_char<std::string_view::value_type>);
+
+        if (str.size() < detail::BYTE_MAP_MIN_SIZE) {
+            std::transform(str.cbegin(), str.cend(), result.begin(), to_upper_char<std::string_view::value_type>);
+        }
+        else {
+            detail::map_bytes(detail::make_byte_map(to_upper_char<std::string_view::value_type>), str, result.data());
+        }
 
         return result;
     }
@@ -4,6 +4,7 @@
  */
 
 #include "stringpy/swapcase.hpp"
+#include "bytemap.hpp"
 #include "stringpy/ctype.hpp"
 #include <algorithm>
 
@@ -29,7 +30,13 @@ namespace strpy
         }
 
         std::string result{str};
-        std::transform(result.begin(), result.end(), result.begin(), swap_case_char);
+
+        if (str.size() < detail::BYTE_MAP_MIN_SIZE) {
+            std::transform(result.begin(), result.end(), result.begin(), swap_case_char);
+        }
+        else {
+            detail::map_bytes(detail::make_byte_map(swap_case_char), result, result.data());
+        }
 
         return result;
     }
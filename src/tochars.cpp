@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/tochars.hpp"
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    /** @brief The decimal representations of the numbers from 0 to 99, two characters each */
+    constexpr char DIGIT_PAIRS[] = "00010203040506070809"
+                                   "10111213141516171819"
+                                   "20212223242526272829"
+                                   "30313233343536373839"
+                                   "40414243444546474849"
+                                   "50515253545556575859"
+                                   "60616263646566676869"
+                                   "70717273747576777879"
+                                   "80818283848586878889"
+                                   "90919293949596979899";
+
+    /** @brief The lowest decimal exponent written in the fixed notation, the same as in Python */
+    constexpr int MIN_FIXED_EXPONENT = -4;
+
+    /** @brief The lowest decimal exponent written in the scientific notation, the same as in Python */
+    constexpr int MAX_FIXED_EXPONENT = 16;
+
+    /** @brief The significant digits and the decimal exponent of a floating-point number */
+    struct Decimal
+    {
+        std::array<char, strpy::TO_CHARS_MAX_SIZE> digits{};
+        int size = 0;
+        int exponent = 0;
+    };
+
+    /** @brief Returns the number of decimal digits of an integer */
+    int count_digits(std::uint64_t value) noexcept
+    {
+        int count = 1;
+
+        for (;;) {
+            if (value < 10U) {
+                return count;
+            }
+
+            if (value < 100U) {
+                return count + 1;
+            }
+
+            if (value < 1000U) {
+                return count + 2;
+            }
+
+            if (value < 10000U) {
+                return count + 3;
+            }
+
+            value /= 10000U;
+            count += 4;
+        }
+    }
+
+    /** @brief Copies the characters of a string literal */
+    char* write_literal(char* const first, const char* const str) noexcept
+    {
+        const auto size = std::strlen(str);
+        std::memcpy(first, str, size);
+
+        return first + size;
+    }
+
+    /**
+     * @brief Reads the digits and the exponent of a number written in the scientific notation
+     *
+     * The sign, the decimal point and the leading zeros of the exponent are skipped.
+     */
+    Decimal parse_scientific(const char* first, const char* const last) noexcept
+    {
+        Decimal decimal{};
+
+        for (; (first != last) && (*first != 'e') && (*first != 'E'); ++first) {
+            if ((*first >= '0') && (*first <= '9')) {
+                decimal.digits[static_cast<std::size_t>(decimal.size++)] = *first;
+            }
+        }
+
+        if (first != last) {
+            decimal.exponent = std::atoi(first + 1); // NOLINT(cert-err34-c)
+        }
+
+        // The scientific notation keeps trailing zeros when the precision is given
+        while ((decimal.size > 1) && ('0' == decimal.digits[static_cast<std::size_t>(decimal.size - 1)])) {
+            --decimal.size;
+        }
+
+        return decimal;
+    }
+
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+    /** @brief Finds the shortest digits that read back as the number */
+    template <typename T>
+    Decimal shortest_decimal(const T value) noexcept
+    {
+        std::array<char, strpy::TO_CHARS_MAX_SIZE> buffer{};
+        const auto result =
+          std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::scientific);
+
+        return parse_scientific(buffer.data(), result.ptr);
+    }
+#else
+    /** @brief Finds the shortest digits that read back as the number, trying one precision after another */
+    template <typename T>
+    Decimal shortest_decimal(const T value) noexcept
+    {
+        // A float is promoted to a double exactly, and a double reads back as the same float when rounded
+        using PrintType = std::conditional_t<std::is_same_v<T, long double>, long double, double>;
+        constexpr auto pattern = std::is_same_v<T, long double> ? "%.*Le" : "%.*e";
+        std::array<char, strpy::TO_CHARS_MAX_SIZE> buffer{};
+
+        for (int precision = 1;; ++precision) {
+            const auto size = std::snprintf(buffer.data(), buffer.size(), pattern, precision - 1,
+                                            static_cast<PrintType>(value));
+            char* end = nullptr;
+            T parsed{};
+
+            if constexpr (std::is_same_v<T, float>) {
+                parsed = std::strtof(buffer.data(), &end);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                parsed = std::strtod(buffer.data(), &end);
+            }
+            else {
+                parsed = std::strtold(buffer.data(), &end);
+            }
+
+            if ((parsed == value) || (precision >= std::numeric_limits<T>::max_digits10)) {
+                return parse_scientific(buffer.data(), buffer.data() + size);
+            }
+        }
+    }
+#endif
+
+    /** @brief Writes a finite floating-point number in the notation chosen by its exponent */
+    template <typename T>
+    char* write_decimal(char* out, const T value) noexcept
+    {
+        if (std::isnan(value)) {
+            return write_literal(out, "nan");
+        }
+
+        if (std::signbit(value)) {
+            *out++ = '-';
+        }
+
+        if (std::isinf(value)) {
+            return write_literal(out, "inf");
+        }
+
+        const auto decimal = shortest_decimal(std::fabs(value));
+        const auto* const digits = decimal.digits.data();
+        const auto size = decimal.size;
+        const auto exponent = decimal.exponent;
+
+        if ((exponent < MIN_FIXED_EXPONENT) || (exponent >= MAX_FIXED_EXPONENT)) {
+            *out++ = digits[0];
+
+            if (size > 1) {
+                *out++ = '.';
+                std::memcpy(out, digits + 1, static_cast<std::size_t>(size - 1));
+                out += size - 1;
+            }
+
+            *out++ = 'e';
+            *out++ = (exponent < 0) ? '-' : '+';
+            const auto abs_exponent = static_cast<unsigned>((exponent < 0) ? -exponent : exponent);
+
+            // The exponent has at least two digits, as in C and Python
+            if (abs_exponent < 10U) {
+                *out++ = '0';
+            }
+
+            return strpy::detail::write_unsigned(out, abs_exponent);
+        }
+
+        if (exponent < 0) {
+            *out++ = '0';
+            *out++ = '.';
+            std::memset(out, '0', static_cast<std::size_t>(-exponent - 1));
+            out += -exponent - 1;
+            std::memcpy(out, digits, static_cast<std::size_t>(size));
+
+            return out + size;
+        }
+
+        const auto int_size = exponent + 1;
+
+        if (size <= int_size) {
+            std::memcpy(out, digits, static_cast<std::size_t>(size));
+            std::memset(out + size, '0', static_cast<std::size_t>(int_size - size));
+
+            return out + int_size;
+        }
+
+        std::memcpy(out, digits, static_cast<std::size_t>(int_size));
+        out += int_size;
+        *out++ = '.';
+        std::memcpy(out, digits + int_size, static_cast<std::size_t>(size - int_size));
+
+        return out + (size - int_size);
+    }
+}
+
+namespace strpy::detail
+{
+    char* write_signed(char* first, const std::int64_t value) noexcept
+    {
+        if (value < 0) {
+            *first++ = '-';
+
+            // The magnitude of the lowest value does not fit into the signed type
+            return write_unsigned(first, std::uint64_t{0} - static_cast<std::uint64_t>(value));
+        }
+
+        return write_unsigned(first, static_cast<std::uint64_t>(value));
+    }
+
+    char* write_unsigned(char* const first, std::uint64_t value) noexcept
+    {
+        constexpr unsigned pair_divisor = 100U;
+        const auto last = first + count_digits(value);
+        auto* out = last;
+
+        while (value >= pair_divisor) {
+            const auto pair = static_cast<std::size_t>(value % pair_divisor) * 2;
+            value /= pair_divisor;
+            *--out = DIGIT_PAIRS[pair + 1];
+            *--out = DIGIT_PAIRS[pair];
+        }
+
+        if (value >= 10U) {
+            const auto pair = static_cast<std::size_t>(value) * 2;
+            *--out = DIGIT_PAIRS[pair + 1];
+            *--out = DIGIT_PAIRS[pair];
+        }
+        else {
+            *--out = static_cast<char>('0' + value);
+        }
+
+        return last;
+    }
+
+    char* write_float(char* const first, const float value) noexcept
+    {
+        return write_decimal(first, value);
+    }
+
+    char* write_float(char* const first, const double value) noexcept
+    {
+        return write_decimal(first, value);
+    }
+
+    char* write_float(char* const first, const long double value) noexcept
+    {
+        return write_decimal(first, value);
+    }
+}
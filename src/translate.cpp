@@ -4,6 +4,8 @@
  */
 
 #include "stringpy/translate.hpp"
+#include "bytemap.hpp"
+#include "stringpy/charset.hpp"
 #include <cstddef>
 #include <utility>
 
@@ -36,18 +38,36 @@ namespace strpy
             return std::string{str};
         }
 
+        detail::ByteMap::Table table{};
+        CharSet deleted{};
+
+        for (std::size_t byte = 0; byte < table.size(); ++byte) {
+            table[byte] = static_cast<std::string::value_type>(byte);
+        }
+
+        for (const auto& [from, to] : trans_map) {
+            if (EOS == to) {
+                deleted.insert(from);
+            }
+            else {
+                table[static_cast<unsigned char>(from)] = to;
+            }
+        }
+
         std::string result{};
+
+        if (deleted.empty()) {
+            result.resize(str.size());
+            detail::map_bytes(detail::make_byte_map(table), str, result.data());
+
+            return result;
+        }
+
         result.reserve(str.size());
-        const auto& end = trans_map.end();
 
         for (const auto ch : str) {
-            const auto& it = trans_map.find(ch);
-
-            if (it == end) {
-                result += ch;
-            }
-            else if (it->second != EOS) {
-                result += it->second;
+            if (!deleted.contains(ch)) {
+                result += table[static_cast<unsigned char>(ch)];
             }
         }
 
@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/charset.hpp"
+#include "stringpy/equal.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace
+{
+    constexpr strpy::CharSet VOWELS{"aeiou"};
+
+    static_assert(VOWELS.contains('a'));
+    static_assert(!VOWELS.contains('b'));
+    static_assert(!VOWELS.empty());
+    static_assert(strpy::CharSet{}.empty());
+    static_assert(strpy::SPACE_SET.contains('\t'));
+
+    TEST(CharSetTest, Basic)
+    {
+        EXPECT_TRUE(VOWELS.contains('e'));
+        EXPECT_FALSE(VOWELS.contains('E'));
+        EXPECT_FALSE(VOWELS.contains('\0'));
+
+        strpy::CharSet set{};
+        EXPECT_TRUE(set.empty());
+        set.insert('\xFF').insert('\0');
+        EXPECT_TRUE(set.contains('\xFF'));
+        EXPECT_TRUE(set.contains('\0'));
+        EXPECT_FALSE(set.contains('\x7F'));
+        EXPECT_EQ(set, strpy::CharSet(std::string_view{"\xFF\0", 2}));
+        EXPECT_NE(set, VOWELS);
+    }
+
+    TEST(CharSetTest, AllBytes)
+    {
+        strpy::CharSet set{};
+
+        for (int byte = 0; byte < 256; byte += 3) {
+            set.insert(static_cast<char>(byte));
+        }
+
+        for (int byte = 0; byte < 256; ++byte) {
+            EXPECT_EQ(set.contains(static_cast<char>(byte)), (byte % 3) == 0) << byte;
+        }
+    }
+
+    TEST(CharSetTest, NibbleRows)
+    {
+        for (const auto& set : {VOWELS, strpy::SPACE_SET, strpy::make_charset_icase("xyz\x80\xFF"), strpy::CharSet{}}) {
+            for (int byte = 0; byte < 256; ++byte) {
+                const auto& rows = (byte < 128) ? set.low_rows() : set.high_rows();
+                const auto bit = (rows[static_cast<std::size_t>(byte % 16)] >> ((byte / 16) % 8)) & 1U;
+                EXPECT_EQ(bit != 0, set.contains(static_cast<char>(byte))) << byte;
+            }
+        }
+    }
+
+    TEST(MakeCharSetICaseTest, Basic)
+    {
+        const auto set = strpy::make_charset_icase("aB1");
+        EXPECT_TRUE(set.contains('a'));
+        EXPECT_TRUE(set.contains('A'));
+        EXPECT_TRUE(set.contains('b'));
+        EXPECT_TRUE(set.contains('B'));
+        EXPECT_TRUE(set.contains('1'));
+        EXPECT_FALSE(set.contains('c'));
+        EXPECT_TRUE(strpy::make_charset_icase("").empty());
+    }
+
+    TEST(MakeCharSetICaseTest, MatchesEqualCharICase)
+    {
+        constexpr std::string_view chars{"xY?\t"};
+        const auto set = strpy::make_charset_icase(chars);
+
+        for (int byte = 0; byte < 256; ++byte) {
+            const auto ch = static_cast<char>(byte);
+            const auto expected = std::any_of(chars.cbegin(), chars.cend(), [ch](const char other) {
+                return strpy::equal_char_icase(ch, other);
+            });
+
+            EXPECT_EQ(set.contains(ch), expected) << byte;
+        }
+    }
+}
@@ -5,6 +5,7 @@
 
 #include "stringpy/count.hpp"
 #include <gtest/gtest.h>
+#include <string>
 
 namespace
 {
@@ -72,6 +73,33 @@ namespace
         EXPECT_EQ(strpy::count(str, sub), 2);
     }
 
+    TEST(CountTest, Char)
+    {
+        constexpr std::string_view str{"a,b,,c,"};
+        EXPECT_EQ(strpy::count(str, ','), 4);
+        EXPECT_EQ(strpy::count(str, ',', 2), 3);
+        EXPECT_EQ(strpy::count(str, ',', 2, 5), 2);
+        EXPECT_EQ(strpy::count(str, ',', 4, 2), 0);
+        EXPECT_EQ(strpy::count(str, ',', 100), 0);
+        EXPECT_EQ(strpy::count(str, 'x'), 0);
+        EXPECT_EQ(strpy::count("", ','), 0);
+    }
+
+    TEST(CountTest, CharLongString)
+    {
+        std::string str{};
+
+        for (int i = 0; i < 100; ++i) {
+            str += "key=value\n\xFF";
+        }
+
+        EXPECT_EQ(strpy::count(str, '\n'), 100);
+        EXPECT_EQ(strpy::count(str, '\xFF'), 100);
+        EXPECT_EQ(strpy::count(str, 'e'), 200);
+        EXPECT_EQ(strpy::count(str, 'e', 1, str.size() - 1), 200);
+        EXPECT_EQ(strpy::count(str, 'e', 5, str.size() - 3), 198);
+    }
+
     TEST(CountICaseTest, Basic)
     {
         constexpr std::string_view str{"abCabcAbc"};
@@ -135,4 +163,17 @@ namespace
         constexpr std::string_view sub{"AbA"};
         EXPECT_EQ(strpy::count_icase(str, sub), 2);
     }
+
+    TEST(CountICaseTest, LongString)
+    {
+        std::string str{};
+
+        for (int i = 0; i < 100; ++i) {
+            str += "some HayStack text, then a NeeDLE, ";
+        }
+
+        EXPECT_EQ(strpy::count_icase(str, "needle"), 100);
+        EXPECT_EQ(strpy::count_icase(str, "HAYSTACK TEXT"), 100);
+        EXPECT_EQ(strpy::count_icase(str, "needles"), 0);
+    }
 }
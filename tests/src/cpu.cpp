@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/cpu.hpp"
+#include "stringpy/ctype.hpp"
+#include "stringpy/equal.hpp"
+#include "stringpy/find.hpp"
+#include "stringpy/split.hpp"
+#include "stringpy/stype.hpp"
+#include "stringpy/swapcase.hpp"
+#include "stringpy/translate.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /** @brief Restores the active level when a test ends */
+    class LevelGuard
+    {
+    public:
+        LevelGuard() noexcept : level_(strpy::simd_level()) {}
+
+        LevelGuard(const LevelGuard&) = delete;
+        LevelGuard& operator=(const LevelGuard&) = delete;
+
+        ~LevelGuard()
+        {
+            strpy::set_simd_level(level_);
+        }
+
+    private:
+        strpy::SimdLevel level_;
+    };
+
+    /** @brief Returns all levels up to the supported one */
+    std::vector<strpy::SimdLevel> levels()
+    {
+        std::vector<strpy::SimdLevel> result{};
+
+        for (auto level = 0U; level <= static_cast<unsigned>(strpy::supported_simd_level()); ++level) {
+            result.push_back(static_cast<strpy::SimdLevel>(level));
+        }
+
+        return result;
+    }
+
+    /** @brief Returns a reproducible string of letters, digits, spaces and bytes above 127 */
+    std::string make_text(const std::size_t size, std::uint32_t seed)
+    {
+        constexpr std::string_view alphabet{"aAbBzZ09 \t\n_-\x80\xC3\xFF"};
+        std::string result{};
+
+        for (std::size_t i = 0; i < size; ++i) {
+            seed = (seed * 1103515245U) + 12345U;
+            result += alphabet[(seed >> 16U) % alphabet.size()];
+        }
+
+        return result;
+    }
+
+    std::size_t naive_find_icase(const std::string_view str, const std::string_view sub)
+    {
+        for (std::size_t pos = 0; (pos + sub.size()) <= str.size(); ++pos) {
+            if (strpy::equal_icase(str.substr(pos, sub.size()), sub)) {
+                return pos;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    std::size_t naive_rfind_icase(const std::string_view str, const std::string_view sub)
+    {
+        if (str.size() < sub.size()) {
+            return std::string_view::npos;
+        }
+
+        for (auto pos = str.size() - sub.size() + 1; pos != 0; --pos) {
+            if (strpy::equal_icase(str.substr(pos - 1, sub.size()), sub)) {
+                return pos - 1;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    TEST(CpuTest, ActiveLevelIsSupported)
+    {
+        EXPECT_LE(strpy::simd_level(), strpy::supported_simd_level());
+    }
+
+    TEST(CpuTest, SetLevel)
+    {
+        const LevelGuard guard{};
+
+        EXPECT_EQ(strpy::set_simd_level(strpy::SimdLevel::scalar), strpy::SimdLevel::scalar);
+        EXPECT_EQ(strpy::simd_level(), strpy::SimdLevel::scalar);
+        EXPECT_EQ(strpy::set_simd_level(strpy::SimdLevel::avx2), strpy::supported_simd_level());
+        EXPECT_EQ(strpy::simd_level(), strpy::supported_simd_level());
+    }
+
+    TEST(CpuTest, LevelName)
+    {
+        EXPECT_EQ(strpy::simd_level_name(strpy::SimdLevel::scalar), "scalar");
+        EXPECT_EQ(strpy::simd_level_name(strpy::SimdLevel::sse42), "sse42");
+        EXPECT_EQ(strpy::simd_level_name(strpy::SimdLevel::avx2), "avx2");
+    }
+
+    TEST(CpuTest, SearchAtEveryLevel)
+    {
+        const LevelGuard guard{};
+
+        for (const auto level : levels()) {
+            strpy::set_simd_level(level);
+
+            for (std::size_t size = 0; size < 300; size += 7) {
+                const auto str = make_text(size, static_cast<std::uint32_t>(size));
+
+                for (const std::string_view sub : {"a", "Zb", "b\xFF", "0a9", "aaaa", "zZ_\t"}) {
+                    EXPECT_EQ(strpy::find_icase(str, sub), naive_find_icase(str, sub))
+                      << strpy::simd_level_name(level) << ' ' << size << ' ' << sub;
+                    EXPECT_EQ(strpy::rfind_icase(str, sub), naive_rfind_icase(str, sub))
+                      << strpy::simd_level_name(level) << ' ' << size << ' ' << sub;
+                }
+            }
+        }
+    }
+
+    TEST(CpuTest, ClassifyAtEveryLevel)
+    {
+        const LevelGuard guard{};
+
+        for (const auto level : levels()) {
+            strpy::set_simd_level(level);
+
+            for (std::size_t size = 0; size < 300; size += 7) {
+                const auto str = make_text(size, static_cast<std::uint32_t>(size));
+                const auto spaces = std::string(size, ' ') + str + std::string(size, '\t');
+
+                EXPECT_EQ(strpy::find_first_of_icase(str, "z\xFF"), str.find_first_of("zZ\xFF"));
+                EXPECT_EQ(strpy::find_last_of_icase(str, "z\xFF"), str.find_last_of("zZ\xFF"));
+                EXPECT_EQ(strpy::find_first_not_of(spaces, " \t"), spaces.find_first_not_of(" \t"));
+                EXPECT_EQ(strpy::find_last_not_of(spaces, " \t"), spaces.find_last_not_of(" \t"));
+                EXPECT_EQ(strpy::split(str).size(), strpy::split(str, strpy::SPACE_SET).size());
+            }
+        }
+    }
+
+    TEST(CpuTest, CaseConversionAtEveryLevel)
+    {
+        const LevelGuard guard{};
+
+        for (const auto level : levels()) {
+            strpy::set_simd_level(level);
+
+            for (const std::size_t size : {255U, 256U, 257U, 1000U}) {
+                const auto str = make_text(size, static_cast<std::uint32_t>(size));
+                std::string lower{};
+                std::string upper{};
+                std::string swapped{};
+
+                for (const auto ch : str) {
+                    lower += strpy::to_lower_char(ch);
+                    upper += strpy::to_upper_char(ch);
+                    swapped += strpy::swap_case_char(ch);
+                }
+
+                EXPECT_EQ(strpy::to_lower(str), lower) << strpy::simd_level_name(level) << ' ' << size;
+                EXPECT_EQ(strpy::to_upper(str), upper) << strpy::simd_level_name(level) << ' ' << size;
+                EXPECT_EQ(strpy::swap_case(str), swapped) << strpy::simd_level_name(level) << ' ' << size;
+            }
+        }
+    }
+
+    TEST(CpuTest, TranslateAtEveryLevel)
+    {
+        const LevelGuard guard{};
+        const auto shift = strpy::make_trans("abcdefghijklmnopqrstuvwxyz", "bcdefghijklmnopqrstuvwxyza");
+        const auto scatter = strpy::make_trans("aZ\xFF_", "\x80-z9");
+        const auto remove = strpy::make_trans("a", "A", "\t\xC3");
+
+        for (const auto level : levels()) {
+            strpy::set_simd_level(level);
+
+            for (const std::size_t size : {1U, 31U, 64U, 1000U}) {
+                const auto str = make_text(size, static_cast<std::uint32_t>(size));
+
+                for (const auto* trans_map : {&shift, &scatter, &remove}) {
+                    std::string expected{};
+
+                    for (const auto ch : str) {
+                        const auto it = trans_map->find(ch);
+
+                        if (it == trans_map->end()) {
+                            expected += ch;
+                        }
+                        else if (it->second != strpy::EOS) {
+                            expected += it->second;
+                        }
+                    }
+
+                    EXPECT_EQ(strpy::translate(str, *trans_map), expected)
+                      << strpy::simd_level_name(level) << ' ' << size;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/csv.hpp"
+#include <gtest/gtest.h>
+#include <string_view>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Fields = std::vector<std::string>;
+
+    /** @brief Copies the fields of a record */
+    Fields to_fields(const strpy::CsvRecord& record)
+    {
+        return {record.begin(), record.end()};
+    }
+
+    /** @brief Reads all records of an input given at once */
+    std::vector<Fields> read_all(const std::string_view data, const char delimiter = ',')
+    {
+        std::vector<Fields> result{};
+        strpy::CsvReader reader{data, delimiter};
+        strpy::CsvRecord record{};
+
+        while (reader.next(record)) {
+            result.push_back(to_fields(record));
+        }
+
+        return result;
+    }
+
+    /** @brief Reads all records of an input given in chunks of the given size */
+    std::vector<Fields> read_chunked(const std::string_view data, const std::size_t chunk_size)
+    {
+        std::vector<Fields> result{};
+        strpy::CsvReader reader{};
+        strpy::CsvRecord record{};
+
+        for (std::size_t pos = 0; pos < data.size(); pos += chunk_size) {
+            reader.feed(data.substr(pos, chunk_size));
+
+            while (reader.next(record)) {
+                result.push_back(to_fields(record));
+            }
+        }
+
+        reader.feed({}, true);
+
+        while (reader.next(record)) {
+            result.push_back(to_fields(record));
+        }
+
+        return result;
+    }
+
+    /** @brief Checks whether a field is a view into a string */
+    bool is_view_of(const std::string_view field, const std::string_view str)
+    {
+        return (field.data() >= str.data()) && ((field.data() + field.size()) <= (str.data() + str.size()));
+    }
+
+    TEST(SplitCsvTest, Basic)
+    {
+        EXPECT_EQ(to_fields(strpy::split_csv("a,b,c")), (Fields{"a", "b", "c"}));
+        EXPECT_EQ(to_fields(strpy::split_csv("a,,c,")), (Fields{"a", "", "c", ""}));
+        EXPECT_EQ(to_fields(strpy::split_csv(",")), (Fields{"", ""}));
+        EXPECT_EQ(to_fields(strpy::split_csv("single")), (Fields{"single"}));
+        EXPECT_EQ(to_fields(strpy::split_csv("a,b\r\n")), (Fields{"a", "b"}));
+        EXPECT_EQ(to_fields(strpy::split_csv("a,b\nc,d")), (Fields{"a", "b"}));
+        EXPECT_EQ(to_fields(strpy::split_csv("a\tb c", '\t')), (Fields{"a", "b c"}));
+        EXPECT_TRUE(strpy::split_csv("").empty());
+        EXPECT_TRUE(strpy::split_csv("\r\n").empty());
+    }
+
+    TEST(SplitCsvTest, Quoted)
+    {
+        EXPECT_EQ(to_fields(strpy::split_csv(R"("a,b",c)")), (Fields{"a,b", "c"}));
+        EXPECT_EQ(to_fields(strpy::split_csv(R"("say ""hi""",x)")), (Fields{R"(say "hi")", "x"}));
+        EXPECT_EQ(to_fields(strpy::split_csv("\"two\nlines\",z\n")), (Fields{"two\nlines", "z"}));
+        EXPECT_EQ(to_fields(strpy::split_csv(R"("","""")")), (Fields{"", "\""}));
+        EXPECT_EQ(to_fields(strpy::split_csv(R"("a"b,c)")), (Fields{"ab", "c"}));
+        EXPECT_EQ(to_fields(strpy::split_csv(R"("unterminated,field)")), (Fields{"unterminated,field"}));
+        EXPECT_EQ(to_fields(strpy::split_csv("'it''s';ok", ';', '\'')), (Fields{"it's", "ok"}));
+    }
+
+    TEST(SplitCsvTest, Views)
+    {
+        const std::string str = R"(plain,"quoted, with comma","escaped ""quote""")";
+        const auto record = strpy::split_csv(str);
+
+        ASSERT_EQ(record.size(), 3U);
+        EXPECT_TRUE(is_view_of(record[0], str));
+        EXPECT_TRUE(is_view_of(record[1], str));
+        EXPECT_FALSE(is_view_of(record[2], str));
+        EXPECT_EQ(record[2], R"(escaped "quote")");
+
+        auto copy = std::make_unique<strpy::CsvRecord>(record);
+        const strpy::CsvRecord moved{std::move(*copy)};
+        copy.reset();
+
+        EXPECT_EQ(to_fields(moved), to_fields(record));
+        EXPECT_NE(moved[2].data(), record[2].data());
+    }
+
+    TEST(CsvReaderTest, Records)
+    {
+        const std::string data = "id,name,comment\r\n"
+                                 "1,apple,\"red, sweet\"\r\n"
+                                 "\r\n"
+                                 "2,\"ban\nana\",\"a \"\"long\"\" one that crosses a block boundary\"\n"
+                                 "3,cherry,";
+
+        const std::vector<Fields> expected = {{"id", "name", "comment"},
+                                              {"1", "apple", "red, sweet"},
+                                              {},
+                                              {"2", "ban\nana", R"(a "long" one that crosses a block boundary)"},
+                                              {"3", "cherry", ""}};
+
+        EXPECT_EQ(read_all(data), expected);
+        EXPECT_TRUE(read_all("").empty());
+        EXPECT_EQ(read_all("a\tb\n\tc\n", '\t'), (std::vector<Fields>{{"a", "b"}, {"", "c"}}));
+    }
+
+    TEST(CsvReaderTest, Chunks)
+    {
+        std::string data{};
+
+        for (std::size_t i = 0; i < 40; ++i) {
+            data += std::to_string(i) + ",\"quoted " + std::string(i % 7, ',') + "\",\"esc\"\"aped\n" +
+                    std::string(i % 5, 'x') + "\"," + std::string(i % 37, 'y') + ((i % 3) != 0 ? "\n" : "\r\n");
+        }
+
+        data += "\"last\nrecord\"";
+        const auto expected = read_all(data);
+
+        ASSERT_EQ(expected.size(), 41U);
+        EXPECT_EQ(expected[6], (Fields{"6", "quoted ,,,,,,", "esc\"aped\nx", std::string(6, 'y')}));
+        EXPECT_EQ(expected.back(), (Fields{"last\nrecord"}));
+
+        for (std::size_t chunk_size = 1; chunk_size <= 70; ++chunk_size) {
+            EXPECT_EQ(read_chunked(data, chunk_size), expected) << chunk_size;
+        }
+    }
+
+    TEST(CsvReaderTest, LastChunk)
+    {
+        strpy::CsvReader reader{};
+        strpy::CsvRecord record{};
+
+        reader.feed("a,\"b");
+        EXPECT_FALSE(reader.next(record));
+
+        reader.feed("\nc\",d\ne,", true);
+        ASSERT_TRUE(reader.next(record));
+        EXPECT_EQ(to_fields(record), (Fields{"a", "b\nc", "d"}));
+        ASSERT_TRUE(reader.next(record));
+        EXPECT_EQ(to_fields(record), (Fields{"e", ""}));
+        EXPECT_FALSE(reader.next(record));
+    }
+
+    TEST(CsvReaderTest, CarriedRecordCopies)
+    {
+        strpy::CsvReader reader{};
+        strpy::CsvRecord record{};
+        std::vector<strpy::CsvRecord> records{};
+
+        const std::vector<std::string> chunks = {"a,b\nc,", "d\n\"e\"\"\",", "f\n"};
+
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            reader.feed(chunks[i], (i + 1) == chunks.size());
+
+            while (reader.next(record)) {
+                records.push_back(record);
+            }
+        }
+
+        const std::vector<Fields> expected = {{"a", "b"}, {"c", "d"}, {"e\"", "f"}};
+        ASSERT_EQ(records.size(), expected.size());
+
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            EXPECT_EQ(to_fields(records[i]), expected[i]) << i;
+            EXPECT_EQ(is_view_of(records[i][0], chunks[i]), 0 == i) << i;
+        }
+    }
+}
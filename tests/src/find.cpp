@@ -4,10 +4,44 @@
  */
 
 #include "stringpy/find.hpp"
+#include "stringpy/equal.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
 
 namespace
 {
+    /** @brief Builds a long mixed-case string with a few near misses of "NeEdLe" */
+    std::string make_haystack(const std::size_t size)
+    {
+        constexpr std::string_view pattern{"xNeEdLyzneedlXnEEDLq"};
+        std::string result{};
+        result.reserve(size);
+
+        while (result.size() < size) {
+            result += pattern;
+        }
+
+        result.resize(size);
+        return result;
+    }
+
+    std::size_t find_icase_reference(const std::string_view str, const std::string_view sub)
+    {
+        const auto& it = std::search(str.cbegin(), str.cend(), sub.cbegin(), sub.cend(),
+                                     strpy::equal_char_icase<std::string_view::value_type>);
+
+        return it == str.cend() ? std::string_view::npos : static_cast<std::size_t>(it - str.cbegin());
+    }
+
+    std::size_t rfind_icase_reference(const std::string_view str, const std::string_view sub)
+    {
+        const auto& it = std::search(str.crbegin(), str.crend(), sub.crbegin(), sub.crend(),
+                                     strpy::equal_char_icase<std::string_view::value_type>);
+
+        return it == str.crend() ? std::string_view::npos : (static_cast<std::size_t>(str.crend() - it) - sub.size());
+    }
+
     TEST(FindTest, Basic)
     {
         ASSERT_EQ(strpy::find("Hello, world!", "Hello"), 0);
@@ -110,6 +144,24 @@ namespace
         ASSERT_EQ(strpy::find_icase(str, sub, 16, 25), std::string::npos);
     }
 
+    TEST(FindICaseTest, LongString)
+    {
+        for (const std::size_t size : {1U, 15U, 16U, 17U, 31U, 32U, 33U, 64U, 100U, 257U, 1000U}) {
+            for (const std::size_t pos : {0U, 1U, 7U, 15U, 16U, 31U, 32U, 50U, 99U, 256U, 999U}) {
+                auto str = make_haystack(size);
+
+                if (pos < size) {
+                    str.replace(pos, std::min<std::size_t>(6, size - pos), "nEeDlE");
+                    str.resize(size);
+                }
+
+                for (const std::string_view sub : {"needle", "n", "e", "NEEDL", "eedle", "xneedly", "q"}) {
+                    EXPECT_EQ(strpy::find_icase(str, sub), find_icase_reference(str, sub)) << str << " / " << sub;
+                }
+            }
+        }
+    }
+
     TEST(RFindTest, Basic)
     {
         ASSERT_EQ(strpy::rfind("Hello, world!", "Hello"), 0);
@@ -217,6 +269,24 @@ namespace
         ASSERT_EQ(strpy::rfind_icase(str, sub, 16, 25), std::string::npos);
     }
 
+    TEST(RFindICaseTest, LongString)
+    {
+        for (const std::size_t size : {1U, 15U, 16U, 17U, 31U, 32U, 33U, 64U, 100U, 257U, 1000U}) {
+            for (const std::size_t pos : {0U, 1U, 7U, 15U, 16U, 31U, 32U, 50U, 99U, 256U, 999U}) {
+                auto str = make_haystack(size);
+
+                if (pos < size) {
+                    str.replace(pos, std::min<std::size_t>(6, size - pos), "NeEdLe");
+                    str.resize(size);
+                }
+
+                for (const std::string_view sub : {"needle", "n", "e", "NEEDL", "eedle", "xneedly", "q"}) {
+                    EXPECT_EQ(strpy::rfind_icase(str, sub), rfind_icase_reference(str, sub)) << str << " / " << sub;
+                }
+            }
+        }
+    }
+
     TEST(FindFirstOfTest, Basic)
     {
         constexpr std::string_view str = "Hello, world!";
@@ -647,4 +717,73 @@ namespace
         EXPECT_EQ(strpy::find_last_not_of_icase(str, chars, 10), 43);
         EXPECT_EQ(strpy::find_last_not_of_icase(str, chars, 0, 10), 9);
     }
+
+    /** @brief Builds a long string that contains every byte value */
+    std::string make_byte_haystack()
+    {
+        std::string result{};
+
+        for (int round = 0; round < 5; ++round) {
+            for (int byte = 0; byte < 256; ++byte) {
+                result += static_cast<char>((byte * 7 + round) % 256);
+            }
+        }
+
+        return result;
+    }
+
+    TEST(FindOfCharSetTest, MatchesStringView)
+    {
+        const auto str = make_byte_haystack();
+
+        for (const std::string_view chars : {"", "a", "xyz", "\x80\xFF\x01", " \t\r\n", "0123456789abcdefABCDEF"}) {
+            const strpy::CharSet set{chars};
+
+            for (const std::size_t start : {0, 1, 17, 100, 640, 1279}) {
+                for (const std::size_t end : {std::size_t{0}, std::size_t{33}, std::size_t{700}, std::string::npos}) {
+                    EXPECT_EQ(strpy::find_first_of(str, set, start, end), strpy::find_first_of(str, chars, start, end));
+                    EXPECT_EQ(strpy::find_first_not_of(str, set, start, end),
+                              strpy::find_first_not_of(str, chars, start, end));
+                    EXPECT_EQ(strpy::find_last_of(str, set, start, end), strpy::find_last_of(str, chars, start, end));
+                    EXPECT_EQ(strpy::find_last_not_of(str, set, start, end),
+                              strpy::find_last_not_of(str, chars, start, end));
+                }
+            }
+        }
+    }
+
+    TEST(FindOfCharSetTest, Runs)
+    {
+        const std::string str = std::string(100, ' ') + "x" + std::string(100, ' ');
+        EXPECT_EQ(strpy::find_first_not_of(str, strpy::SPACE_SET), 100);
+        EXPECT_EQ(strpy::find_last_not_of(str, strpy::SPACE_SET), 100);
+        EXPECT_EQ(strpy::find_first_of(str, strpy::CharSet{"x"}, 50), 100);
+        EXPECT_EQ(strpy::find_last_of(str, strpy::CharSet{"x"}, 0, 150), 100);
+        EXPECT_EQ(strpy::find_first_of(str, strpy::CharSet{"y"}), std::string_view::npos);
+        EXPECT_EQ(strpy::find_first_not_of(std::string(100, ' '), strpy::SPACE_SET), std::string_view::npos);
+    }
+
+    TEST(FindOfICaseTest, LongString)
+    {
+        const auto str = make_haystack(1000) + "!" + make_haystack(1000);
+        const auto reference_first = [&str](const std::string_view chars, const bool member) {
+            for (std::size_t i = 0; i < str.size(); ++i) {
+                const auto found = std::any_of(chars.cbegin(), chars.cend(), [&](const char ch) {
+                    return strpy::equal_char_icase(str[i], ch);
+                });
+
+                if (found == member) {
+                    return i;
+                }
+            }
+
+            return std::string_view::npos;
+        };
+
+        EXPECT_EQ(strpy::find_first_of_icase(str, "!Q"), reference_first("!Q", true));
+        EXPECT_EQ(strpy::find_first_not_of_icase(str, "XNEDLYZQ"), 1000);
+        EXPECT_EQ(strpy::find_last_not_of_icase(str, "XNEDLYZQ"), 1000);
+        EXPECT_EQ(strpy::find_last_of_icase(str, "!"), 1000);
+        EXPECT_EQ(strpy::find_first_not_of_icase(str, "xnedlyzq!"), std::string_view::npos);
+    }
 }
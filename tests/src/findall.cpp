@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/findall.hpp"
+#include "stringpy/count.hpp"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::size_t> collect(const strpy::FindAllRange& range)
+    {
+        return {range.begin(), range.end()};
+    }
+
+    TEST(FindAllTest, NonOverlapping)
+    {
+        EXPECT_EQ(collect(strpy::find_all("Hello, world! Hello, world!", "world")), (std::vector<std::size_t>{7, 21}));
+        EXPECT_EQ(collect(strpy::find_all("aaaaa", "aa")), (std::vector<std::size_t>{0, 2}));
+        EXPECT_EQ(collect(strpy::find_all("abc", "abc")), (std::vector<std::size_t>{0}));
+        EXPECT_TRUE(strpy::find_all("abc", "abcd").empty());
+        EXPECT_TRUE(strpy::find_all("abc", "x").empty());
+        EXPECT_TRUE(strpy::find_all("", "x").empty());
+    }
+
+    TEST(FindAllTest, Overlapping)
+    {
+        EXPECT_EQ(collect(strpy::find_all("aaaaa", "aa", true)), (std::vector<std::size_t>{0, 1, 2, 3}));
+        EXPECT_EQ(collect(strpy::find_all("abababa", "aba", true)), (std::vector<std::size_t>{0, 2, 4}));
+        EXPECT_EQ(collect(strpy::find_all("abababa", "aba")), (std::vector<std::size_t>{0, 4}));
+    }
+
+    TEST(FindAllTest, EmptySubstring)
+    {
+        EXPECT_EQ(collect(strpy::find_all("abc", "")), (std::vector<std::size_t>{0, 1, 2, 3}));
+        EXPECT_EQ(collect(strpy::find_all("abc", "", true)), (std::vector<std::size_t>{0, 1, 2, 3}));
+        EXPECT_TRUE(strpy::find_all("", "").empty());
+    }
+
+    TEST(FindAllTest, MatchesCount)
+    {
+        std::string text{};
+
+        for (int i = 0; i < 100; ++i) {
+            text += "abcabcabd aaa The quick brown fox " + std::to_string(i);
+        }
+
+        for (const std::string_view sub : {"a", "aa", "abcabd", "fox", "FOX", "9", "", "missing"}) {
+            const auto range = strpy::find_all(text, sub);
+            EXPECT_EQ(static_cast<std::size_t>(std::distance(range.begin(), range.end())), strpy::count(text, sub))
+              << sub;
+
+            const auto range_icase = strpy::find_all_icase(text, sub);
+            EXPECT_EQ(static_cast<std::size_t>(std::distance(range_icase.begin(), range_icase.end())),
+                      strpy::count_icase(text, sub))
+              << sub;
+        }
+    }
+
+    TEST(FindAllICaseTest, Basic)
+    {
+        EXPECT_EQ(collect(strpy::find_all_icase("Hello, WORLD! Hello, world!", "World")),
+                  (std::vector<std::size_t>{7, 21}));
+        EXPECT_EQ(collect(strpy::find_all_icase("aAaAa", "AA", true)), (std::vector<std::size_t>{0, 1, 2, 3}));
+        EXPECT_EQ(collect(strpy::find_all_icase("aAaAa", "AA")), (std::vector<std::size_t>{0, 2}));
+        EXPECT_TRUE(strpy::find_all_icase("abc", "abd").empty());
+    }
+
+    TEST(FindAllTest, Iterator)
+    {
+        const auto range = strpy::find_all("a-b-c", "-");
+        auto it = range.begin();
+        const auto copy = it++;
+        EXPECT_EQ(*copy, 1);
+        EXPECT_EQ(*it, 3);
+        EXPECT_NE(it, copy);
+        EXPECT_EQ(++it, range.end());
+    }
+}
@@ -6,6 +6,58 @@
 #include "stringpy/format.hpp"
 #include "stringpy/const.hpp"
 #include <gtest/gtest.h>
+#include <array>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Point
+    {
+        int x{};
+        int y{};
+    };
+
+    struct Color
+    {
+        int red{};
+        int green{};
+        int blue{};
+
+        friend std::ostream& operator<<(std::ostream& os, const Color& color)
+        {
+            return os << "rgb(" << color.red << ", " << color.green << ", " << color.blue << ")";
+        }
+    };
+
+    enum class Level : unsigned char
+    {
+        debug = 10,
+        error = 40
+    };
+
+    enum Offset : int
+    {
+        before = -1
+    };
+}
+
+template <>
+struct strpy::formatter<Point>
+{
+    static void format(std::string& out, const Point& value)
+    {
+        strpy::format_append(out, "({}, {})", value.x, value.y);
+    }
+};
+
+template <>
+struct strpy::formatter<Color> : strpy::ostream_formatter
+{
+};
 
 namespace
 {
@@ -25,6 +77,16 @@ namespace
         EXPECT_EQ(strpy::to_string(3.140), "3.14");
     }
 
+    TEST(ToStringTest, Numbers)
+    {
+        EXPECT_EQ(strpy::to_string(100.0), "100");
+        EXPECT_EQ(strpy::to_string(0.000001), "1e-06");
+        EXPECT_EQ(strpy::to_string(1234567.0F), "1234567");
+        EXPECT_EQ(strpy::to_string(-9000000000LL), "-9000000000");
+        EXPECT_EQ(strpy::format("{} {}", 10.0, 0.125), "10 0.125");
+        EXPECT_EQ(strpy::formatted_size("{}", -100.5), 6U);
+    }
+
     TEST(ToStringTest, StringView)
     {
         constexpr std::string_view value{"hello"};
@@ -143,4 +205,126 @@ namespace
     {
         EXPECT_EQ(strpy::format("Only one placeholder: {}", 1, 2, 3), "Only one placeholder: 1");
     }
+
+    TEST(FormatterTest, CustomTypes)
+    {
+        constexpr Point point{1, -2};
+        constexpr Color color{255, 128, 0};
+
+        EXPECT_EQ(strpy::to_string(point), "(1, -2)");
+        EXPECT_EQ(strpy::format("{} is {}", point, color), "(1, -2) is rgb(255, 128, 0)");
+        EXPECT_EQ(strpy::format(STRPY_FMT("[{}]"), point), "[(1, -2)]");
+        EXPECT_EQ(strpy::formatted_size("{}", color), 16U);
+
+        std::vector<char> chars{};
+        strpy::format_to(std::back_inserter(chars), "{}!", point);
+        EXPECT_EQ(std::string(chars.cbegin(), chars.cend()), "(1, -2)!");
+    }
+
+    TEST(FormatterTest, LibraryTypes)
+    {
+        const std::optional<int> some{42};
+        const std::optional<Point> none{};
+        const std::vector<std::vector<int>> nested{{1, 2}, {}, {3}};
+        const std::vector<std::string_view> words{"a", "b"};
+        const std::array<Point, 2> points{{{0, 0}, {1, 1}}};
+        const std::vector<char> chars{'o', 'k'};
+
+        EXPECT_EQ(strpy::format("{} {}", some, none), "42 none");
+        EXPECT_EQ(strpy::format("{} {}", Level::error, before), "40 -1");
+        EXPECT_EQ(strpy::to_string(Level::debug), "10");
+        EXPECT_EQ(strpy::format("{} {} {}", nested, words, points), "[[1, 2], [], [3]] [a, b] [(0, 0), (1, 1)]");
+        EXPECT_EQ(strpy::format("{}", std::vector<double>{}), "[]");
+        EXPECT_EQ(strpy::to_string(chars), "ok");
+
+        std::string out{};
+        strpy::formatter<std::string_view>::format(out, "view");
+        EXPECT_EQ(out, "view");
+    }
+
+    TEST(CompiledFormatTest, MatchesRuntimeFormat)
+    {
+        constexpr std::string_view view{"view"};
+        const std::string str{"string"};
+        constexpr const char* c_str = "c string";
+        constexpr char* null_str = nullptr;
+
+        EXPECT_EQ(strpy::format(STRPY_FMT("{} + {} = {}"), 1, 2.5, 3.5F), strpy::format("{} + {} = {}", 1, 2.5, 3.5F));
+        EXPECT_EQ(strpy::format(STRPY_FMT("[{}|{}|{}|{}]"), view, str, c_str, null_str), "[view|string|c string|]");
+        EXPECT_EQ(strpy::format(STRPY_FMT("{}{}{}"), 'a', true, -42LL), "atrue-42");
+        EXPECT_EQ(strpy::format(STRPY_FMT("The set is {{}, {}, {}}."), 1, 2, 3), "The set is {1, 2, 3}.");
+        EXPECT_EQ(strpy::format(STRPY_FMT("No placeholders")), "No placeholders");
+        EXPECT_EQ(strpy::format(STRPY_FMT("")), "");
+        EXPECT_EQ(strpy::format(STRPY_FMT("{}"), "literal"), "literal");
+    }
+
+    TEST(CompiledFormatTest, Placeholders)
+    {
+        static_assert(strpy::detail::count_placeholders("{}{}") == 2);
+        static_assert(strpy::detail::count_placeholders("{{}}") == 1);
+        static_assert(strpy::detail::count_placeholders("{ }") == 0);
+
+        const auto str = STRPY_FMT("a{}bc{}");
+        using Format = strpy::detail::CompiledFormat<decltype(str)>;
+        static_assert(Format::COUNT == 2);
+        static_assert(Format::LITERAL_SIZE == 3);
+        static_assert(Format::segment(0) == "a");
+        static_assert(Format::segment(1) == "bc");
+        static_assert(Format::segment(2).empty());
+    }
+
+    TEST(FormatAppendTest, AppendsToBuffer)
+    {
+        std::string buffer{"log: "};
+
+        strpy::format_append(buffer, "{} + {} = {}", 1, 2.5, std::string_view{"3.5"});
+        EXPECT_EQ(buffer, "log: 1 + 2.5 = 3.5");
+
+        buffer.clear();
+        strpy::format_append(buffer, STRPY_FMT("[{}|{}]"), 'x', true);
+        strpy::format_append(buffer, "{} {}", "only one");
+        strpy::format_append(buffer, "{}", "extra", "ignored");
+        EXPECT_EQ(buffer, "[x|true]only one {}extra");
+    }
+
+    TEST(FormatToTest, WritesToIterator)
+    {
+        std::vector<char> chars{};
+        strpy::format_to(std::back_inserter(chars), "{}-{}", 'a', 42);
+        EXPECT_EQ(std::string(chars.cbegin(), chars.cend()), "a-42");
+
+        std::array<char, 16> array{};
+        const auto end = strpy::format_to(array.begin(), STRPY_FMT("{}{}"), "ab", nullptr);
+        EXPECT_EQ(std::string_view(array.data(), static_cast<std::size_t>(end - array.begin())), "ab");
+    }
+
+    TEST(FormattedSizeTest, MatchesFormat)
+    {
+        constexpr const char* null_str = nullptr;
+        const std::string str{"string"};
+
+        EXPECT_EQ(strpy::formatted_size("{} {} {} {}", str, 'c', false, null_str),
+                  strpy::format("{} {} {} {}", str, 'c', false, null_str).size());
+        EXPECT_EQ(strpy::formatted_size("{} = {}", -12345, 0.25), strpy::format("{} = {}", -12345, 0.25).size());
+        EXPECT_EQ(strpy::formatted_size("{} {}", "one"), strpy::format("{} {}", "one").size());
+        EXPECT_EQ(strpy::formatted_size("{}", 1, 2, 3), 1U);
+        EXPECT_EQ(strpy::formatted_size(STRPY_FMT("a{}b{}"), true, "xyz"), 9U);
+    }
+
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+    TEST(CompiledFormatTest, FixedString)
+    {
+        EXPECT_EQ(strpy::format<"{} + {} = {}">(1, 2, 3), "1 + 2 = 3");
+        EXPECT_EQ(strpy::format<"Hello, {}!">(std::string_view{"world"}), "Hello, world!");
+        EXPECT_EQ(strpy::format<"none">(), "none");
+
+        std::string buffer{};
+        strpy::format_append<"{}:{}">(buffer, 1, 2);
+        EXPECT_EQ(buffer, "1:2");
+        EXPECT_EQ(strpy::formatted_size<"{}:{}">(1, 2), 3U);
+
+        std::array<char, 8> array{};
+        EXPECT_EQ(strpy::format_to<"x{}">(array.begin(), 'y') - array.begin(), 2);
+    }
+#endif
 }
@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/formattemplate.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    TEST(FormatTemplateTest, Positional)
+    {
+        const strpy::FormatTemplate automatic{"{} + {} = {}"};
+        EXPECT_EQ(automatic.render(1, 2.5, "3.5"), "1 + 2.5 = 3.5");
+        EXPECT_EQ(automatic.render(1, 2, 3, 4), "1 + 2 = 3");
+        EXPECT_EQ(automatic.render(1), "1 + {} = {}");
+
+        const strpy::FormatTemplate indexed{"{1}{0}{1}"};
+        EXPECT_EQ(indexed.render('a', 'b'), "bab");
+        EXPECT_EQ(indexed.render('a'), "{1}a{1}");
+
+        std::string out{"> "};
+        indexed.render_append(out, std::string_view{"x"}, std::string{"y"});
+        EXPECT_EQ(out, "> yxy");
+        EXPECT_EQ(indexed.text(), "{1}{0}{1}");
+    }
+
+    TEST(FormatTemplateTest, Named)
+    {
+        const strpy::FormatTemplate tpl{"{user} logged in from {ip} ({0} ms)"};
+        const std::string user{"alice"};
+
+        EXPECT_EQ(tpl.render(strpy::arg("ip", "10.0.0.1"), 12, strpy::arg("user", user)),
+                  "alice logged in from 10.0.0.1 (12 ms)");
+        EXPECT_EQ(tpl.render(strpy::arg("user", user)), "alice logged in from {ip} ({0} ms)");
+
+        const std::map<std::string, int> ordered{{"user", 1}, {"ip", 2}};
+        EXPECT_EQ(tpl.render_map(ordered), "1 logged in from 2 ({0} ms)");
+
+        const std::unordered_map<std::string, std::string> unordered{{"user", "bob"}};
+        EXPECT_EQ(tpl.render_map(unordered), "bob logged in from {ip} ({0} ms)");
+    }
+
+    TEST(FormatTemplateTest, Braces)
+    {
+        EXPECT_EQ(strpy::FormatTemplate{"{{}} {{{}}}"}.render(1), "{} {1}");
+        EXPECT_EQ(strpy::FormatTemplate{"{ } {a-b} {0x} { {}"}.render(1), "{ } {a-b} {0x} { 1");
+        EXPECT_EQ(strpy::FormatTemplate{"} {"}.render(1), "} {");
+        EXPECT_EQ(strpy::FormatTemplate{"{1234567890}"}.render(1), "{1234567890}");
+        EXPECT_EQ(strpy::FormatTemplate{""}.render(1), "");
+        EXPECT_EQ(strpy::FormatTemplate{}.render(), "");
+    }
+
+    TEST(FormatTemplateTest, MatchesFormat)
+    {
+        for (const std::string_view text : {"{}", "a{}b{}c", "{}{}{}", "no placeholders", "{} {}"}) {
+            EXPECT_EQ(strpy::FormatTemplate{text}.render(1, "two", 3.5), strpy::format(text, 1, "two", 3.5)) << text;
+        }
+    }
+
+    TEST(FormatTemplateCacheTest, EvictsLeastRecentlyUsed)
+    {
+        strpy::FormatTemplateCache cache{2};
+        EXPECT_EQ(cache.capacity(), 2U);
+
+        const auto first = cache.get("{} first");
+        const auto second = cache.get("{} second");
+        EXPECT_EQ(cache.get("{} first"), first);
+
+        // The second template is the least recently used one
+        const auto third = cache.get("{} third");
+        EXPECT_EQ(cache.size(), 2U);
+        EXPECT_EQ(cache.get("{} first"), first);
+        EXPECT_NE(cache.get("{} second"), second);
+
+        // An evicted template stays valid
+        EXPECT_EQ(second->render(2), "2 second");
+        EXPECT_EQ(third->render(3), "3 third");
+
+        cache.clear();
+        EXPECT_EQ(cache.size(), 0U);
+
+        strpy::FormatTemplateCache disabled{0};
+        EXPECT_EQ(disabled.get("{}")->render(1), "1");
+        EXPECT_EQ(disabled.size(), 0U);
+    }
+
+    TEST(FormatTemplateCacheTest, Threads)
+    {
+        strpy::FormatTemplateCache cache{4};
+        std::vector<std::thread> threads{};
+        std::vector<std::size_t> failures(4);
+
+        for (std::size_t t = 0; t < failures.size(); ++t) {
+            threads.emplace_back([&cache, &failures, t] {
+                for (std::size_t i = 0; i < 1000; ++i) {
+                    const auto key = (i + t) % 6;
+                    const auto text = "{} #" + std::to_string(key);
+
+                    if (cache.get(text)->render(t) != (std::to_string(t) + " #" + std::to_string(key))) {
+                        ++failures[t];
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(failures, std::vector<std::size_t>(4));
+        EXPECT_LE(cache.size(), 4U);
+    }
+}
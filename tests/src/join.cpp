@@ -21,7 +21,15 @@ namespace
             return os;
         }
     };
+}
+
+template <>
+struct strpy::formatter<Point> : strpy::ostream_formatter
+{
+};
 
+namespace
+{
     TEST(JoinTest, EmptyContainer)
     {
         const std::vector<std::string> strings{};
@@ -66,6 +74,10 @@ namespace
         const std::vector<double> doubles = {1.1, 2.2, 3.3};
         delimiter = " - ";
         EXPECT_EQ(strpy::join(doubles, delimiter), "1.1 - 2.2 - 3.3");
+
+        const std::vector<double> rounded = {100.0, 2.5, 1e-5};
+        delimiter = ", ";
+        EXPECT_EQ(strpy::join(rounded, delimiter), "100, 2.5, 1e-05");
     }
 
     TEST(JoinTest, CustomType)
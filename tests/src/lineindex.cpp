@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/lineindex.hpp"
+#include "stringpy/splitlines.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /** @brief Checks every line and every offset of an index against split_lines */
+    void expect_matches(const strpy::LineIndex& index, const std::string_view text)
+    {
+        const auto lines = strpy::split_lines<std::string_view>(text);
+        const auto lines_with_ends = strpy::split_lines<std::string_view>(text, true);
+
+        ASSERT_EQ(index.size(), lines.size());
+        EXPECT_EQ(index.text(), text);
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            EXPECT_EQ(index.line(i), lines[i]) << i;
+            EXPECT_EQ(index.line(i, true), lines_with_ends[i]) << i;
+            EXPECT_EQ(index.line_start(i), offset) << i;
+
+            for (const auto end = offset + lines_with_ends[i].size(); offset < end; ++offset) {
+                EXPECT_EQ(index.line_of(offset), i) << offset;
+            }
+        }
+
+        EXPECT_EQ(index.line_of(text.size()), std::string_view::npos);
+    }
+
+    std::string make_text()
+    {
+        std::string result{};
+
+        for (std::size_t i = 0; i < 300; ++i) {
+            result += std::string(i % 13, static_cast<char>('a' + (i % 26)));
+            result += (i % 4 == 0) ? "\r\n" : ((i % 4 == 1) ? "\r" : "\n");
+        }
+
+        return result + "tail";
+    }
+
+    TEST(LineIndexTest, MatchesSplitLines)
+    {
+        const auto text = make_text();
+
+        for (const std::string_view str :
+             {std::string_view{text}, std::string_view{text}.substr(0, text.size() - 4), std::string_view{},
+              std::string_view{"\n"}, std::string_view{"\r\n\r\n"}, std::string_view{"single"}}) {
+            const strpy::LineIndex index{str};
+            expect_matches(index, str);
+        }
+
+        const strpy::LineIndex empty{};
+        EXPECT_TRUE(empty.empty());
+        EXPECT_EQ(empty.size(), 0U);
+        EXPECT_EQ(empty.line_of(0), std::string_view::npos);
+    }
+
+    TEST(LineIndexTest, Append)
+    {
+        const auto text = make_text();
+
+        for (const std::size_t chunk_size : {1, 2, 3, 7, 64, 1000}) {
+            strpy::LineIndex index{};
+            std::string grown{};
+
+            for (std::size_t pos = 0; pos < text.size(); pos += chunk_size) {
+                // The growing text may be reallocated, the index only keeps offsets
+                grown += text.substr(pos, chunk_size);
+                index.append(grown);
+                expect_matches(index, grown);
+            }
+        }
+    }
+
+    TEST(LineIndexTest, CrLfAcrossAppend)
+    {
+        std::string text = "first\r";
+        strpy::LineIndex index{text};
+
+        ASSERT_EQ(index.size(), 1U);
+        EXPECT_EQ(index.line(0, true), "first\r");
+
+        text += "\nsecond";
+        index.append(text);
+
+        ASSERT_EQ(index.size(), 2U);
+        EXPECT_EQ(index.line(0, true), "first\r\n");
+        EXPECT_EQ(index.line(0), "first");
+        EXPECT_EQ(index.line(1), "second");
+        EXPECT_EQ(index.line_of(6), 0U);
+        EXPECT_EQ(index.line_of(7), 1U);
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/linereader.hpp"
+#include "stringpy/splitlines.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+  #include <unistd.h>
+#endif
+
+namespace
+{
+    /** @brief Reads all lines, joining the parts of the lines that do not fit into the buffer */
+    std::vector<std::string> read_all(strpy::LineReader& reader)
+    {
+        std::vector<std::string> result{};
+        std::string_view line{};
+        auto continued = false;
+
+        while (reader.next(line)) {
+            if (continued) {
+                result.back() += line;
+            }
+            else {
+                result.emplace_back(line);
+            }
+
+            continued = reader.partial();
+        }
+
+        return result;
+    }
+
+    std::vector<std::string> read_stream(const std::string& data, const bool keep_ends, const std::size_t buffer_size)
+    {
+        std::istringstream stream{data};
+        strpy::LineReader reader{stream, keep_ends, buffer_size};
+
+        return read_all(reader);
+    }
+
+    TEST(LineReaderTest, MatchesSplitLines)
+    {
+        std::string text{};
+
+        for (std::size_t i = 0; i < 60; ++i) {
+            text += std::string(i % 11, static_cast<char>('a' + (i % 26))) + ((i % 3 == 0) ? "\r\n" : "\n");
+
+            if (i % 7 == 0) {
+                text += "\r\r\n\n";
+            }
+        }
+
+        for (const auto& data : {text, text + "tail", text + "\r", std::string{}, std::string{"\r\n"}}) {
+            for (const auto keep_ends : {false, true}) {
+                const auto expected = strpy::split_lines(data, keep_ends);
+
+                for (std::size_t buffer_size = 1; buffer_size <= 40; ++buffer_size) {
+                    EXPECT_EQ(read_stream(data, keep_ends, buffer_size), expected) << buffer_size;
+                }
+
+                EXPECT_EQ(read_stream(data, keep_ends, strpy::LineReader::DEFAULT_BUFFER_SIZE), expected);
+            }
+        }
+    }
+
+    TEST(LineReaderTest, Partial)
+    {
+        std::istringstream stream{"abcdefghij\r\nxy"};
+        strpy::LineReader reader{stream, true, 4};
+        std::string_view line{};
+
+        ASSERT_TRUE(reader.next(line));
+        EXPECT_EQ(line, "abcd");
+        EXPECT_TRUE(reader.partial());
+        ASSERT_TRUE(reader.next(line));
+        EXPECT_EQ(line, "efgh");
+        EXPECT_TRUE(reader.partial());
+        ASSERT_TRUE(reader.next(line));
+        EXPECT_EQ(line, "ij\r\n");
+        EXPECT_FALSE(reader.partial());
+        ASSERT_TRUE(reader.next(line));
+        EXPECT_EQ(line, "xy");
+        EXPECT_FALSE(reader.partial());
+        EXPECT_FALSE(reader.next(line));
+        EXPECT_FALSE(reader.error());
+    }
+
+#ifndef _WIN32
+    TEST(LineReaderTest, Move)
+    {
+        std::istringstream stream{"one\ntwo\nthree"};
+        strpy::LineReader reader{stream, false, 8};
+        std::string_view line{};
+
+        ASSERT_TRUE(reader.next(line));
+        EXPECT_EQ(line, "one");
+
+        // The moved reader continues after the lines read so far
+        auto moved = std::move(reader);
+        EXPECT_EQ(read_all(moved), (std::vector<std::string>{"two", "three"}));
+        static_assert(!std::is_copy_constructible_v<strpy::LineReader>);
+    }
+
+    TEST(LineReaderTest, FileDescriptor)
+    {
+        const std::string data = "first\r\nsecond\rthird\n\nlast";
+        int fds[2] = {-1, -1};
+
+        ASSERT_EQ(::pipe(fds), 0);
+        ASSERT_EQ(::write(fds[1], data.data(), data.size()), static_cast<ssize_t>(data.size()));
+        ::close(fds[1]);
+
+        strpy::LineReader reader{fds[0], false, 8};
+        EXPECT_EQ(read_all(reader), strpy::split_lines(data));
+        EXPECT_FALSE(reader.error());
+        ::close(fds[0]);
+
+        strpy::LineReader invalid{-1};
+        std::string_view line{};
+
+        EXPECT_FALSE(invalid.next(line));
+        EXPECT_EQ(invalid.error(), std::errc::bad_file_descriptor);
+    }
+#endif
+}
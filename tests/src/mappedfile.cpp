@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/mappedfile.hpp"
+#include "stringpy/count.hpp"
+#include "stringpy/findall.hpp"
+#include "stringpy/splitlines.hpp"
+#include "stringpy/splitview.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+  #include <process.h>
+#else
+  #include <unistd.h>
+#endif
+
+namespace
+{
+    /** @brief Returns the identifier of the test process, which keeps the files of parallel test runs apart */
+    std::string process_id()
+    {
+#ifdef _WIN32
+        return std::to_string(_getpid());
+#else
+        return std::to_string(getpid());
+#endif
+    }
+
+    /** @brief Writes a temporary file and removes it when it goes out of scope */
+    class TempFile
+    {
+    public:
+        TempFile(const std::string& name, const std::string& contents) :
+            path_(testing::TempDir() + process_id() + "_" + name)
+        {
+            std::ofstream file{path_, std::ios::binary};
+            file << contents;
+        }
+
+        TempFile(const TempFile&) = delete;
+        TempFile& operator=(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            static_cast<void>(std::remove(path_.c_str()));
+        }
+
+        [[nodiscard]] const std::string& path() const
+        {
+            return path_;
+        }
+
+    private:
+        std::string path_;
+    };
+
+    std::string make_contents()
+    {
+        std::string result{};
+
+        for (int i = 0; i < 5000; ++i) {
+            result += "line " + std::to_string(i) + ",field\r\n";
+        }
+
+        return result + "last line";
+    }
+
+    TEST(MappedFileTest, Contents)
+    {
+        const auto contents = make_contents();
+        const TempFile file{"stringpy_mappedfile_contents.txt", contents};
+
+        for (const auto options :
+             {strpy::MappedFileOptions::none, strpy::MappedFileOptions::sequential,
+              strpy::MappedFileOptions::sequential | strpy::MappedFileOptions::huge_pages,
+              strpy::MappedFileOptions::no_map}) {
+            std::error_code error{};
+            const auto mapped = strpy::make_mapped_file(file.path(), error, options);
+
+            ASSERT_FALSE(error) << error.message();
+            EXPECT_EQ(mapped.view(), contents);
+            EXPECT_EQ(mapped.size(), contents.size());
+            EXPECT_FALSE(mapped.empty());
+
+            if (options == strpy::MappedFileOptions::no_map) {
+                EXPECT_FALSE(mapped.mapped());
+            }
+        }
+    }
+
+    TEST(MappedFileTest, StringFunctions)
+    {
+        const auto contents = make_contents();
+        const TempFile file{"stringpy_mappedfile_functions.txt", contents};
+        std::error_code error{};
+        const auto mapped = strpy::make_mapped_file(file.path(), error);
+
+        ASSERT_FALSE(error) << error.message();
+        EXPECT_EQ(strpy::split_lines(mapped), strpy::split_lines(contents));
+        EXPECT_EQ(strpy::count(mapped, "field"), 5000U);
+
+        std::vector<std::size_t> positions{};
+
+        for (const auto pos : strpy::find_all(mapped, "line 4999")) {
+            positions.push_back(pos);
+        }
+
+        EXPECT_EQ(positions, (std::vector<std::size_t>{contents.find("line 4999")}));
+
+        std::size_t lines = 0;
+
+        for (const auto line : strpy::lines_view(mapped)) {
+            EXPECT_TRUE((line.substr(0, 5) == "line ") || (line == "last line")) << line;
+            ++lines;
+        }
+
+        EXPECT_EQ(lines, 5001U);
+        EXPECT_EQ(*strpy::split_view(mapped, ',').begin(), "line 0");
+    }
+
+    TEST(MappedFileTest, Empty)
+    {
+        const TempFile file{"stringpy_mappedfile_empty.txt", ""};
+        std::error_code error{};
+        const auto mapped = strpy::make_mapped_file(file.path(), error);
+
+        EXPECT_FALSE(error) << error.message();
+        EXPECT_TRUE(mapped.empty());
+        EXPECT_FALSE(mapped.mapped());
+        EXPECT_TRUE(strpy::MappedFile{}.view().empty());
+
+#ifdef __linux__
+        // The files of /proc report no size but have contents
+        const auto status = strpy::make_mapped_file("/proc/self/status", error);
+
+        EXPECT_FALSE(error) << error.message();
+        EXPECT_FALSE(status.mapped());
+        EXPECT_EQ(status.view().substr(0, 5), "Name:");
+#endif
+    }
+
+    TEST(MappedFileTest, Errors)
+    {
+        std::error_code error{};
+        const auto missing = strpy::make_mapped_file(testing::TempDir() + "stringpy_mappedfile_missing.txt", error);
+
+        EXPECT_EQ(error, std::errc::no_such_file_or_directory);
+        EXPECT_TRUE(missing.empty());
+
+        const TempFile file{"stringpy_mappedfile_errors.txt", "contents"};
+        const auto mapped = strpy::make_mapped_file(file.path(), error);
+
+        EXPECT_FALSE(error) << error.message();
+        EXPECT_EQ(mapped.view(), "contents");
+    }
+
+    TEST(MappedFileTest, Move)
+    {
+        const TempFile file{"stringpy_mappedfile_move.txt", "moved contents"};
+
+        for (const auto options : {strpy::MappedFileOptions::none, strpy::MappedFileOptions::no_map}) {
+            std::error_code error{};
+            auto mapped = strpy::make_mapped_file(file.path(), error, options);
+            const auto* const data = mapped.data();
+
+            strpy::MappedFile moved{std::move(mapped)};
+            EXPECT_EQ(moved.view(), "moved contents");
+            EXPECT_EQ(moved.data(), data);
+            EXPECT_TRUE(mapped.empty()); // NOLINT(bugprone-use-after-move)
+
+            mapped = std::move(moved);
+            EXPECT_EQ(mapped.view(), "moved contents");
+            EXPECT_FALSE(mapped.mapped() && moved.mapped());
+        }
+    }
+}
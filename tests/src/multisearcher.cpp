@@ -0,0 +1,258 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/multisearcher.hpp"
+#include "stringpy/count.hpp"
+#include "stringpy/find.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+
+namespace
+{
+    const std::vector<std::string_view> PATTERNS = {"he", "she", "his", "hers", "s", "ushers", "rs", "he"};
+
+    /** @brief Finds the leftmost match by trying every pattern at every position */
+    strpy::Match naive_find_any(const std::vector<std::string>& patterns, const std::string_view str,
+                                const std::size_t start, const strpy::MatchKind kind)
+    {
+        for (auto pos = start; pos < str.size(); ++pos) {
+            strpy::Match best{};
+
+            for (std::size_t i = 0; i < patterns.size(); ++i) {
+                const auto& pattern = patterns[i];
+
+                if (pattern.empty() || (str.substr(pos, pattern.size()) != pattern)) {
+                    continue;
+                }
+
+                if ((std::string_view::npos == best.pattern) ||
+                    ((strpy::MatchKind::leftmost_longest == kind) && (pattern.size() > best.length))) {
+                    best = {pos, pattern.size(), i};
+                }
+            }
+
+            if (best.pattern != std::string_view::npos) {
+                return best;
+            }
+        }
+
+        return {};
+    }
+
+    TEST(MultiSearcherTest, FindAny)
+    {
+        const auto searcher = strpy::make_multi_searcher(PATTERNS);
+        auto match = searcher.find_any("ushers");
+        EXPECT_EQ(match.position, 0);
+        EXPECT_EQ(match.length, 6);
+        EXPECT_EQ(match.pattern, 5);
+
+        match = searcher.find_any("ushers", 1);
+        EXPECT_EQ(match.position, 1);
+        EXPECT_EQ(match.pattern, 1);
+
+        match = searcher.find_any("ushers", 2);
+        EXPECT_EQ(match.position, 2);
+        EXPECT_EQ(match.pattern, 0);
+
+        match = searcher.find_any("ushers", 2, strpy::MatchKind::leftmost_longest);
+        EXPECT_EQ(match.position, 2);
+        EXPECT_EQ(match.pattern, 3);
+
+        match = searcher.find_any("abc");
+        EXPECT_EQ(match.position, std::string_view::npos);
+        EXPECT_EQ(searcher.find_any("ushers", 100).position, std::string_view::npos);
+    }
+
+    TEST(MultiSearcherTest, CountEach)
+    {
+        const std::string str = "she sells seashells, he hears ushers; his hers. sss";
+        const auto searcher = strpy::make_multi_searcher(PATTERNS);
+        const auto result = searcher.count_each(str);
+        ASSERT_EQ(result.size(), PATTERNS.size());
+
+        for (std::size_t i = 0; i < PATTERNS.size(); ++i) {
+            EXPECT_EQ(result[i], strpy::count(str, PATTERNS[i])) << PATTERNS[i];
+        }
+    }
+
+    TEST(MultiSearcherTest, CountEachOverlapping)
+    {
+        const std::vector<std::string_view> patterns = {"aa", "aaa", "a", ""};
+        const auto searcher = strpy::make_multi_searcher(patterns);
+        const auto result = searcher.count_each("aaaaaaa");
+
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            EXPECT_EQ(result[i], strpy::count("aaaaaaa", patterns[i])) << patterns[i];
+        }
+    }
+
+    TEST(MultiSearcherTest, FindAllMatches)
+    {
+        const auto searcher = strpy::make_multi_searcher(std::vector<std::string>{"ab", "b", "abc"});
+        const auto matches = searcher.find_all_matches("abcab");
+        ASSERT_EQ(matches.size(), 5);
+        EXPECT_EQ(matches[0].position, 0);
+        EXPECT_EQ(matches[0].pattern, 0);
+        EXPECT_EQ(matches[1].position, 0);
+        EXPECT_EQ(matches[1].pattern, 2);
+        EXPECT_EQ(matches[2].position, 1);
+        EXPECT_EQ(matches[2].pattern, 1);
+        EXPECT_EQ(matches[3].position, 3);
+        EXPECT_EQ(matches[4].position, 4);
+    }
+
+    TEST(MultiSearcherTest, ReplaceMany)
+    {
+        const auto searcher = strpy::make_multi_searcher({"cat", "category", "dog"});
+        EXPECT_EQ(searcher.replace_many("cat, dog, category", {"feline", "class", "canine"}),
+                  "feline, canine, felineegory");
+        EXPECT_EQ(searcher.replace_many("cat, dog, category", {"feline", "class", "canine"},
+                                        strpy::MatchKind::leftmost_longest),
+                  "feline, canine, class");
+        EXPECT_EQ(searcher.replace_many("cat, dog", {"feline"}), "feline, ");
+        EXPECT_EQ(searcher.replace_many("", {"a", "b", "c"}), "");
+        EXPECT_EQ(searcher.replace_many("no matches", {"a", "b", "c"}), "no matches");
+    }
+
+    TEST(MultiSearcherTest, ReplaceManyIsSinglePass)
+    {
+        const auto searcher = strpy::make_multi_searcher({"a", "b"});
+        EXPECT_EQ(searcher.replace_many("aabba", std::vector<std::string>{"b", "a"}), "bbaab");
+    }
+
+    TEST(MultiSearcherTest, LeftmostMatchesNaive)
+    {
+        std::mt19937 engine{42};
+        std::uniform_int_distribution<std::size_t> letter{0, 2};
+        std::uniform_int_distribution<std::size_t> length{0, 5};
+        const auto random_string = [&](const std::size_t size) {
+            std::string result{};
+
+            for (std::size_t i = 0; i < size; ++i) {
+                result.push_back(static_cast<char>('a' + letter(engine)));
+            }
+
+            return result;
+        };
+
+        for (int round = 0; round < 300; ++round) {
+            std::vector<std::string> patterns{};
+
+            for (std::size_t i = length(engine) + 1; i > 0; --i) {
+                patterns.push_back(random_string(length(engine)));
+            }
+
+            const auto searcher = strpy::make_multi_searcher(patterns);
+            const auto str = random_string(40);
+
+            for (const auto kind : {strpy::MatchKind::first, strpy::MatchKind::leftmost_longest}) {
+                std::string expected{};
+                std::size_t pos = 0;
+
+                for (auto match = naive_find_any(patterns, str, 0, kind); match.pattern != std::string_view::npos;
+                     match = naive_find_any(patterns, str, pos, kind)) {
+                    const auto actual = searcher.find_any(str, pos, kind);
+                    EXPECT_EQ(actual.position, match.position) << str;
+                    EXPECT_EQ(actual.length, match.length) << str;
+                    EXPECT_EQ(actual.pattern, match.pattern) << str;
+
+                    expected.append(str, pos, match.position - pos).append(std::to_string(match.pattern));
+                    pos = match.position + match.length;
+                }
+
+                expected.append(str, pos);
+                EXPECT_EQ(searcher.find_any(str, pos, kind).position, std::string_view::npos) << str;
+
+                std::vector<std::string> replacements{};
+
+                for (std::size_t i = 0; i < patterns.size(); ++i) {
+                    replacements.push_back(std::to_string(i));
+                }
+
+                EXPECT_EQ(searcher.replace_many(str, replacements, kind), expected) << str;
+            }
+        }
+    }
+
+    TEST(MultiSearcherTest, ReplaceManyLongPattern)
+    {
+        const std::string long_pattern(512, 'x');
+        const auto searcher = strpy::make_multi_searcher({"a", "ab", long_pattern, "x"});
+        std::string str{};
+
+        for (int i = 0; i < 100; ++i) {
+            str += "ab x ";
+        }
+
+        str += long_pattern + "x";
+        std::string expected{};
+
+        for (int i = 0; i < 100; ++i) {
+            expected += "1 3 ";
+        }
+
+        EXPECT_EQ(searcher.replace_many(str, {"0", "1", "2", "3"}, strpy::MatchKind::leftmost_longest),
+                  expected + "23");
+        EXPECT_EQ(searcher.replace_many(str, {"0", "1", "2", "3"}).substr(0, 8), "0b 3 0b ");
+    }
+
+    TEST(MultiSearcherTest, Empty)
+    {
+        const strpy::MultiSearcher searcher{};
+        EXPECT_EQ(searcher.size(), 0);
+        EXPECT_EQ(searcher.find_any("abc").position, std::string_view::npos);
+        EXPECT_TRUE(searcher.count_each("abc").empty());
+        EXPECT_TRUE(searcher.find_all_matches("abc").empty());
+        EXPECT_EQ(searcher.replace_many("abc", std::vector<std::string_view>{}), "abc");
+    }
+
+    TEST(MultiSearcherICaseTest, Basic)
+    {
+        const std::string str = "She Sells SeaShells, HE hears USHERS; His HERS.";
+        const auto searcher = strpy::make_multi_searcher_icase(PATTERNS);
+        EXPECT_TRUE(searcher.icase());
+        EXPECT_EQ(searcher.pattern(1), "she");
+
+        const auto result = searcher.count_each(str);
+
+        for (std::size_t i = 0; i < PATTERNS.size(); ++i) {
+            EXPECT_EQ(result[i], strpy::count_icase(str, PATTERNS[i])) << PATTERNS[i];
+        }
+
+        const auto match = searcher.find_any(str);
+        EXPECT_EQ(match.position, 0);
+        EXPECT_EQ(match.pattern, 1);
+        EXPECT_EQ(searcher.replace_many("SHE and he", {"x", "y"}), "y and x");
+    }
+
+    TEST(MultiSearcherTest, ManyPatterns)
+    {
+        std::vector<std::string> patterns{};
+        std::string str{};
+
+        for (int i = 0; i < 300; ++i) {
+            patterns.push_back("key" + std::to_string(i) + "=");
+            str += "key" + std::to_string(i * 7) + "=value; ";
+        }
+
+        const auto searcher = strpy::make_multi_searcher(patterns);
+        const auto result = searcher.count_each(str);
+
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            EXPECT_EQ(result[i], strpy::count(str, patterns[i])) << patterns[i];
+        }
+
+        std::size_t first = std::string_view::npos;
+
+        for (const auto& pattern : patterns) {
+            first = std::min(first, strpy::find(str, pattern, 10));
+        }
+
+        EXPECT_EQ(searcher.find_any(str, 10).position, first);
+    }
+}
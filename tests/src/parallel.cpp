@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/parallel.hpp"
+#include "stringpy/count.hpp"
+#include "stringpy/find.hpp"
+#include "stringpy/splitlines.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /** @brief Runs the tasks one by one on the calling thread, in reverse order */
+    void reverse_executor(const std::size_t task_count, const strpy::par::Task& task)
+    {
+        for (auto index = task_count; index != 0; --index) {
+            task(index - 1);
+        }
+    }
+
+    /** @brief Concatenates the substrings of the shards */
+    std::vector<std::string> flatten(const std::vector<strpy::SplitResult>& shards)
+    {
+        std::vector<std::string> result{};
+
+        for (const auto& shard : shards) {
+            result.insert(result.end(), shard.begin(), shard.end());
+        }
+
+        return result;
+    }
+
+    std::string repeat(const std::string_view str, const std::size_t times)
+    {
+        std::string result{};
+        result.reserve(str.size() * times);
+
+        for (std::size_t i = 0; i < times; ++i) {
+            result += str;
+        }
+
+        return result;
+    }
+
+    TEST(ParallelCountTest, MatchesSequential)
+    {
+        const auto executor = strpy::par::make_thread_executor(4);
+        const auto text = repeat("abcabcabd aaaa ", 701) + "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+
+        for (const std::string_view sub : {"a", "aa", "aaa", "abcabd", "abcabcabd", "d a", "x", ""}) {
+            for (const std::size_t chunks : {2, 3, 7, 16, 100, 1000}) {
+                EXPECT_EQ(strpy::par::count(text, sub, executor, chunks), strpy::count(text, sub))
+                  << sub << ' ' << chunks;
+                EXPECT_EQ(strpy::par::count(text, sub, reverse_executor, chunks), strpy::count(text, sub))
+                  << sub << ' ' << chunks;
+            }
+        }
+    }
+
+    TEST(ParallelCountTest, PeriodicText)
+    {
+        const auto text = std::string(10001, 'a');
+        const auto abab = repeat("ab", 5000);
+
+        for (const std::size_t chunks : {2, 3, 9, 64, 333}) {
+            EXPECT_EQ(strpy::par::count(text, "aa", reverse_executor, chunks), 5000);
+            EXPECT_EQ(strpy::par::count(text, "aaa", reverse_executor, chunks), 3333);
+            EXPECT_EQ(strpy::par::count(abab, "abab", reverse_executor, chunks), 2500);
+            EXPECT_EQ(strpy::par::count(abab, "bab", reverse_executor, chunks), strpy::count(abab, "bab"));
+        }
+    }
+
+    TEST(ParallelCountTest, RandomText)
+    {
+        std::mt19937 engine{7};
+        std::uniform_int_distribution<std::size_t> letter{0, 1};
+        const auto random_string = [&](const std::size_t size) {
+            std::string result{};
+
+            for (std::size_t i = 0; i < size; ++i) {
+                result.push_back(static_cast<char>('a' + letter(engine)));
+            }
+
+            return result;
+        };
+
+        for (int round = 0; round < 200; ++round) {
+            const auto text = random_string(300) + std::string(100, 'a') + random_string(300);
+            const auto sub = random_string(1 + (static_cast<std::size_t>(round) % 6));
+
+            for (const std::size_t chunks : {2, 5, 13, 50}) {
+                EXPECT_EQ(strpy::par::count(text, sub, reverse_executor, chunks), strpy::count(text, sub))
+                  << text << ' ' << sub << ' ' << chunks;
+            }
+        }
+    }
+
+    TEST(ParallelCountTest, ThreadCount)
+    {
+        const auto text = repeat("The quick brown fox jumps over the lazy dog. ", 50000);
+        EXPECT_EQ(strpy::par::count(text, "fox", 4), 50000);
+        EXPECT_EQ(strpy::par::count(text, "fox", 1), 50000);
+        EXPECT_EQ(strpy::par::count(text, "dog. The", 0), 49999);
+        EXPECT_EQ(strpy::par::count("", "a", 4), 0);
+        EXPECT_EQ(strpy::par::count("abc", "", 4), 4);
+    }
+
+    TEST(ParallelFindTest, MatchesSequential)
+    {
+        const auto executor = strpy::par::make_thread_executor(3);
+        const auto text = repeat("abcabcabd ", 1000) + "needle" + repeat("abcabcabd ", 1000) + "needle";
+
+        for (const std::string_view sub : {"needle", "abd", "d a", "bd needle", "missing", "", "e"}) {
+            for (const std::size_t chunks : {2, 5, 64, 1000}) {
+                EXPECT_EQ(strpy::par::find(text, sub, executor, chunks), strpy::find(text, sub)) << sub << ' ' << chunks;
+                EXPECT_EQ(strpy::par::find(text, sub, reverse_executor, chunks), strpy::find(text, sub))
+                  << sub << ' ' << chunks;
+            }
+        }
+    }
+
+    TEST(ParallelFindTest, ThreadCount)
+    {
+        auto text = std::string(3000000, 'x');
+        EXPECT_EQ(strpy::par::find(text, "xy", 4), std::string_view::npos);
+
+        text[2000000] = 'y';
+        EXPECT_EQ(strpy::par::find(text, "xy", 4), 1999999);
+        EXPECT_EQ(strpy::par::find(text, "y", 0), 2000000);
+        EXPECT_EQ(strpy::par::find("abc", "", 4), 0);
+    }
+
+    TEST(ParallelSplitLinesTest, MatchesSequential)
+    {
+        const auto executor = strpy::par::make_thread_executor(4);
+        const auto text = repeat("first line\r\nsecond\n\n\r\rthird\r\n\r\n", 97) + "last";
+
+        for (const auto& str : {text, text + "\r\n", std::string{"\n\n\n"}, std::string{"x"}}) {
+            for (const std::size_t chunks : {2, 3, 7, 64, 1000}) {
+                for (const auto keep_ends : {false, true}) {
+                    const auto expected = strpy::split_lines(str, keep_ends);
+
+                    EXPECT_EQ(flatten(strpy::par::split_lines(str, keep_ends, executor, chunks)), expected) << chunks;
+                    EXPECT_EQ(flatten(strpy::par::split_lines(str, keep_ends, reverse_executor, chunks)), expected)
+                      << chunks;
+                }
+            }
+        }
+    }
+
+    TEST(ParallelSplitLinesTest, ThreadCount)
+    {
+        const auto text = repeat("The quick brown fox\njumps over the lazy dog\r\n", 20000);
+        const auto shards = strpy::par::split_lines(text, false, 4);
+
+        EXPECT_GT(shards.size(), 1U);
+        EXPECT_EQ(flatten(shards), strpy::split_lines(text));
+        EXPECT_EQ(strpy::par::split_lines("a\nb", false, 4).size(), 1U);
+        EXPECT_TRUE(flatten(strpy::par::split_lines("", true, 4)).empty());
+    }
+
+    TEST(ParallelSplitTest, MatchesSequential)
+    {
+        const auto executor = strpy::par::make_thread_executor(3);
+        const auto text = repeat("id, name ,,value,  ,", 113) + " end ";
+
+        for (const auto& str : {text, text + ",", std::string{",,,,"}, std::string{"x"}}) {
+            for (const auto options :
+                 {strpy::StringSplitOptions::none, strpy::StringSplitOptions::trim,
+                  strpy::StringSplitOptions::remove_empty, strpy::StringSplitOptions::trim_remove_empty}) {
+                for (const std::size_t chunks : {2, 5, 64, 1000}) {
+                    const auto expected = strpy::split(str, ',', options);
+
+                    EXPECT_EQ(flatten(strpy::par::split(str, ',', options, executor, chunks)), expected) << chunks;
+                    EXPECT_EQ(flatten(strpy::par::split(str, ',', options, reverse_executor, chunks)), expected)
+                      << chunks;
+                }
+            }
+        }
+    }
+
+    TEST(ParallelSplitTest, ThreadCount)
+    {
+        const auto text = repeat("record one;record two;;", 30000);
+        const auto shards = strpy::par::split(text, ';', strpy::StringSplitOptions::remove_empty, 4);
+
+        EXPECT_GT(shards.size(), 1U);
+        EXPECT_EQ(flatten(shards), strpy::split(text, ';', strpy::StringSplitOptions::remove_empty));
+        EXPECT_TRUE(flatten(strpy::par::split("", ';', strpy::StringSplitOptions::none, 4)).empty());
+    }
+}
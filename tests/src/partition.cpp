@@ -95,6 +95,24 @@ namespace
         EXPECT_EQ(third, u8"world");
     }
 
+    TEST(PartitionTest, Char)
+    {
+        auto [first, second, third] = strpy::partition("key=value=x", '=');
+        EXPECT_EQ(first, "key");
+        EXPECT_EQ(second, "=");
+        EXPECT_EQ(third, "value=x");
+
+        std::tie(first, second, third) = strpy::partition("key", '=');
+        EXPECT_EQ(first, "key");
+        EXPECT_EQ(second, "");
+        EXPECT_EQ(third, "");
+
+        std::tie(first, second, third) = strpy::partition("=", '=');
+        EXPECT_EQ(first, "");
+        EXPECT_EQ(second, "=");
+        EXPECT_EQ(third, "");
+    }
+
     TEST(PartitionICaseTest, SeparatorFound)
     {
         const auto& [first, second, third] = strpy::partition_icase("Hello, World!", ",");
@@ -254,6 +272,24 @@ namespace
         EXPECT_EQ(third, u8"world");
     }
 
+    TEST(RPartitionTest, Char)
+    {
+        auto [first, second, third] = strpy::rpartition("key=value=x", '=');
+        EXPECT_EQ(first, "key=value");
+        EXPECT_EQ(second, "=");
+        EXPECT_EQ(third, "x");
+
+        std::tie(first, second, third) = strpy::rpartition("key", '=');
+        EXPECT_EQ(first, "");
+        EXPECT_EQ(second, "");
+        EXPECT_EQ(third, "key");
+
+        std::tie(first, second, third) = strpy::rpartition("=", '=');
+        EXPECT_EQ(first, "");
+        EXPECT_EQ(second, "=");
+        EXPECT_EQ(third, "");
+    }
+
     TEST(RPartitionICaseTest, SeparatorNotFound)
     {
         const auto& [first, second, third] = strpy::rpartition_icase("hello", ",");
@@ -341,4 +377,52 @@ namespace
         EXPECT_EQ(second, "||W");
         EXPECT_EQ(third, "ORLD");
     }
+
+    TEST(PartitionTest, PartitionInto)
+    {
+        std::tuple<std::string, std::string, std::string> out{};
+
+        strpy::partition_into(out, "key=value=x", "=");
+        EXPECT_EQ(out, strpy::partition("key=value=x", "="));
+
+        strpy::partition_into(out, "key=value=x", '=');
+        EXPECT_EQ(out, strpy::partition("key=value=x", '='));
+
+        strpy::partition_into(out, "no separator", '=');
+        EXPECT_EQ(out, strpy::partition("no separator", '='));
+
+        strpy::partition_into(out, "no separator", "==");
+        EXPECT_EQ(out, strpy::partition("no separator", "=="));
+
+        strpy::partition_into_icase(out, "Hello, World!", "WORLD");
+        EXPECT_EQ(out, strpy::partition_icase("Hello, World!", "WORLD"));
+
+        strpy::rpartition_into(out, "key=value=x", "=");
+        EXPECT_EQ(out, strpy::rpartition("key=value=x", "="));
+
+        strpy::rpartition_into(out, "no separator", "=");
+        EXPECT_EQ(out, strpy::rpartition("no separator", "="));
+
+        strpy::rpartition_into(out, "key=value=x", '=');
+        EXPECT_EQ(out, strpy::rpartition("key=value=x", '='));
+
+        strpy::rpartition_into(out, "no separator", '=');
+        EXPECT_EQ(out, strpy::rpartition("no separator", '='));
+
+        strpy::rpartition_into_icase(out, "a-X-b-x-c", "X");
+        EXPECT_EQ(out, strpy::rpartition_icase("a-X-b-x-c", "X"));
+    }
+
+    TEST(PartitionTest, PartitionIntoReusesStrings)
+    {
+        const std::string key(40, 'k');
+        std::tuple<std::string, std::string, std::string> out{};
+
+        strpy::partition_into(out, key + "=" + key, '=');
+        const auto* const data = std::get<0>(out).data();
+
+        strpy::partition_into(out, key + ":" + key, ':');
+        EXPECT_EQ(std::get<0>(out), key);
+        EXPECT_EQ(std::get<0>(out).data(), data);
+    }
 }
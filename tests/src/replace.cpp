@@ -82,6 +82,31 @@ namespace
         EXPECT_EQ(strpy::replace("hello universe", "universe", "world"), "hello world");
     }
 
+    TEST(ReplaceTest, Char)
+    {
+        EXPECT_EQ(strpy::replace("a,b,,c", ',', ", "), "a, b, , c");
+        EXPECT_EQ(strpy::replace("a,b,,c", ',', ";"), "a;b;;c");
+        EXPECT_EQ(strpy::replace("a,b,,c", ',', ""), "abc");
+        EXPECT_EQ(strpy::replace("a,b,,c", ',', "--", 2), "a--b--,c");
+        EXPECT_EQ(strpy::replace("a,b,,c", ',', "--", 0), "a,b,,c");
+        EXPECT_EQ(strpy::replace("abc", ',', "--"), "abc");
+        EXPECT_EQ(strpy::replace(",", ',', "--"), "--");
+        EXPECT_EQ(strpy::replace("", ',', "--"), "");
+    }
+
+    TEST(ReplaceTest, CharMatchesString)
+    {
+        std::string str{};
+
+        for (int i = 0; i < 100; ++i) {
+            str += "line " + std::to_string(i) + '\n';
+        }
+
+        EXPECT_EQ(strpy::replace(str, '\n', "\r\n"), strpy::replace(str, "\n", "\r\n"));
+        EXPECT_EQ(strpy::replace(str, '\n', "\r\n", 42), strpy::replace(str, "\n", "\r\n", 42));
+        EXPECT_EQ(strpy::replace(str, ' ', "_"), strpy::replace(str, " ", "_"));
+    }
+
     TEST(ReplaceICaseTest, Basic)
     {
         EXPECT_EQ(strpy::replace_icase("hello world", "WORLD", "there"), "hello there");
@@ -140,4 +165,124 @@ namespace
     {
         EXPECT_EQ(strpy::replace_icase("hello universe", "UNIVERSE", "world"), "hello world");
     }
+
+    TEST(ReplaceTest, ManyOccurrences)
+    {
+        std::string str{};
+        std::string expected{};
+
+        for (int i = 0; i < 10000; ++i) {
+            str += "a-b ";
+            expected += "a+=b ";
+        }
+
+        EXPECT_EQ(strpy::replace(str, "-", "+="), expected);
+        EXPECT_EQ(strpy::replace(expected, "+=", "-"), str);
+    }
+
+    TEST(ReplaceInplaceTest, SameSize)
+    {
+        std::string str{"hello world world"};
+        const auto* const data = str.data();
+
+        EXPECT_EQ(strpy::replace_inplace(str, "world", "there"), 2);
+        EXPECT_EQ(str, "hello there there");
+        EXPECT_EQ(str.data(), data);
+    }
+
+    TEST(ReplaceInplaceTest, Shrinking)
+    {
+        std::string str{"one, two, three, four"};
+        const auto* const data = str.data();
+
+        EXPECT_EQ(strpy::replace_inplace(str, ", ", ";"), 3);
+        EXPECT_EQ(str, "one;two;three;four");
+        EXPECT_EQ(str.data(), data);
+
+        EXPECT_EQ(strpy::replace_inplace(str, "o", ""), 3);
+        EXPECT_EQ(str, "ne;tw;three;fur");
+    }
+
+    TEST(ReplaceInplaceTest, Growing)
+    {
+        std::string str{"a,b,,c"};
+        EXPECT_EQ(strpy::replace_inplace(str, ",", ", "), 3);
+        EXPECT_EQ(str, "a, b, , c");
+
+        str = "xx";
+        EXPECT_EQ(strpy::replace_inplace(str, "x", "xyz"), 2);
+        EXPECT_EQ(str, "xyzxyz");
+    }
+
+    TEST(ReplaceInplaceTest, CountParameter)
+    {
+        std::string str{"hello world world world"};
+        EXPECT_EQ(strpy::replace_inplace(str, "world", "there", 0), 0);
+        EXPECT_EQ(str, "hello world world world");
+
+        EXPECT_EQ(strpy::replace_inplace(str, "world", "x", 2), 2);
+        EXPECT_EQ(str, "hello x x world");
+
+        EXPECT_EQ(strpy::replace_inplace(str, "x", "world", 1), 1);
+        EXPECT_EQ(str, "hello world x world");
+    }
+
+    TEST(ReplaceInplaceTest, NoReplacements)
+    {
+        std::string str{"hello world"};
+        EXPECT_EQ(strpy::replace_inplace(str, "test", "there"), 0);
+        EXPECT_EQ(strpy::replace_inplace(str, "", "there"), 0);
+        EXPECT_EQ(str, "hello world");
+
+        str.clear();
+        EXPECT_EQ(strpy::replace_inplace(str, "world", "there"), 0);
+        EXPECT_EQ(str, "");
+    }
+
+    TEST(ReplaceInplaceTest, MatchesReplace)
+    {
+        const std::string str{"abcabcab cab abc aaabbbccc abcabc"};
+
+        for (const std::string_view old_value : {"a", "ab", "abc", "c a", "bc", "zz"}) {
+            for (const std::string_view new_value : {"", "x", "xy", "xyz", "wxyz0123"}) {
+                for (const std::size_t count : {std::size_t{1}, std::size_t{3}, std::string::npos}) {
+                    auto result = str;
+                    strpy::replace_inplace(result, old_value, new_value, count);
+                    EXPECT_EQ(result, strpy::replace(str, old_value, new_value, count))
+                      << old_value << ' ' << new_value << ' ' << count;
+                }
+            }
+        }
+    }
+
+    TEST(ReplaceInplaceTest, AliasedValues)
+    {
+        std::string str{"abc-abc-abc"};
+        EXPECT_EQ(strpy::replace_inplace(str, std::string_view{str}.substr(0, 3), std::string_view{str}.substr(3)),
+                  3);
+        EXPECT_EQ(str, "-abc-abc--abc-abc--abc-abc");
+
+        str = "abcabcabc";
+        EXPECT_EQ(strpy::replace_inplace(str, std::string_view{str}.substr(0, 3), std::string_view{str}.substr(1, 1)),
+                  3);
+        EXPECT_EQ(str, "bbb");
+
+        str = "x-x";
+        str.reserve(64);
+        EXPECT_EQ(strpy::replace_inplace_icase(str, "X", str), 2);
+        EXPECT_EQ(str, "x-x-x-x");
+    }
+
+    TEST(ReplaceInplaceICaseTest, Basic)
+    {
+        std::string str{"hello World WORLD"};
+        EXPECT_EQ(strpy::replace_inplace_icase(str, "world", "there"), 2);
+        EXPECT_EQ(str, "hello there there");
+
+        EXPECT_EQ(strpy::replace_inplace_icase(str, "THERE", "x", 1), 1);
+        EXPECT_EQ(str, "hello x there");
+
+        EXPECT_EQ(strpy::replace_inplace_icase(str, "X", "universe"), 1);
+        EXPECT_EQ(str, "hello universe there");
+    }
 }
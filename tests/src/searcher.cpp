@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/searcher.hpp"
+#include "stringpy/count.hpp"
+#include "stringpy/find.hpp"
+#include "stringpy/replace.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+namespace
+{
+    /** @brief Builds a repetitive text in which long needles have many partial matches */
+    std::string make_text()
+    {
+        std::string result{};
+
+        for (int i = 0; i < 200; ++i) {
+            result += "aaaaabaaaa The Quick Brown Fox jumps over the lazy dog; abcabcabd ";
+            result += std::to_string(i);
+        }
+
+        return result;
+    }
+
+    constexpr std::string_view NEEDLES[] = {
+      "a", "aa", "aaaab", "fox", "FOX", "the lazy dog; ", "abcabcabd", "The Quick Brown Fox jumps over",
+      "quick brown fox jumps over the lazy dog", "1999", "not found at all in the text", "x",
+    };
+
+    TEST(SearcherTest, Basic)
+    {
+        const auto searcher = strpy::make_searcher("world");
+        EXPECT_EQ(searcher.find("Hello, world! Hello, world!"), 7);
+        EXPECT_EQ(searcher.rfind("Hello, world! Hello, world!"), 21);
+        EXPECT_EQ(searcher.count("Hello, world! Hello, world!"), 2);
+        EXPECT_EQ(searcher.find("Hello, World!"), std::string_view::npos);
+        EXPECT_EQ(searcher.needle(), "world");
+        EXPECT_FALSE(searcher.icase());
+    }
+
+    TEST(SearcherTest, StartEnd)
+    {
+        constexpr std::string_view str{"The quick brown fox jumps over the lazy dog."};
+        const auto searcher = strpy::make_searcher("jumps");
+        EXPECT_EQ(searcher.find(str, 16), 20);
+        EXPECT_EQ(searcher.find(str, 0, 25), 20);
+        EXPECT_EQ(searcher.find(str, 16, 24), std::string_view::npos);
+        EXPECT_EQ(searcher.find(str, 100), std::string_view::npos);
+        EXPECT_EQ(searcher.find(str, 7, 5), std::string_view::npos);
+        EXPECT_EQ(searcher.rfind(str, 16, 25), 20);
+        EXPECT_EQ(searcher.count(str, 21), 0);
+    }
+
+    TEST(SearcherTest, EmptyNeedle)
+    {
+        const strpy::Searcher searcher{};
+        EXPECT_EQ(searcher.find("abc"), 0);
+        EXPECT_EQ(searcher.rfind("abc"), 3);
+        EXPECT_EQ(searcher.count("abc"), 4);
+        EXPECT_EQ(searcher.replace("abc", "x"), "abc");
+        EXPECT_EQ(searcher.find_all("ab"), (std::vector<std::size_t>{0, 1, 2}));
+        EXPECT_EQ(searcher.needle(), "");
+    }
+
+    TEST(SearcherTest, MatchesFreeFunctions)
+    {
+        const auto text = make_text();
+
+        for (const auto needle : NEEDLES) {
+            const auto searcher = strpy::make_searcher(needle);
+            EXPECT_EQ(searcher.find(text), strpy::find(text, needle)) << needle;
+            EXPECT_EQ(searcher.find(text, 1000), strpy::find(text, needle, 1000)) << needle;
+            EXPECT_EQ(searcher.rfind(text), strpy::rfind(text, needle)) << needle;
+            EXPECT_EQ(searcher.rfind(text, 0, 5000), strpy::rfind(text, needle, 0, 5000)) << needle;
+            EXPECT_EQ(searcher.count(text), strpy::count(text, needle)) << needle;
+            EXPECT_EQ(searcher.count(text, 10, 3000), strpy::count(text, needle, 10, 3000)) << needle;
+            EXPECT_EQ(searcher.replace(text, "<>"), strpy::replace(text, needle, "<>")) << needle;
+            EXPECT_EQ(searcher.replace(text, "", 3), strpy::replace(text, needle, "", 3)) << needle;
+            EXPECT_EQ(searcher.find_all(text).size(), strpy::count(text, needle)) << needle;
+        }
+    }
+
+    TEST(SearcherICaseTest, MatchesFreeFunctions)
+    {
+        const auto text = make_text();
+
+        for (const auto needle : NEEDLES) {
+            const auto searcher = strpy::make_searcher_icase(needle);
+            EXPECT_TRUE(searcher.icase());
+            EXPECT_EQ(searcher.find(text), strpy::find_icase(text, needle)) << needle;
+            EXPECT_EQ(searcher.find(text, 1000), strpy::find_icase(text, needle, 1000)) << needle;
+            EXPECT_EQ(searcher.rfind(text), strpy::rfind_icase(text, needle)) << needle;
+            EXPECT_EQ(searcher.rfind(text, 0, 5000), strpy::rfind_icase(text, needle, 0, 5000)) << needle;
+            EXPECT_EQ(searcher.count(text), strpy::count_icase(text, needle)) << needle;
+            EXPECT_EQ(searcher.replace(text, "<>"), strpy::replace_icase(text, needle, "<>")) << needle;
+        }
+    }
+
+    TEST(SearcherTest, FindAll)
+    {
+        const auto searcher = strpy::make_searcher("aa");
+        EXPECT_EQ(searcher.find_all("aaaaa"), (std::vector<std::size_t>{0, 2}));
+        EXPECT_EQ(searcher.find_all("bbb"), std::vector<std::size_t>{});
+
+        const auto searcher_icase = strpy::make_searcher_icase("Ab");
+        EXPECT_EQ(searcher_icase.find_all("abABaB"), (std::vector<std::size_t>{0, 2, 4}));
+    }
+
+    TEST(SearcherTest, SharedBetweenThreads)
+    {
+        const auto text = make_text();
+        const auto searcher = strpy::make_searcher("abcabcabd");
+        const auto expected = strpy::count(text, "abcabcabd");
+        std::size_t result1 = 0;
+        std::size_t result2 = 0;
+
+        std::thread thread1{[&] {
+            result1 = searcher.count(text);
+        }};
+
+        std::thread thread2{[&, copy = searcher] {
+            result2 = copy.count(text);
+        }};
+
+        thread1.join();
+        thread2.join();
+
+        EXPECT_EQ(result1, expected);
+        EXPECT_EQ(result2, expected);
+    }
+}
@@ -4,10 +4,126 @@
  */
 
 #include "stringpy/split.hpp"
+#include "stringpy/splitresult.hpp"
 #include <gtest/gtest.h>
+#include <string_view>
+#include <string>
+#include <vector>
 
 namespace
 {
+    /** @brief Checks that every view points into the given string */
+    bool views_point_into(const std::vector<std::string_view>& views, const std::string_view str)
+    {
+        for (const auto view : views) {
+            if ((view.data() < str.data()) || ((view.data() + view.size()) > (str.data() + str.size()))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /** @brief Checks whether a character is one of the space characters of Python's bytes.isspace() */
+    bool is_python_space(const char ch)
+    {
+        return std::string_view{" \t\n\v\f\r"}.find(ch) != std::string_view::npos;
+    }
+
+    /** @brief A byte-by-byte transcription of Python's str.split() without a separator */
+    std::vector<std::string> python_split(const std::string_view str, std::size_t max_split)
+    {
+        std::vector<std::string> result{};
+        std::size_t i = 0;
+
+        for (; max_split != 0; --max_split) {
+            while ((i < str.size()) && is_python_space(str[i])) {
+                ++i;
+            }
+
+            if (i == str.size()) {
+                return result;
+            }
+
+            const auto start = i;
+
+            while ((i < str.size()) && (!is_python_space(str[i]))) {
+                ++i;
+            }
+
+            result.emplace_back(str.substr(start, i - start));
+        }
+
+        while ((i < str.size()) && is_python_space(str[i])) {
+            ++i;
+        }
+
+        if (i < str.size()) {
+            result.emplace_back(str.substr(i));
+        }
+
+        return result;
+    }
+
+    /** @brief A byte-by-byte transcription of Python's str.rsplit() without a separator */
+    std::vector<std::string> python_rsplit(const std::string_view str, std::size_t max_split)
+    {
+        std::vector<std::string> result{};
+        auto i = str.size();
+
+        for (; max_split != 0; --max_split) {
+            while ((i != 0) && is_python_space(str[i - 1])) {
+                --i;
+            }
+
+            if (0 == i) {
+                break;
+            }
+
+            const auto end = i;
+
+            while ((i != 0) && (!is_python_space(str[i - 1]))) {
+                --i;
+            }
+
+            result.emplace(result.begin(), str.substr(i, end - i));
+        }
+
+        while ((i != 0) && is_python_space(str[i - 1])) {
+            --i;
+        }
+
+        if (i != 0) {
+            result.emplace(result.begin(), str.substr(0, i));
+        }
+
+        return result;
+    }
+
+    /** @brief Builds strings whose words and runs of space characters cross the 32-byte blocks of the tokenizer */
+    std::vector<std::string> whitespace_strings()
+    {
+        std::vector<std::string> strings = {" \t\n\v\f\r", "word", "\x1C\x1F\x85\xA0 \x08\x0E", std::string(1, '\0')};
+        const std::string_view pieces[] = {"a", " ", "bc", "\t\r\n", "defghij", "\v\f", "\x1C", "   ", "\xA0"};
+
+        for (std::size_t seed = 1; seed <= 40; ++seed) {
+            std::string str{};
+
+            for (std::size_t i = 0; str.size() < (seed * 3); ++i) {
+                str += pieces[((seed * 7) + (i * i * 5) + i) % std::size(pieces)];
+            }
+
+            strings.push_back(str);
+        }
+
+        return strings;
+    }
+    /** @brief Converts a vector of views to a vector of strings */
+    std::vector<std::string> to_strings(const std::vector<std::string_view>& views)
+    {
+        return {views.cbegin(), views.cend()};
+    }
+
     TEST(SplitTest, Basic)
     {
         std::string_view str{"  one two   three\t\r\n"};
@@ -43,7 +159,7 @@ namespace
     TEST(SplitTest, MaxSplit)
     {
         constexpr std::string_view str{"  one    two   three\t\r\n"};
-        std::vector<std::string> expected = {"one", "   two   three\t\r\n"};
+        std::vector<std::string> expected = {"one", "two   three\t\r\n"};
         auto result = strpy::split(str, 1);
         EXPECT_EQ(result, expected);
 
@@ -100,6 +216,68 @@ namespace
         EXPECT_EQ(result, expected);
     }
 
+    TEST(SplitTest, CharSet)
+    {
+        constexpr strpy::CharSet separators{",;"};
+        constexpr std::string_view str{",one;;two,three;"};
+        std::vector<std::string> expected = {"one", "two", "three"};
+        auto result = strpy::split(str, separators);
+        EXPECT_EQ(result, expected);
+
+        expected = {"one", "two,three;"};
+        result = strpy::split(str, separators, 1);
+        EXPECT_EQ(result, expected);
+
+        // The remainder loses its leading separators, the same as in the whitespace version
+        expected = {"a", "b  c "};
+        EXPECT_EQ(strpy::split(" a  b  c ", strpy::SPACE_SET, 1), expected);
+        EXPECT_EQ(strpy::split(" a  b  c ", 1), expected);
+
+        expected = {"a b", " c "};
+        result = strpy::split("a b, c ", strpy::CharSet{","});
+        EXPECT_EQ(result, expected);
+
+        EXPECT_EQ(strpy::split(" a\tb  c\n"), strpy::split(" a\tb  c\n", strpy::SPACE_SET));
+        EXPECT_TRUE(strpy::split(",;,", separators).empty());
+    }
+
+    TEST(SplitTest, Char)
+    {
+        std::vector<std::string> expected = {"a", "b", "", "c", ""};
+        EXPECT_EQ(strpy::split("a,b,,c,", ','), expected);
+
+        expected = {"a", "b,,c,"};
+        EXPECT_EQ(strpy::split("a,b,,c,", ',', 1), expected);
+
+        expected = {"a", "b", "c"};
+        EXPECT_EQ(strpy::split("a, b,, c,", ',', strpy::StringSplitOptions::trim_remove_empty), expected);
+
+        expected = {"a", "b", ",,c"};
+        EXPECT_EQ(strpy::split("a,,b,,,c", ',', 2, strpy::StringSplitOptions::remove_empty), expected);
+
+        expected = {"abc"};
+        EXPECT_EQ(strpy::split("abc", ','), expected);
+        EXPECT_TRUE(strpy::split("", ',').empty());
+
+        // An integer still selects the maximum number of splits of the whitespace version
+        expected = {"a", "b c"};
+        EXPECT_EQ(strpy::split("a b c", 1), expected);
+    }
+
+    TEST(SplitTest, CharMatchesString)
+    {
+        std::string str{};
+
+        for (int i = 0; i < 50; ++i) {
+            str += "field" + std::to_string(i) + ((i % 7 == 0) ? ";;" : ";");
+        }
+
+        EXPECT_EQ(strpy::split(str, ';'), strpy::split(str, ";"));
+        EXPECT_EQ(strpy::split(str, ';', 10), strpy::split(str, ";", 10));
+        EXPECT_EQ(strpy::split(str, ';', strpy::StringSplitOptions::remove_empty),
+                  strpy::split(str, ";", strpy::StringSplitOptions::remove_empty));
+    }
+
     TEST(RSplitTest, Basic)
     {
         std::string_view str{"  one two   three\t\r\n"};
@@ -135,7 +313,7 @@ namespace
     TEST(RSplitTest, MaxSplit)
     {
         constexpr std::string_view str{"\t\r\none    two   three  "};
-        std::vector<std::string> expected = {"\t\r\none    two  ", "three"};
+        std::vector<std::string> expected = {"\t\r\none    two", "three"};
         auto result = strpy::rsplit(str, 1);
         EXPECT_EQ(result, expected);
 
@@ -191,4 +369,164 @@ namespace
         result = strpy::rsplit(str, "", 0, strpy::StringSplitOptions::trim_remove_empty);
         EXPECT_EQ(result, expected);
     }
+
+    TEST(RSplitTest, CharSet)
+    {
+        constexpr strpy::CharSet separators{",;"};
+        constexpr std::string_view str{",one;;two,three;"};
+        std::vector<std::string> expected = {"one", "two", "three"};
+        auto result = strpy::rsplit(str, separators);
+        EXPECT_EQ(result, expected);
+
+        expected = {",one;;two", "three"};
+        result = strpy::rsplit(str, separators, 1);
+        EXPECT_EQ(result, expected);
+
+        expected = {" a  b", "c"};
+        EXPECT_EQ(strpy::rsplit(" a  b  c ", strpy::SPACE_SET, 1), expected);
+        EXPECT_EQ(strpy::rsplit(" a  b  c ", 1), expected);
+
+        expected = {",one", "two", "three"};
+        EXPECT_EQ(strpy::rsplit(",one;;two,,three", separators, 2), expected);
+
+        EXPECT_EQ(strpy::rsplit(" a\tb  c\n"), strpy::rsplit(" a\tb  c\n", strpy::SPACE_SET));
+        EXPECT_TRUE(strpy::rsplit(",;,", separators).empty());
+    }
+
+    TEST(SplitTest, StringView)
+    {
+        constexpr std::string_view str{" one, two,,three , "};
+        const std::vector<std::string_view> expected = {" one", " two", "", "three ", " "};
+        const auto result = strpy::split<std::string_view>(str, ",");
+        EXPECT_EQ(result, expected);
+        EXPECT_TRUE(views_point_into(result, str));
+
+        for (const auto options :
+             {strpy::StringSplitOptions::none, strpy::StringSplitOptions::trim, strpy::StringSplitOptions::remove_empty,
+              strpy::StringSplitOptions::trim_remove_empty}) {
+            for (const std::size_t max_split : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::string::npos}) {
+                EXPECT_EQ(to_strings(strpy::split<std::string_view>(str, ",", max_split, options)),
+                          strpy::split(str, ",", max_split, options));
+                EXPECT_EQ(to_strings(strpy::split<std::string_view>(str, ',', max_split, options)),
+                          strpy::split(str, ',', max_split, options));
+                EXPECT_EQ(to_strings(strpy::rsplit<std::string_view>(str, ",", max_split, options)),
+                          strpy::rsplit(str, ",", max_split, options));
+            }
+        }
+
+        EXPECT_EQ(to_strings(strpy::split<std::string_view>(str)), strpy::split(str));
+        EXPECT_EQ(to_strings(strpy::split<std::string_view>(str, 1)), strpy::split(str, 1));
+        EXPECT_EQ(to_strings(strpy::split<std::string_view>(str, ',')), strpy::split(str, ','));
+        EXPECT_EQ(to_strings(strpy::split<std::string_view>(str, strpy::CharSet{", "})),
+                  strpy::split(str, strpy::CharSet{", "}));
+        EXPECT_EQ(to_strings(strpy::rsplit<std::string_view>(str)), strpy::rsplit(str));
+        EXPECT_EQ(to_strings(strpy::rsplit<std::string_view>(str, strpy::CharSet{", "}, 2)),
+                  strpy::rsplit(str, strpy::CharSet{", "}, 2));
+        EXPECT_EQ(to_strings(strpy::split<std::string_view>(str, "")), strpy::split(str, ""));
+        EXPECT_TRUE(strpy::split<std::string_view>("", ",").empty());
+        EXPECT_TRUE(strpy::rsplit<std::string_view>("").empty());
+    }
+
+    TEST(RSplitTest, StringView)
+    {
+        const std::string str{"a--b----c--"};
+        const std::vector<std::string_view> expected = {"a--b", "", "c", ""};
+        const auto result = strpy::rsplit<std::string_view>(str, "--", 3);
+        EXPECT_EQ(result, expected);
+        EXPECT_TRUE(views_point_into(result, str));
+        EXPECT_EQ(to_strings(strpy::rsplit<std::string_view>(str, "--", strpy::StringSplitOptions::remove_empty)),
+                  strpy::rsplit(str, "--", strpy::StringSplitOptions::remove_empty));
+    }
+
+    TEST(SplitTest, SplitInto)
+    {
+        std::vector<std::string> out = {"stale"};
+        strpy::split_into(out, "a,b,,c", ",");
+        EXPECT_EQ(out, (std::vector<std::string>{"a", "b", "", "c"}));
+
+        strpy::split_into(out, "x y", 1);
+        EXPECT_EQ(out, (std::vector<std::string>{"x", "y"}));
+
+        strpy::split_into(out, "a; b;;c", ';', strpy::StringSplitOptions::trim_remove_empty);
+        EXPECT_EQ(out, (std::vector<std::string>{"a", "b", "c"}));
+
+        strpy::split_into(out, "");
+        EXPECT_TRUE(out.empty());
+
+        for (const auto options :
+             {strpy::StringSplitOptions::none, strpy::StringSplitOptions::trim_remove_empty}) {
+            for (const std::size_t max_split : {std::size_t{1}, std::string::npos}) {
+                std::vector<std::string_view> views{"stale"};
+                strpy::SplitResult compact{};
+                constexpr std::string_view str{" a , b,, c ,"};
+
+                strpy::split_into(out, str, ",", max_split, options);
+                EXPECT_EQ(out, strpy::split(str, ",", max_split, options));
+                strpy::split_into(views, str, ',', max_split, options);
+                EXPECT_EQ(to_strings(views), strpy::split(str, ',', max_split, options));
+                strpy::split_into(compact, str, ",", max_split, options);
+                EXPECT_EQ(compact, strpy::split<strpy::SplitResult>(str, ",", max_split, options));
+            }
+        }
+    }
+
+    TEST(SplitTest, SplitIntoReusesStrings)
+    {
+        const std::string first(40, 'a');
+        const std::string second(40, 'b');
+        std::vector<std::string> out{};
+
+        strpy::split_into(out, first + "," + first + "," + first, ',');
+        ASSERT_EQ(out.size(), 3U);
+        const auto* const vector_data = out.data();
+        const auto* const string_data = out[1].data();
+
+        strpy::split_into(out, second + "," + second, ',');
+        ASSERT_EQ(out.size(), 2U);
+        EXPECT_EQ(out[1], second);
+        EXPECT_EQ(out.data(), vector_data);
+        EXPECT_EQ(out[1].data(), string_data);
+    }
+
+    TEST(RSplitTest, RSplitInto)
+    {
+        std::vector<std::string> out = {"stale", "stale", "stale", "stale", "stale", "stale"};
+        strpy::rsplit_into(out, "a,b,,c", ",", 2);
+        EXPECT_EQ(out, (std::vector<std::string>{"a,b", "", "c"}));
+
+        strpy::rsplit_into(out, " one two  three ", 1);
+        EXPECT_EQ(out, strpy::rsplit(" one two  three ", 1));
+
+        strpy::rsplit_into(out, ",one;;two,", strpy::CharSet{",;"});
+        EXPECT_EQ(out, (std::vector<std::string>{"one", "two"}));
+
+        strpy::rsplit_into(out, "a--b----c--", "--", strpy::StringSplitOptions::remove_empty);
+        EXPECT_EQ(out, (std::vector<std::string>{"a", "b", "c"}));
+    }
+
+    TEST(SplitTest, Whitespace)
+    {
+        for (const auto& str : whitespace_strings()) {
+            for (const std::size_t max_split : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::string::npos}) {
+                EXPECT_EQ(strpy::split(str, max_split), python_split(str, max_split)) << max_split << ": " << str;
+                EXPECT_EQ(to_strings(strpy::split<std::string_view>(str, max_split)), python_split(str, max_split));
+            }
+        }
+
+        EXPECT_EQ(strpy::split("  a  ", 0), (std::vector<std::string>{"a  "}));
+        EXPECT_EQ(strpy::split("a  ", 1), (std::vector<std::string>{"a"}));
+    }
+
+    TEST(RSplitTest, Whitespace)
+    {
+        for (const auto& str : whitespace_strings()) {
+            for (const std::size_t max_split : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::string::npos}) {
+                EXPECT_EQ(strpy::rsplit(str, max_split), python_rsplit(str, max_split)) << max_split << ": " << str;
+                EXPECT_EQ(to_strings(strpy::rsplit<std::string_view>(str, max_split)), python_rsplit(str, max_split));
+            }
+        }
+
+        EXPECT_EQ(strpy::rsplit("  a  ", 0), (std::vector<std::string>{"  a"}));
+        EXPECT_EQ(strpy::rsplit("  a", 1), (std::vector<std::string>{"a"}));
+    }
 }
@@ -4,10 +4,37 @@
  */
 
 #include "stringpy/splitlines.hpp"
+#include "stringpy/splitview.hpp"
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 
 namespace
 {
+    /** @brief Splits a string into lines one byte at a time */
+    std::vector<std::string> reference_split_lines(const std::string_view str, const bool keep_ends)
+    {
+        std::vector<std::string> result{};
+        std::size_t start = 0;
+
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            if ((str[i] != '\r') && (str[i] != '\n')) {
+                continue;
+            }
+
+            const auto next = ((str[i] == '\r') && ((i + 1) < str.size()) && (str[i + 1] == '\n')) ? (i + 2) : (i + 1);
+            result.emplace_back(str.substr(start, (keep_ends ? next : i) - start));
+            start = next;
+            i = next - 1;
+        }
+
+        if (start < str.size()) {
+            result.emplace_back(str.substr(start));
+        }
+
+        return result;
+    }
+
     TEST(SplitlinesTest, Basic)
     {
         constexpr std::string_view str{"Line 1\nLine 2\nLine 3\n"};
@@ -90,4 +117,70 @@ namespace
         ASSERT_EQ(result[7], "Line 2\n");
         ASSERT_EQ(result[8], "Line 3\r");
     }
+
+    TEST(SplitlinesTest, StringView)
+    {
+        constexpr std::string_view str{"Line 1\r\n\r\r\n\n\n\r\rLine 2\nLine 3\r"};
+
+        for (const auto keep_ends : {false, true}) {
+            const auto views = strpy::split_lines<std::string_view>(str, keep_ends);
+            const auto strings = strpy::split_lines(str, keep_ends);
+            ASSERT_EQ(views.size(), strings.size());
+
+            for (std::size_t i = 0; i < views.size(); ++i) {
+                EXPECT_EQ(views[i], strings[i]);
+                EXPECT_GE(views[i].data(), str.data());
+                EXPECT_LE(views[i].data() + views[i].size(), str.data() + str.size());
+            }
+        }
+
+        EXPECT_TRUE(strpy::split_lines<std::string_view>("").empty());
+    }
+
+    TEST(SplitlinesTest, SplitLinesInto)
+    {
+        constexpr std::string_view str{"Line 1\r\nLine 2\rLine 3"};
+        std::vector<std::string> out = {"stale", "stale", "stale", "stale"};
+
+        strpy::split_lines_into(out, str);
+        EXPECT_EQ(out, strpy::split_lines(str));
+
+        strpy::split_lines_into(out, str, true);
+        EXPECT_EQ(out, strpy::split_lines(str, true));
+
+        std::vector<std::string_view> views{};
+        strpy::split_lines_into(views, str);
+        ASSERT_EQ(views.size(), 3U);
+        EXPECT_EQ(views[2], "Line 3");
+
+        strpy::SplitResult compact{};
+        strpy::split_lines_into(compact, str, true);
+        EXPECT_EQ(compact, strpy::split_lines<strpy::SplitResult>(str, true));
+
+        strpy::split_lines_into(out, "");
+        EXPECT_TRUE(out.empty());
+    }
+
+    TEST(SplitlinesTest, BlockBoundaries)
+    {
+        // Line breaks, and the two halves of CR LF, on both sides of the 16 and 32 byte vector blocks
+        for (std::size_t offset = 0; offset < 70; ++offset) {
+            for (const std::string_view line_break : {"\n", "\r", "\r\n", "\n\r", "\r\r\n"}) {
+                std::string str(offset, 'x');
+                str += line_break;
+                str += std::string(offset % 37, 'y') + "\r\n" + std::string(100 - offset, 'z');
+                str += line_break;
+
+                for (const auto keep_ends : {false, true}) {
+                    const auto expected = reference_split_lines(str, keep_ends);
+
+                    EXPECT_EQ(strpy::split_lines(str, keep_ends), expected) << offset;
+                    EXPECT_EQ(std::vector<std::string>(strpy::lines_view(str, keep_ends).begin(),
+                                                       strpy::lines_view(str, keep_ends).end()),
+                              expected)
+                      << offset;
+                }
+            }
+        }
+    }
 }
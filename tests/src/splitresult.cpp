@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/splitresult.hpp"
+#include "stringpy/split.hpp"
+#include "stringpy/splitlines.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string> to_strings(const strpy::SplitResult& result)
+    {
+        return {result.begin(), result.end()};
+    }
+
+    TEST(SplitResultTest, Empty)
+    {
+        const strpy::SplitResult result{};
+        EXPECT_TRUE(result.empty());
+        EXPECT_EQ(result.size(), 0U);
+        EXPECT_EQ(result.begin(), result.end());
+        EXPECT_TRUE(result.buffer().empty());
+    }
+
+    TEST(SplitResultTest, PushBack)
+    {
+        strpy::SplitResult result{};
+        result.push_back("one");
+        result.push_back("");
+        result.push_back("three");
+
+        ASSERT_EQ(result.size(), 3U);
+        EXPECT_EQ(result[0], "one");
+        EXPECT_EQ(result[1], "");
+        EXPECT_EQ(result[2], "three");
+        EXPECT_EQ(result.front(), "one");
+        EXPECT_EQ(result.back(), "three");
+        EXPECT_EQ(result.buffer(), "onethree");
+
+        result.clear();
+        EXPECT_TRUE(result.empty());
+        EXPECT_TRUE(result.buffer().empty());
+    }
+
+    TEST(SplitResultTest, Iterator)
+    {
+        strpy::SplitResult result{};
+        const std::vector<std::string_view> tokens = {"a", "bb", "ccc", "dddd"};
+        result.assign(tokens.cbegin(), tokens.cend());
+
+        EXPECT_EQ(result.end() - result.begin(), 4);
+        EXPECT_EQ(*(result.begin() + 2), "ccc");
+        EXPECT_EQ(result.begin()[3], "dddd");
+        EXPECT_EQ(*std::prev(result.end()), "dddd");
+        EXPECT_TRUE(result.begin() < result.end());
+        EXPECT_EQ(std::find(result.begin(), result.end(), "bb") - result.begin(), 1);
+        EXPECT_TRUE(std::equal(result.begin(), result.end(), tokens.cbegin(), tokens.cend()));
+
+        auto it = result.end();
+        --it;
+        it -= 2;
+        EXPECT_EQ(*it++, "bb");
+        EXPECT_EQ(*it, "ccc");
+    }
+
+    TEST(SplitResultTest, Split)
+    {
+        constexpr std::string_view str{" a , b,, c ,"};
+
+        for (const auto options :
+             {strpy::StringSplitOptions::none, strpy::StringSplitOptions::trim, strpy::StringSplitOptions::remove_empty,
+              strpy::StringSplitOptions::trim_remove_empty}) {
+            for (const std::size_t max_split : {std::size_t{0}, std::size_t{2}, std::string::npos}) {
+                EXPECT_EQ(to_strings(strpy::split<strpy::SplitResult>(str, ",", max_split, options)),
+                          strpy::split(str, ",", max_split, options));
+                EXPECT_EQ(to_strings(strpy::split<strpy::SplitResult>(str, ',', max_split, options)),
+                          strpy::split(str, ',', max_split, options));
+                EXPECT_EQ(to_strings(strpy::rsplit<strpy::SplitResult>(str, ",", max_split, options)),
+                          strpy::rsplit(str, ",", max_split, options));
+            }
+        }
+
+        EXPECT_EQ(to_strings(strpy::split<strpy::SplitResult>(str)), strpy::split(str));
+        EXPECT_EQ(to_strings(strpy::rsplit<strpy::SplitResult>(str, 1)), strpy::rsplit(str, 1));
+        EXPECT_EQ(to_strings(strpy::split<strpy::SplitResult>(str, strpy::CharSet{", "})),
+                  strpy::split(str, strpy::CharSet{", "}));
+        EXPECT_TRUE(strpy::split<strpy::SplitResult>("", ",").empty());
+
+        const auto result = strpy::split<strpy::SplitResult>("id,name,city", ',');
+        EXPECT_EQ(result.buffer(), "idnamecity");
+        EXPECT_EQ(result, strpy::split<strpy::SplitResult>("id;name;city", ';'));
+        EXPECT_NE(result, strpy::split<strpy::SplitResult>("idn,ame,city", ','));
+    }
+
+    TEST(SplitResultTest, SplitLines)
+    {
+        constexpr std::string_view str{"Line 1\r\n\r\r\n\n\n\r\rLine 2\nLine 3\r"};
+
+        EXPECT_EQ(to_strings(strpy::split_lines<strpy::SplitResult>(str)), strpy::split_lines(str));
+        EXPECT_EQ(to_strings(strpy::split_lines<strpy::SplitResult>(str, true)), strpy::split_lines(str, true));
+        EXPECT_TRUE(strpy::split_lines<strpy::SplitResult>("").empty());
+    }
+}
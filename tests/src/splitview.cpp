@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/splitview.hpp"
+#include "stringpy/split.hpp"
+#include "stringpy/splitlines.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <typename Range>
+    std::vector<std::string> collect(const Range& range)
+    {
+        return {range.begin(), range.end()};
+    }
+
+    template <typename Range>
+    std::vector<std::string> collect_reversed(const Range& range)
+    {
+        auto result = collect(range);
+        std::reverse(result.begin(), result.end());
+
+        return result;
+    }
+
+    TEST(SplitViewTest, Basic)
+    {
+        EXPECT_EQ(collect(strpy::split_view("a,b,,c,", ",")), (std::vector<std::string>{"a", "b", "", "c", ""}));
+        EXPECT_EQ(collect(strpy::split_view("  one two\t three  ")), (std::vector<std::string>{"one", "two", "three"}));
+        EXPECT_EQ(collect(strpy::split_view("a--b--c", "--", 1)), (std::vector<std::string>{"a", "b--c"}));
+        EXPECT_EQ(collect(strpy::split_view("a,b;c", strpy::CharSet{",;"})), (std::vector<std::string>{"a", "b", "c"}));
+        EXPECT_EQ(collect(strpy::split_view(",a;;b,c;", strpy::CharSet{",;"}, 1)), (std::vector<std::string>{"a", "b,c;"}));
+        EXPECT_EQ(collect(strpy::split_view("a b c", 1)), (std::vector<std::string>{"a", "b c"}));
+        EXPECT_EQ(collect(strpy::split_view("  a   b c  ", 1)), (std::vector<std::string>{"a", "b c  "}));
+        EXPECT_EQ(collect(strpy::split_view("abc", "")), (std::vector<std::string>{"abc"}));
+        EXPECT_TRUE(strpy::split_view("").empty());
+        EXPECT_TRUE(strpy::split_view("", ",").empty());
+        EXPECT_TRUE(strpy::split_view(" \t\n").empty());
+    }
+
+    TEST(SplitViewTest, Options)
+    {
+        constexpr std::string_view str{" a , b,, c ,"};
+
+        EXPECT_EQ(collect(strpy::split_view(str, ",", strpy::StringSplitOptions::trim)),
+                  (std::vector<std::string>{"a", "b", "", "c", ""}));
+        EXPECT_EQ(collect(strpy::split_view(str, ",", strpy::StringSplitOptions::remove_empty)),
+                  (std::vector<std::string>{" a ", " b", " c "}));
+        EXPECT_EQ(collect(strpy::split_view(str, ',', strpy::StringSplitOptions::trim_remove_empty)),
+                  (std::vector<std::string>{"a", "b", "c"}));
+    }
+
+    TEST(SplitViewTest, MatchesSplit)
+    {
+        const std::vector<std::string> strings = {"a,b,,c,", ",,a,,", " a , b,, c ,", ",", "abc", "a,,,,,,,,,b"};
+
+        for (const auto& str : strings) {
+            for (const auto options :
+                 {strpy::StringSplitOptions::none, strpy::StringSplitOptions::trim,
+                  strpy::StringSplitOptions::remove_empty, strpy::StringSplitOptions::trim_remove_empty}) {
+                for (const std::size_t max_split : {std::size_t{0}, std::size_t{2}, std::string::npos}) {
+                    EXPECT_EQ(collect(strpy::split_view(str, ",", max_split, options)),
+                              strpy::split(str, ",", max_split, options))
+                      << str;
+                    EXPECT_EQ(collect(strpy::split_view(str, ',', max_split, options)),
+                              strpy::split(str, ',', max_split, options))
+                      << str;
+                    EXPECT_EQ(collect_reversed(strpy::rsplit_view(str, ",", max_split, options)),
+                              strpy::rsplit(str, ",", max_split, options))
+                      << str;
+                    EXPECT_EQ(collect_reversed(strpy::rsplit_view(str, ',', max_split, options)),
+                              strpy::rsplit(str, ",", max_split, options))
+                      << str;
+                }
+            }
+
+            for (const std::size_t max_split : {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::string::npos}) {
+                EXPECT_EQ(collect(strpy::split_view(str, strpy::CharSet{", "}, max_split)),
+                          strpy::split(str, strpy::CharSet{", "}, max_split))
+                  << str;
+                EXPECT_EQ(collect_reversed(strpy::rsplit_view(str, strpy::CharSet{", "}, max_split)),
+                          strpy::rsplit(str, strpy::CharSet{", "}, max_split))
+                  << str;
+            }
+
+            EXPECT_EQ(collect(strpy::split_view(str, 2)), strpy::split(str, 2)) << str;
+            EXPECT_EQ(collect_reversed(strpy::rsplit_view(str, 2)), strpy::rsplit(str, 2)) << str;
+        }
+    }
+
+    TEST(RSplitViewTest, Basic)
+    {
+        EXPECT_EQ(collect(strpy::rsplit_view("a,b,,c,", ",")), (std::vector<std::string>{"", "c", "", "b", "a"}));
+        EXPECT_EQ(collect(strpy::rsplit_view("one two three", 1)), (std::vector<std::string>{"three", "one two"}));
+        EXPECT_EQ(collect(strpy::rsplit_view("a--b----c--", "--", 3)),
+                  (std::vector<std::string>{"", "c", "", "a--b"}));
+        EXPECT_EQ(collect(strpy::rsplit_view("a,b,,c", ',', 2)), (std::vector<std::string>{"c", "", "a,b"}));
+        EXPECT_EQ(collect(strpy::rsplit_view(" a b ")), (std::vector<std::string>{"b", "a"}));
+        EXPECT_EQ(collect(strpy::rsplit_view("  a b  c  ", 1)), (std::vector<std::string>{"c", "  a b"}));
+        EXPECT_TRUE(strpy::rsplit_view("").empty());
+    }
+
+    TEST(SplitViewTest, Algorithms)
+    {
+        constexpr std::string_view str{"id,name,city,zip"};
+        const auto range = strpy::split_view(str, ',');
+
+        EXPECT_EQ(std::distance(range.begin(), range.end()), 4);
+        EXPECT_EQ(*std::next(range.begin(), 2), "city");
+        EXPECT_NE(std::find(range.begin(), range.end(), "zip"), range.end());
+        EXPECT_EQ(std::find(range.begin(), range.end(), "missing"), range.end());
+
+        auto it = range.begin();
+        const auto copy = it++;
+        EXPECT_EQ(*copy, "id");
+        EXPECT_EQ(*it, "name");
+        EXPECT_EQ(it->size(), 4U);
+        EXPECT_EQ(copy, range.begin());
+        EXPECT_NE(copy, it);
+
+        for (const auto token : range) {
+            EXPECT_GE(token.data(), str.data());
+            EXPECT_LE(token.data() + token.size(), str.data() + str.size());
+        }
+    }
+
+    TEST(LinesViewTest, MatchesSplitLines)
+    {
+        const std::vector<std::string> strings = {"Line 1\nLine 2\nLine 3\n",
+                                                  "Line 1\r\n\r\r\n\n\n\r\rLine 2\nLine 3\r",
+                                                  "single",
+                                                  "\n",
+                                                  "\r\n",
+                                                  "",
+                                                  "a\r"};
+
+        for (const auto& str : strings) {
+            EXPECT_EQ(collect(strpy::lines_view(str)), strpy::split_lines(str)) << str;
+            EXPECT_EQ(collect(strpy::lines_view(str, true)), strpy::split_lines(str, true)) << str;
+        }
+
+        EXPECT_TRUE(strpy::lines_view("").empty());
+        EXPECT_FALSE(strpy::lines_view("\n").empty());
+    }
+}
@@ -268,4 +268,16 @@ namespace
         EXPECT_EQ(strpy::strip("   "), "");
         EXPECT_EQ(strpy::strip("***", "*"), "");
     }
+
+    TEST(StripTest, CharSet)
+    {
+        constexpr strpy::CharSet punctuation{".,!?"};
+        EXPECT_EQ(strpy::lstrip("?!Hello, world!..", punctuation), "Hello, world!..");
+        EXPECT_EQ(strpy::rstrip("?!Hello, world!..", punctuation), "?!Hello, world");
+        EXPECT_EQ(strpy::strip("?!Hello, world!..", punctuation), "Hello, world");
+        EXPECT_EQ(strpy::strip<std::string_view>("?!.", punctuation), "");
+        EXPECT_EQ(strpy::strip("abc", strpy::CharSet{}), "abc");
+        EXPECT_EQ(strpy::strip(" \t\v abc \f\r\n"), "abc");
+        EXPECT_EQ(strpy::strip(" \t\v abc \f\r\n", strpy::SPACE_SET), strpy::strip(" \t\v abc \f\r\n", " \f\n\r\t\v"));
+    }
 }
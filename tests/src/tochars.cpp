@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2023 the_hunter
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "stringpy/tochars.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace
+{
+    /** @brief Writes a number into a string */
+    template <typename T>
+    std::string write(const T value)
+    {
+        std::array<char, strpy::TO_CHARS_MAX_SIZE> buffer{};
+        return {buffer.data(), strpy::to_chars(buffer.data(), value)};
+    }
+
+    TEST(ToCharsTest, Integers)
+    {
+        EXPECT_EQ(write(0), "0");
+        EXPECT_EQ(write(7), "7");
+        EXPECT_EQ(write(-7), "-7");
+        EXPECT_EQ(write(10), "10");
+        EXPECT_EQ(write(99), "99");
+        EXPECT_EQ(write(100), "100");
+        EXPECT_EQ(write(static_cast<short>(-12345)), "-12345");
+        EXPECT_EQ(write(std::numeric_limits<std::int64_t>::min()), "-9223372036854775808");
+        EXPECT_EQ(write(std::numeric_limits<std::int64_t>::max()), "9223372036854775807");
+        EXPECT_EQ(write(std::numeric_limits<std::uint64_t>::max()), "18446744073709551615");
+
+        std::uint64_t power = 1;
+
+        for (int digits = 1; digits < std::numeric_limits<std::uint64_t>::digits10; ++digits) {
+            EXPECT_EQ(write(power - 1).size(), (digits == 1) ? 1U : static_cast<std::size_t>(digits - 1));
+            EXPECT_EQ(write(power), "1" + std::string(static_cast<std::size_t>(digits - 1), '0'));
+            power *= 10;
+        }
+    }
+
+    TEST(ToCharsTest, Floats)
+    {
+        EXPECT_EQ(write(0.0), "0");
+        EXPECT_EQ(write(-0.0), "-0");
+        EXPECT_EQ(write(1.0), "1");
+        EXPECT_EQ(write(100.0), "100");
+        EXPECT_EQ(write(3.140), "3.14");
+        EXPECT_EQ(write(0.1), "0.1");
+        EXPECT_EQ(write(-2.5F), "-2.5");
+        EXPECT_EQ(write(0.1F), "0.1");
+        EXPECT_EQ(write(1.0L), "1");
+        EXPECT_EQ(write(123456.789), "123456.789");
+        EXPECT_EQ(write(0.0001), "0.0001");
+        EXPECT_EQ(write(0.00001), "1e-05");
+        EXPECT_EQ(write(1e15), "1000000000000000");
+        EXPECT_EQ(write(1e16), "1e+16");
+        EXPECT_EQ(write(1.5e300), "1.5e+300");
+        EXPECT_EQ(write(std::numeric_limits<double>::infinity()), "inf");
+        EXPECT_EQ(write(-std::numeric_limits<double>::infinity()), "-inf");
+        EXPECT_EQ(write(std::numeric_limits<double>::quiet_NaN()), "nan");
+    }
+
+    TEST(ToCharsTest, FloatsRoundTrip)
+    {
+        for (const double value : {0.3, 2.0 / 3.0, 1e-300, 5e-324, 1.7976931348623157e308, 299792458.0, 6.02214076e23,
+                                   std::numeric_limits<double>::min(), std::numeric_limits<double>::epsilon()}) {
+            const auto str = write(value);
+            EXPECT_EQ(std::strtod(str.c_str(), nullptr), value) << str;
+            EXPECT_LE(str.size(), strpy::TO_CHARS_MAX_SIZE);
+        }
+
+        for (const float value : {0.3F, 1.0F / 3.0F, std::numeric_limits<float>::max(), 16777217.0F}) {
+            const auto str = write(value);
+            EXPECT_EQ(std::strtof(str.c_str(), nullptr), value) << str;
+        }
+    }
+}